@@ -0,0 +1,26 @@
+package app.rive.benchmark
+
+import android.os.Bundle
+import androidx.activity.ComponentActivity
+import app.rive.runtime.example.R
+import app.rive.runtime.kotlin.RiveAnimationView
+import app.rive.runtime.kotlin.core.Fit
+import app.rive.runtime.kotlin.core.RendererType
+
+/**
+ * Renders a path-heavy file with the legacy Canvas renderer, which crosses JNI for every path
+ * verb, paint change and draw call. Tracing is enabled so the benchmark can measure the
+ * `Rive/Frame/Draw/Render` section on its own.
+ */
+class BenchmarkCanvasRendererActivity : ComponentActivity() {
+    override fun onCreate(savedInstanceState: Bundle?) {
+        super.onCreate(savedInstanceState)
+        val riveView = RiveAnimationView.Builder(this)
+            .setResource(R.raw.off_road_car_blog)
+            .setRendererType(RendererType.Canvas)
+            .setFit(Fit.CONTAIN)
+            .setTraceAnimations(true)
+            .build()
+        setContentView(riveView)
+    }
+}
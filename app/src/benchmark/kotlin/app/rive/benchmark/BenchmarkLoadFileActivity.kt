@@ -0,0 +1,112 @@
+package app.rive.benchmark
+
+import android.os.Bundle
+import android.os.ParcelFileDescriptor
+import android.os.SystemClock
+import android.util.Log
+import android.view.View
+import androidx.activity.ComponentActivity
+import androidx.lifecycle.Lifecycle
+import androidx.lifecycle.lifecycleScope
+import androidx.lifecycle.repeatOnLifecycle
+import app.rive.core.FileHandle
+import app.rive.core.RiveWorker
+import app.rive.runtime.example.R
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.isActive
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.withContext
+import java.io.File
+import java.io.RandomAccessFile
+import java.nio.channels.FileChannel
+
+private const val BENCHMARK_LOAD_FILE_TAG = "BenchmarkLoadFileActivity"
+
+/**
+ * Repeatedly loads and deletes a multi-megabyte Rive file through the command queue, reading it
+ * from the source given by the string extra [EXTRA_SOURCE]:
+ * - [SOURCE_BYTES] reads the file into a byte array, the default path.
+ * - [SOURCE_BUFFER] maps the file into a direct `MappedByteBuffer`.
+ * - [SOURCE_FD] passes a file descriptor for native code to map.
+ *
+ * The benchmark measures the `Rive/LoadFile/Submit` section, the main thread's share of each load,
+ * along with peak memory. Mean load time and peak RSS are also logged for manual runs.
+ */
+class BenchmarkLoadFileActivity : ComponentActivity() {
+    override fun onCreate(savedInstanceState: Bundle?) {
+        super.onCreate(savedInstanceState)
+        setContentView(View(this))
+
+        val source = intent.getStringExtra(EXTRA_SOURCE) ?: SOURCE_BYTES
+        val riveWorker = RiveWorker().also { worker ->
+            worker.withLifecycle(this, BENCHMARK_LOAD_FILE_TAG)
+            lifecycleScope.launch { worker.beginPolling(lifecycle) }
+        }
+
+        lifecycleScope.launch {
+            // Copy the resource out of the APK once so that every source reads the same
+            // uncompressed file.
+            val file = withContext(Dispatchers.IO) {
+                File(cacheDir, "benchmark_load_file.riv").also { file ->
+                    resources.openRawResource(R.raw.blinko).use { input ->
+                        file.outputStream().use { input.copyTo(it) }
+                    }
+                }
+            }
+
+            repeatOnLifecycle(Lifecycle.State.RESUMED) {
+                var loads = 0
+                var windowStartMs = SystemClock.elapsedRealtime()
+                while (isActive) {
+                    riveWorker.deleteFile(load(riveWorker, file, source))
+                    loads++
+
+                    val elapsedMs = SystemClock.elapsedRealtime() - windowStartMs
+                    if (elapsedMs >= LOG_INTERVAL_MS) {
+                        Log.i(
+                            BENCHMARK_LOAD_FILE_TAG,
+                            "source=$source: ${elapsedMs / loads} ms/load, " +
+                                "peak RSS ${peakRssKb()} kB"
+                        )
+                        loads = 0
+                        windowStartMs = SystemClock.elapsedRealtime()
+                    }
+                }
+            }
+        }
+    }
+
+    private suspend fun load(riveWorker: RiveWorker, file: File, source: String): FileHandle =
+        when (source) {
+            SOURCE_BUFFER -> {
+                val buffer = withContext(Dispatchers.IO) {
+                    RandomAccessFile(file, "r").use {
+                        it.channel.map(FileChannel.MapMode.READ_ONLY, 0, it.length())
+                    }
+                }
+                riveWorker.loadFile(buffer)
+            }
+
+            SOURCE_FD -> ParcelFileDescriptor.open(file, ParcelFileDescriptor.MODE_READ_ONLY)
+                .use { riveWorker.loadFile(it) }
+
+            else -> riveWorker.loadFile(withContext(Dispatchers.IO) { file.readBytes() })
+        }
+
+    /** The process's peak resident set size, from `VmHWM` in `/proc/self/status`. */
+    private fun peakRssKb(): Long = File("/proc/self/status").useLines { lines ->
+        lines.first { it.startsWith("VmHWM:") }
+            .substringAfter(':')
+            .trim()
+            .substringBefore(' ')
+            .toLong()
+    }
+
+    companion object {
+        const val EXTRA_SOURCE = "source"
+        const val SOURCE_BYTES = "bytes"
+        const val SOURCE_BUFFER = "buffer"
+        const val SOURCE_FD = "fd"
+        private const val LOG_INTERVAL_MS = 1_000L
+    }
+}
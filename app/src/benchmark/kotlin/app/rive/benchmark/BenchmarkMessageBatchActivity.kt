@@ -0,0 +1,77 @@
+package app.rive.benchmark
+
+import android.os.Bundle
+import android.os.SystemClock
+import android.util.Log
+import android.view.View
+import androidx.activity.ComponentActivity
+import androidx.lifecycle.Lifecycle
+import androidx.lifecycle.lifecycleScope
+import androidx.lifecycle.repeatOnLifecycle
+import app.rive.core.RiveWorker
+import app.rive.runtime.example.R
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitAll
+import kotlinx.coroutines.coroutineScope
+import kotlinx.coroutines.isActive
+import kotlinx.coroutines.launch
+
+private const val BENCHMARK_MESSAGES_TAG = "BenchmarkMessageBatchActivity"
+
+/**
+ * Floods the command queue with small request/response messages so that polling cost is dominated
+ * by delivering messages to Kotlin. Each round issues [REQUESTS_PER_ROUND] artboard volume queries
+ * and waits for all of them, which arrive on the next poll.
+ *
+ * Launch with the boolean extra [EXTRA_BATCHED] to compare batched delivery against the default
+ * one-callback-per-message path. The benchmark measures the `Rive/PollMessages` section, and the
+ * achieved messages per second are logged for manual runs.
+ */
+class BenchmarkMessageBatchActivity : ComponentActivity() {
+    override fun onCreate(savedInstanceState: Bundle?) {
+        super.onCreate(savedInstanceState)
+        setContentView(View(this))
+
+        val batched = intent.getBooleanExtra(EXTRA_BATCHED, false)
+        val riveWorker = RiveWorker().also { worker ->
+            worker.withLifecycle(this, BENCHMARK_MESSAGES_TAG)
+            worker.setMessageBatchingEnabled(batched)
+            lifecycleScope.launch { worker.beginPolling(lifecycle) }
+        }
+
+        lifecycleScope.launch {
+            val bytes = resources.openRawResource(R.raw.basketball).use { it.readBytes() }
+            val fileHandle = riveWorker.loadFile(bytes)
+            val artboardHandle = riveWorker.createDefaultArtboardConfirmed(fileHandle)
+
+            repeatOnLifecycle(Lifecycle.State.RESUMED) {
+                var messages = 0L
+                var windowStartMs = SystemClock.elapsedRealtime()
+                while (isActive) {
+                    coroutineScope {
+                        List(REQUESTS_PER_ROUND) {
+                            async { riveWorker.getArtboardVolume(artboardHandle) }
+                        }.awaitAll()
+                    }
+                    messages += REQUESTS_PER_ROUND
+
+                    val elapsedMs = SystemClock.elapsedRealtime() - windowStartMs
+                    if (elapsedMs >= LOG_INTERVAL_MS) {
+                        Log.i(
+                            BENCHMARK_MESSAGES_TAG,
+                            "batched=$batched: ${messages * 1000 / elapsedMs} messages/s"
+                        )
+                        messages = 0
+                        windowStartMs = SystemClock.elapsedRealtime()
+                    }
+                }
+            }
+        }
+    }
+
+    companion object {
+        const val EXTRA_BATCHED = "batched"
+        private const val REQUESTS_PER_ROUND = 500
+        private const val LOG_INTERVAL_MS = 1_000L
+    }
+}
@@ -2,9 +2,13 @@ package app.rive.benchmark
 
 import androidx.benchmark.macro.BaselineProfileMode
 import androidx.benchmark.macro.CompilationMode
+import androidx.benchmark.macro.ExperimentalMetricApi
 import androidx.benchmark.macro.FrameTimingMetric
+import androidx.benchmark.macro.MemoryUsageMetric
+import androidx.benchmark.macro.Metric
 import androidx.benchmark.macro.StartupMode
 import androidx.benchmark.macro.StartupTimingMetric
+import androidx.benchmark.macro.TraceSectionMetric
 import androidx.benchmark.macro.junit4.MacrobenchmarkRule
 import androidx.test.ext.junit.runners.AndroidJUnit4
 import androidx.test.platform.app.InstrumentationRegistry
@@ -38,6 +42,63 @@ class RenderPathMacrobenchmark {
     @Test
     fun frame_hardware_canvas() = measureFrame(Path.HardwareCanvas)
 
+    /**
+     * Per-frame cost of the legacy Canvas renderer on a path-heavy file. The render section is
+     * dominated by JNI calls into android.graphics, so it tracks JNI lookup and call overhead.
+     */
+    @OptIn(ExperimentalMetricApi::class)
+    @Test
+    fun frame_canvas_renderer() = measureFrame(
+        Path.CanvasRenderer,
+        listOf(
+            FrameTimingMetric(),
+            TraceSectionMetric("Rive/Frame/Draw/Render", TraceSectionMetric.Mode.Sum),
+        )
+    )
+
+    /**
+     * Time spent delivering a steady flood of small command queue messages, one JNI callback per
+     * message. Compare with [poll_messages_batched].
+     */
+    @OptIn(ExperimentalMetricApi::class)
+    @Test
+    fun poll_messages_per_callback() = measureFrame(
+        Path.MessagesPerCallback,
+        listOf(TraceSectionMetric("Rive/PollMessages", TraceSectionMetric.Mode.Sum))
+    )
+
+    /** As [poll_messages_per_callback], with all messages packed into one buffer per poll. */
+    @OptIn(ExperimentalMetricApi::class)
+    @Test
+    fun poll_messages_batched() = measureFrame(
+        Path.MessagesBatched,
+        listOf(TraceSectionMetric("Rive/PollMessages", TraceSectionMetric.Mode.Sum))
+    )
+
+    /**
+     * Main thread time and peak memory of repeatedly loading a large file from a byte array.
+     * Compare with [load_file_buffer] and [load_file_fd].
+     */
+    @Test
+    fun load_file_bytes() = measureLoadFile(Path.LoadFileBytes)
+
+    /** As [load_file_bytes], loading from a direct mapped buffer. */
+    @Test
+    fun load_file_buffer() = measureLoadFile(Path.LoadFileBuffer)
+
+    /** As [load_file_bytes], loading from a file descriptor mapped by native code. */
+    @Test
+    fun load_file_fd() = measureLoadFile(Path.LoadFileFd)
+
+    @OptIn(ExperimentalMetricApi::class)
+    private fun measureLoadFile(path: Path) = measureFrame(
+        path,
+        listOf(
+            TraceSectionMetric("Rive/LoadFile/Submit", TraceSectionMetric.Mode.Sum),
+            MemoryUsageMetric(MemoryUsageMetric.Mode.Max),
+        )
+    )
+
     private fun measureStartup(path: Path) {
         benchmarkRule.measureRepeated(
             packageName = TARGET_PACKAGE,
@@ -53,10 +114,13 @@ class RenderPathMacrobenchmark {
         }
     }
 
-    private fun measureFrame(path: Path) {
+    private fun measureFrame(
+        path: Path,
+        metrics: List<Metric> = listOf(FrameTimingMetric())
+    ) {
         benchmarkRule.measureRepeated(
             packageName = TARGET_PACKAGE,
-            metrics = listOf(FrameTimingMetric()),
+            metrics = metrics,
             compilationMode = speedProfileCompilationMode,
             iterations = 12,
             startupMode = StartupMode.WARM,
@@ -78,9 +142,21 @@ class RenderPathMacrobenchmark {
         device.waitForIdle()
     }
 
-    private enum class Path(val activityClassName: String) {
+    private enum class Path(val activityClassName: String, val extras: String = "") {
         Compose("app.rive.benchmark.BenchmarkComposeActivity"),
-        HardwareCanvas("app.rive.benchmark.BenchmarkHardwareBitmapCanvasActivity");
+        HardwareCanvas("app.rive.benchmark.BenchmarkHardwareBitmapCanvasActivity"),
+        CanvasRenderer("app.rive.benchmark.BenchmarkCanvasRendererActivity"),
+        MessagesPerCallback(
+            "app.rive.benchmark.BenchmarkMessageBatchActivity",
+            " --ez batched false"
+        ),
+        MessagesBatched(
+            "app.rive.benchmark.BenchmarkMessageBatchActivity",
+            " --ez batched true"
+        ),
+        LoadFileBytes("app.rive.benchmark.BenchmarkLoadFileActivity", " --es source bytes"),
+        LoadFileBuffer("app.rive.benchmark.BenchmarkLoadFileActivity", " --es source buffer"),
+        LoadFileFd("app.rive.benchmark.BenchmarkLoadFileActivity", " --es source fd");
 
         fun launchCommand(): String = buildString {
             append("am start -W")
@@ -91,6 +167,7 @@ class RenderPathMacrobenchmark {
             append(TARGET_PACKAGE)
             append("/")
             append(activityClassName)
+            append(extras)
         }
     }
 
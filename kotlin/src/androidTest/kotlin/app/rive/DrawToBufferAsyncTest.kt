@@ -0,0 +1,233 @@
+package app.rive
+
+import android.graphics.Color
+import android.os.SystemClock
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import app.rive.runtime.kotlin.core.TestUtils
+import app.rive.runtime.kotlin.test.R
+import kotlinx.coroutines.runBlocking
+import org.junit.runner.RunWith
+import java.nio.ByteBuffer
+import java.util.concurrent.CountDownLatch
+import java.util.concurrent.TimeUnit
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+import kotlin.time.Duration.Companion.milliseconds
+
+/**
+ * Checks that asynchronous readbacks, into byte arrays or a reused direct buffer, match synchronous
+ * ones and complete in order, and compares the throughput of many small readbacks each way.
+ */
+@RunWith(AndroidJUnit4::class)
+class DrawToBufferAsyncTest : RiveAndroidTest() {
+    private companion object {
+        const val TAG = "DrawToBufferAsync"
+        const val SIZE = 64
+        const val READBACKS = 200
+    }
+
+    @Test
+    fun drawToBufferAsync_matchesDrawToBuffer() = runBlocking {
+        val res = loadDefaultRiveResources(R.raw.off_road_car_blog)
+        res.stateMachine.advance(0.milliseconds)
+        riveWorker.createImageSurface(SIZE, SIZE).use { surface ->
+            val expected = ByteArray(SIZE * SIZE * 4)
+            riveWorker.drawToBuffer(
+                res.artboard.artboardHandle,
+                res.stateMachine.stateMachineHandle,
+                surface,
+                expected,
+                SIZE,
+                SIZE,
+                clearColor = Color.BLUE
+            )
+
+            val actual = ByteArray(SIZE * SIZE * 4)
+            val done = CountDownLatch(1)
+            var error: RiveDrawToBufferException? = null
+            riveWorker.drawToBufferAsync(
+                res.artboard.artboardHandle,
+                res.stateMachine.stateMachineHandle,
+                surface,
+                actual,
+                SIZE,
+                SIZE,
+                clearColor = Color.BLUE
+            ) {
+                error = it
+                done.countDown()
+            }
+
+            assertTrue(done.await(5, TimeUnit.SECONDS))
+            assertNull(error)
+            assertContentEquals(expected, actual)
+        }
+    }
+
+    @Test
+    fun drawToBufferAsync_directBuffer_matchesDrawToBuffer() = runBlocking {
+        val res = loadDefaultRiveResources(R.raw.off_road_car_blog)
+        res.stateMachine.advance(0.milliseconds)
+        riveWorker.createImageSurface(SIZE, SIZE).use { surface ->
+            val expected = ByteArray(SIZE * SIZE * 4)
+            riveWorker.drawToBuffer(
+                res.artboard.artboardHandle,
+                res.stateMachine.stateMachineHandle,
+                surface,
+                expected,
+                SIZE,
+                SIZE,
+                clearColor = Color.BLUE
+            )
+
+            // Reused across requests, as for continuous capture.
+            val buffer = ByteBuffer.allocateDirect(SIZE * SIZE * 4)
+            repeat(2) {
+                val done = CountDownLatch(1)
+                var error: RiveDrawToBufferException? = null
+                riveWorker.drawToBufferAsync(
+                    res.artboard.artboardHandle,
+                    res.stateMachine.stateMachineHandle,
+                    surface,
+                    buffer,
+                    SIZE,
+                    SIZE,
+                    clearColor = Color.BLUE
+                ) {
+                    error = it
+                    done.countDown()
+                }
+
+                assertTrue(done.await(5, TimeUnit.SECONDS))
+                assertNull(error)
+                val actual = ByteArray(SIZE * SIZE * 4)
+                buffer.duplicate().get(actual)
+                assertContentEquals(expected, actual)
+                assertEquals(0, buffer.position())
+            }
+        }
+    }
+
+    @Test
+    fun drawToBufferAsync_heapBuffer_throws() = runBlocking<Unit> {
+        val res = loadDefaultRiveResources(R.raw.empty)
+        riveWorker.createImageSurface(SIZE, SIZE).use { surface ->
+            assertFailsWith<RiveDrawToBufferException> {
+                riveWorker.drawToBufferAsync(
+                    res.artboard.artboardHandle,
+                    res.stateMachine.stateMachineHandle,
+                    surface,
+                    ByteBuffer.allocate(SIZE * SIZE * 4),
+                    SIZE,
+                    SIZE
+                ) {}
+            }
+        }
+    }
+
+    @Test
+    fun drawToBufferAsync_completesInOrder() = runBlocking {
+        val res = loadDefaultRiveResources(R.raw.off_road_car_blog)
+        riveWorker.createImageSurface(SIZE, SIZE).use { surface ->
+            val completed = mutableListOf<Int>()
+            val done = CountDownLatch(READBACKS)
+            repeat(READBACKS) { i ->
+                riveWorker.drawToBufferAsync(
+                    res.artboard.artboardHandle,
+                    res.stateMachine.stateMachineHandle,
+                    surface,
+                    ByteArray(SIZE * SIZE * 4),
+                    SIZE,
+                    SIZE
+                ) { error ->
+                    // Assertions would be caught on the command server thread, so record instead.
+                    if (error == null) {
+                        synchronized(completed) { completed.add(i) }
+                    }
+                    done.countDown()
+                }
+            }
+
+            assertTrue(done.await(30, TimeUnit.SECONDS))
+            assertEquals((0 until READBACKS).toList(), completed)
+        }
+    }
+
+    @Test
+    fun drawToBufferAsync_smallBuffer_throws() = runBlocking<Unit> {
+        val res = loadDefaultRiveResources(R.raw.empty)
+        riveWorker.createImageSurface(SIZE, SIZE).use { surface ->
+            assertFailsWith<RiveDrawToBufferException> {
+                riveWorker.drawToBufferAsync(
+                    res.artboard.artboardHandle,
+                    res.stateMachine.stateMachineHandle,
+                    surface,
+                    ByteArray(4),
+                    SIZE,
+                    SIZE
+                ) {}
+            }
+        }
+    }
+
+    @Test
+    fun throughput() = runBlocking<Unit> {
+        val res = loadDefaultRiveResources(R.raw.off_road_car_blog)
+        riveWorker.createImageSurface(SIZE, SIZE).use { surface ->
+            val buffers = List(READBACKS) { ByteArray(SIZE * SIZE * 4) }
+
+            fun sync(): Long {
+                val start = SystemClock.elapsedRealtimeNanos()
+                buffers.forEach { buffer ->
+                    riveWorker.drawToBuffer(
+                        res.artboard.artboardHandle,
+                        res.stateMachine.stateMachineHandle,
+                        surface,
+                        buffer,
+                        SIZE,
+                        SIZE
+                    )
+                }
+                return SystemClock.elapsedRealtimeNanos() - start
+            }
+
+            fun async(): Long {
+                val done = CountDownLatch(buffers.size)
+                var failures = 0
+                val start = SystemClock.elapsedRealtimeNanos()
+                buffers.forEach { buffer ->
+                    riveWorker.drawToBufferAsync(
+                        res.artboard.artboardHandle,
+                        res.stateMachine.stateMachineHandle,
+                        surface,
+                        buffer,
+                        SIZE,
+                        SIZE
+                    ) { error ->
+                        // Callbacks run in order on the command server thread.
+                        if (error != null) failures++
+                        done.countDown()
+                    }
+                }
+                assertTrue(done.await(30, TimeUnit.SECONDS))
+                val nanos = SystemClock.elapsedRealtimeNanos() - start
+                assertEquals(0, failures)
+                return nanos
+            }
+
+            TestUtils.logTimingComparison(
+                TAG,
+                baseline = { sync() },
+                candidate = { async() }
+            ) { syncNanos, asyncNanos ->
+                "$READBACKS readbacks of ${SIZE}x$SIZE: " +
+                    "drawToBuffer ${syncNanos / READBACKS / 1000} us each, " +
+                    "drawToBufferAsync ${asyncNanos / READBACKS / 1000} us each"
+            }
+        }
+    }
+}
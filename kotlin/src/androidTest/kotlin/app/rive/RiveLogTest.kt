@@ -0,0 +1,61 @@
+package app.rive
+
+import android.util.Log
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import app.rive.runtime.kotlin.core.NativeRiveLogTestHelper
+import org.junit.After
+import org.junit.runner.RunWith
+import java.util.concurrent.CountDownLatch
+import java.util.concurrent.TimeUnit
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertTrue
+
+@RunWith(AndroidJUnit4::class)
+class RiveLogTest : RiveAndroidTest() {
+    private companion object {
+        const val TAG = "RiveLogTest"
+    }
+
+    private val originalLogger = RiveLog.logger
+    private val originalLevel = RiveLog.nativeLevel
+
+    @After
+    fun restoreLogging() {
+        RiveLog.logger = originalLogger
+        RiveLog.nativeLevel = originalLevel
+    }
+
+    /** Verifies that native messages below the native level never reach the logger. */
+    @Test
+    fun nativeMessages_belowNativeLevel_areDiscarded() {
+        val received = mutableListOf<String>()
+        val lastDelivered = CountDownLatch(1)
+        RiveLog.logger = object : RiveLog.Logger {
+            override fun v(tag: String, msg: () -> String) = record(tag, "V", msg)
+            override fun d(tag: String, msg: () -> String) = record(tag, "D", msg)
+            override fun i(tag: String, msg: () -> String) = record(tag, "I", msg)
+            override fun w(tag: String, msg: () -> String) = record(tag, "W", msg)
+            override fun e(tag: String, t: Throwable?, msg: () -> String) {
+                record(tag, "E", msg)
+                if (tag == TAG) lastDelivered.countDown()
+            }
+
+            fun record(tag: String, level: String, msg: () -> String) {
+                // Other native code may be logging too.
+                if (tag == TAG) synchronized(received) { received.add("$level ${msg()}") }
+            }
+        }
+        RiveLog.nativeLevel = RiveLog.Level.WARN
+
+        NativeRiveLogTestHelper.cppLog(Log.VERBOSE, TAG, "verbose")
+        NativeRiveLogTestHelper.cppLog(Log.DEBUG, TAG, "debug")
+        NativeRiveLogTestHelper.cppLog(Log.INFO, TAG, "info")
+        NativeRiveLogTestHelper.cppLog(Log.WARN, TAG, "warn")
+        NativeRiveLogTestHelper.cppLog(Log.ERROR, TAG, "error")
+
+        // Messages are delivered in order, so the last one arriving means the others have too.
+        assertTrue(lastDelivered.await(5, TimeUnit.SECONDS))
+        assertEquals(listOf("W warn", "E error"), synchronized(received) { received.toList() })
+    }
+}
@@ -0,0 +1,112 @@
+package app.rive.core
+
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import app.rive.RiveAndroidTest
+import app.rive.runtime.kotlin.core.TestUtils
+import app.rive.runtime.kotlin.test.R
+import kotlinx.coroutines.runBlocking
+import org.junit.runner.RunWith
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertTrue
+import kotlin.time.Duration.Companion.milliseconds
+
+/**
+ * Scaling benchmark for [CommandQueue.advanceStateMachines], advancing many independent artboards,
+ * as in a feed or grid, serially and across the command server's advance pool.
+ *
+ * Artboard counts are scaled against the device's core count. The serial and parallel batches are
+ * advanced by the same frames, so afterwards each pair of artboards must draw identically.
+ */
+@RunWith(AndroidJUnit4::class)
+class AdvanceStateMachinesBenchmarkTest : RiveAndroidTest() {
+    private companion object {
+        const val TAG = "AdvanceBenchmark"
+        const val FRAMES = 120
+        const val DRAW_SIZE = 64
+        val FRAME_TIME = 16.milliseconds
+    }
+
+    private val cores = Runtime.getRuntime().availableProcessors()
+
+    @Test
+    fun artboards_perCore() = compare(artboardCount = cores)
+
+    @Test
+    fun artboards_fourPerCore() = compare(artboardCount = cores * 4)
+
+    @Test
+    fun artboards_sixteenPerCore() = compare(artboardCount = cores * 16)
+
+    /** Artboards and their state machines, advanced together. */
+    private class Scenes(count: Int) {
+        val batch = AdvanceBatch(count)
+        val handles = mutableListOf<Pair<ArtboardHandle, StateMachineHandle>>()
+    }
+
+    private fun compare(artboardCount: Int) = runBlocking {
+        val commandQueue = CommandQueue()
+        try {
+            commandQueue.withPolling {
+                val bytes = context.resources.openRawResource(R.raw.flux_capacitor)
+                    .use { it.readBytes() }
+                val fileHandle = loadFile(bytes)
+                val serial = createScenes(fileHandle, artboardCount)
+                val parallel = createScenes(fileHandle, artboardCount)
+
+                TestUtils.logTimingComparison(
+                    TAG,
+                    baseline = { advanceFrames(fileHandle, serial.batch, parallel = false) },
+                    candidate = { advanceFrames(fileHandle, parallel.batch, parallel = true) }
+                ) { serialNs, parallelNs ->
+                    "$artboardCount artboards on $cores cores: " +
+                        "${serialNs / FRAMES / 1_000} us -> ${parallelNs / FRAMES / 1_000} us " +
+                        "per frame (${"%.2f".format(serialNs.toDouble() / parallelNs)}x)"
+                }
+
+                createImageSurface(DRAW_SIZE, DRAW_SIZE).use { surface ->
+                    serial.handles.zip(parallel.handles).forEach { (expected, actual) ->
+                        assertContentEquals(draw(surface, expected), draw(surface, actual))
+                    }
+                }
+            }
+        } finally {
+            commandQueue.release("AdvanceStateMachinesBenchmarkTest", "Benchmark finished")
+        }
+    }
+
+    private suspend fun CommandQueue.createScenes(fileHandle: FileHandle, count: Int): Scenes {
+        val scenes = Scenes(count)
+        repeat(count) {
+            val artboardHandle = createDefaultArtboardConfirmed(fileHandle)
+            val stateMachineHandle = createDefaultStateMachineConfirmed(artboardHandle)
+            scenes.batch.add(artboardHandle, stateMachineHandle)
+            scenes.handles.add(artboardHandle to stateMachineHandle)
+        }
+        return scenes
+    }
+
+    private fun CommandQueue.draw(
+        surface: RiveSurface,
+        scene: Pair<ArtboardHandle, StateMachineHandle>
+    ): ByteArray {
+        val pixels = ByteArray(DRAW_SIZE * DRAW_SIZE * 4)
+        drawToBuffer(scene.first, scene.second, surface, pixels, DRAW_SIZE, DRAW_SIZE)
+        return pixels
+    }
+
+    /** Advances [batch] for [FRAMES] frames, returning the elapsed nanoseconds. */
+    private suspend fun CommandQueue.advanceFrames(
+        fileHandle: FileHandle,
+        batch: AdvanceBatch,
+        parallel: Boolean
+    ): Long {
+        val start = System.nanoTime()
+        repeat(FRAMES) {
+            advanceStateMachines(batch, FRAME_TIME, parallel)
+        }
+        // Commands run in order, so a round trip waits for every advance.
+        assertTrue(getArtboardNames(fileHandle).isNotEmpty())
+        return System.nanoTime() - start
+    }
+}
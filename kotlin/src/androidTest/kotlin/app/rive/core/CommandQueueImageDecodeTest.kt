@@ -0,0 +1,33 @@
+package app.rive.core
+
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import app.rive.RiveAndroidTest
+import app.rive.RiveImageException
+import app.rive.runtime.kotlin.test.R
+import kotlinx.coroutines.runBlocking
+import org.junit.runner.RunWith
+import kotlin.test.Test
+import kotlin.test.assertFailsWith
+
+@RunWith(AndroidJUnit4::class)
+class CommandQueueImageDecodeTest : RiveAndroidTest() {
+    @Test
+    fun decodeImage_deletedBeforeBackgroundDecodeFinishes() = runBlocking {
+        val bytes = context.resources.openRawResource(R.raw.eve).use { it.readBytes() }
+
+        // PNG pixels decode on the decode pool after the handle is returned, so deleting right
+        // away races the upload, which must be safe in either order.
+        repeat(20) {
+            riveWorker.deleteImage(riveWorker.decodeImage(bytes))
+        }
+    }
+
+    @Test
+    fun decodeImage_unrecognizedFormat_stillReportsFailure() = runBlocking {
+        // Without a recognized header the image is decoded in place, so failures still surface.
+        assertFailsWith<RiveImageException> {
+            riveWorker.decodeImage(byteArrayOf(0, 1, 2))
+        }
+        Unit
+    }
+}
@@ -22,6 +22,7 @@ import java.util.concurrent.CountDownLatch
 import java.util.concurrent.TimeUnit
 import java.util.concurrent.atomic.AtomicBoolean
 import kotlin.test.Test
+import kotlin.test.assertEquals
 import kotlin.test.assertFailsWith
 import kotlin.test.assertFalse
 import kotlin.test.assertNotNull
@@ -148,6 +149,62 @@ class RiveSurfaceLifecycleTest : RiveAndroidTest() {
         }
     }
 
+    @Test
+    fun pipelinedDraw_lastFrameIsPresentedByPolling() = runBlocking {
+        val res = loadDefaultRiveResources(R.raw.empty)
+        val closeableSurface = LatchingImageReaderSurface()
+        val surface = riveWorker.createRiveSurface(closeableSurface)
+
+        // With no further draw to present it, the shared worker's polling presents the frame.
+        riveWorker.draw(
+            res.artboard.artboardHandle,
+            res.stateMachine.stateMachineHandle,
+            surface,
+            Fit.Contain(),
+            Color.TRANSPARENT,
+            pipelined = true
+        )
+
+        assertTrue(
+            closeableSurface.awaitFrameAvailable(),
+            "Expected the pipelined frame to be presented once drawing stopped"
+        )
+        val stats = surface.framePipelineStats
+        assertEquals(1L, stats.pipelinedFrames)
+        assertEquals(1L, stats.deferredPresents)
+        assertEquals(0L, stats.directFrames)
+        surface.close()
+        assertClosed(closeableSurface)
+    }
+
+    @Test
+    fun unchangedScene_drawIsSkippedUntilTouched() = runBlocking {
+        val res = loadDefaultRiveResources(R.raw.empty)
+        val surface = riveWorker.createImageSurface(64, 64)
+        // Draws are coalesced per surface, so wait for each with a round trip.
+        suspend fun drawAndWait() {
+            riveWorker.draw(
+                res.artboard.artboardHandle,
+                res.stateMachine.stateMachineHandle,
+                surface,
+                Fit.Contain(),
+                Color.TRANSPARENT
+            )
+            riveWorker.getArtboardNames(res.file.fileHandle)
+        }
+
+        drawAndWait()
+        drawAndWait()
+        assertEquals(1L, surface.framePipelineStats.directFrames)
+        assertEquals(1L, surface.framePipelineStats.skippedFrames)
+
+        riveWorker.resizeArtboard(res.artboard.artboardHandle, surface)
+        drawAndWait()
+        assertEquals(2L, surface.framePipelineStats.directFrames)
+        assertEquals(1L, surface.framePipelineStats.skippedFrames)
+        surface.close()
+    }
+
     @Test
     fun draw_afterSurfaceClose_throwsBeforeEnqueue() {
         val surface = riveWorker.createImageSurface(64, 64)
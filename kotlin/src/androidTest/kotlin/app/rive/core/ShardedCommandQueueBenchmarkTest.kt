@@ -0,0 +1,97 @@
+package app.rive.core
+
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import app.rive.Artboard
+import app.rive.RiveAndroidTest
+import app.rive.RiveFile
+import app.rive.RiveFileSource
+import app.rive.StateMachine
+import app.rive.runtime.kotlin.core.TestUtils
+import app.rive.runtime.kotlin.test.R
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitAll
+import kotlinx.coroutines.coroutineScope
+import kotlinx.coroutines.runBlocking
+import org.junit.runner.RunWith
+import kotlin.test.Test
+import kotlin.test.assertTrue
+import kotlin.time.Duration.Companion.milliseconds
+
+/**
+ * Throughput benchmark for [ShardedCommandQueue], advancing many concurrently loaded files on one
+ * command server thread and spread across the default number of shards.
+ *
+ * Each run checks that the files are balanced across the shards. Each frame waits for a command
+ * server round trip on every shard, so that all of its advances have completed.
+ */
+@RunWith(AndroidJUnit4::class)
+class ShardedCommandQueueBenchmarkTest : RiveAndroidTest() {
+    private companion object {
+        const val TAG = "ShardedCQBenchmark"
+        const val FRAMES = 120
+        val FRAME_TIME = 16.milliseconds
+    }
+
+    @Test
+    fun eight_files() = compare(fileCount = 8)
+
+    @Test
+    fun thirtyTwo_files() = compare(fileCount = 32)
+
+    private fun compare(fileCount: Int) {
+        val shardCount = ShardedCommandQueue.defaultShardCount()
+        TestUtils.logTimingComparison(
+            TAG,
+            baseline = { measure(fileCount, shardCount = 1) },
+            candidate = { measure(fileCount, shardCount) }
+        ) { singleNs, shardedNs ->
+            "$fileCount files: 1 shard ${singleNs / FRAMES / 1_000} us -> " +
+                "$shardCount shards ${shardedNs / FRAMES / 1_000} us per frame " +
+                "(${"%.2f".format(singleNs.toDouble() / shardedNs)}x)"
+        }
+    }
+
+    /** Loads [fileCount] files and advances them for [FRAMES] frames, returning elapsed ns. */
+    private fun measure(fileCount: Int, shardCount: Int): Long = runBlocking {
+        val sharded = ShardedCommandQueue(shardCount)
+        val pollers = sharded.shards.map { CommandQueuePoller(it) }
+        val files = mutableListOf<RiveFile>()
+        val artboards = mutableListOf<Artboard>()
+        val stateMachines = mutableListOf<StateMachine>()
+        try {
+            repeat(fileCount) {
+                val file = sharded.loadFile(
+                    RiveFileSource.RawRes(R.raw.flux_capacitor, context.resources)
+                )
+                files.add(file)
+                val artboard = Artboard.create(file).also { artboards.add(it) }
+                stateMachines.add(StateMachine.create(artboard))
+            }
+            // Each file and its scene hold the same references, so the shards take turns.
+            val filesPerShard = sharded.shards.map { shard ->
+                files.count { it.riveWorker === shard }
+            }
+            assertTrue(filesPerShard.max() - filesPerShard.min() <= 1, "$filesPerShard")
+
+            val start = System.nanoTime()
+            repeat(FRAMES) {
+                stateMachines.forEach { it.advance(FRAME_TIME) }
+                roundTrip(sharded, files)
+            }
+            System.nanoTime() - start
+        } finally {
+            (stateMachines + artboards + files).forEach { it.close() }
+            sharded.close()
+            pollers.forEach { it.close() }
+        }
+    }
+
+    /** Waits for a query on every shard, which runs after the shard's earlier advances. */
+    private suspend fun roundTrip(sharded: ShardedCommandQueue, files: List<RiveFile>) =
+        coroutineScope {
+            sharded.shards.mapNotNull { shard ->
+                val file = files.firstOrNull { it.riveWorker === shard } ?: return@mapNotNull null
+                async { shard.getArtboardNames(file.fileHandle) }
+            }.awaitAll().forEach { assertTrue(it.isNotEmpty()) }
+        }
+}
@@ -0,0 +1,60 @@
+package app.rive.runtime.kotlin.core
+
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+
+/**
+ * Frame pacing decisions against a simulated clock, so each run is deterministic. Stats are in the
+ * order of [app.rive.runtime.kotlin.renderers.FramePacingStats].
+ */
+@RunWith(AndroidJUnit4::class)
+class FramePacerTest {
+    private companion object {
+        const val TICK_NANOS = 16_666_667L
+        const val TICKS = 600
+        const val SCHEDULED = 0
+        const val COALESCED = 1
+        const val DROPPED = 2
+        const val LATE = 3
+        const val DIVISOR = 6
+    }
+
+    @Before
+    fun init() {
+        TestUtils() // Load library.
+    }
+
+    @Test
+    fun cheapFrames_scheduleEveryTick() {
+        val stats = NativeFramePacerTestHelper.cppSimulate(TICK_NANOS, 5_000_000L, TICKS)
+
+        assertEquals(TICKS.toLong(), stats[SCHEDULED])
+        assertEquals(0L, stats[COALESCED])
+        assertEquals(0L, stats[DROPPED])
+        assertEquals(0L, stats[LATE])
+        assertEquals(1L, stats[DIVISOR])
+    }
+
+    @Test
+    fun framesLongerThanATick_halveTheRate() {
+        val stats = NativeFramePacerTestHelper.cppSimulate(TICK_NANOS, 25_000_000L, TICKS)
+
+        assertEquals(2L, stats[DIVISOR])
+        assertEquals(TICKS.toLong(), stats[SCHEDULED] + stats[COALESCED] + stats[DROPPED])
+        assertTrue("Expected about half the ticks coalesced", stats[COALESCED] >= TICKS / 2 - 5)
+        // Only frames before the pacer has measured the cost should be late.
+        assertTrue("Expected few late frames, got ${stats[LATE]}", stats[LATE] <= 3)
+    }
+
+    @Test
+    fun stalledWorker_dropsOnceFull() {
+        val stats = NativeFramePacerTestHelper.cppSimulate(TICK_NANOS, 0L, 100)
+
+        assertEquals(2L, stats[SCHEDULED])
+        assertEquals(98L, stats[DROPPED])
+    }
+}
@@ -0,0 +1,100 @@
+package app.rive.runtime.kotlin.core
+
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import app.rive.core.FrameTimingStats
+import org.junit.Assert.assertArrayEquals
+import org.junit.Assert.assertEquals
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+
+/** Percentiles and copy-out of the per-frame stats ring. */
+@RunWith(AndroidJUnit4::class)
+class FrameStatsTest {
+    private companion object {
+        const val FIELDS = FrameTimingStats.RECORD_FIELDS
+    }
+
+    @Before
+    fun init() {
+        TestUtils() // Load library.
+    }
+
+    /** Frames 1 to [count], where frame i advances in i ns, draws in 2i, and waits 7. */
+    private fun records(count: Int) = LongArray(count * FIELDS).also {
+        for (i in 0 until count) {
+            it[i * FIELDS + FrameTimingStats.FIELD_ADVANCE] = i + 1L
+            it[i * FIELDS + FrameTimingStats.FIELD_DRAW] = 2 * (i + 1L)
+            it[i * FIELDS + FrameTimingStats.FIELD_QUEUE_WAIT] = 7L
+        }
+    }
+
+    private fun summarize(records: LongArray) =
+        FrameTimingStats.fromArray(NativeFrameStatsTestHelper.cppSummarize(records))
+
+    @Test
+    fun noFrames_summarizesToZero() {
+        val stats = summarize(LongArray(0))
+
+        assertEquals(0L, stats.frames)
+        assertEquals(0, stats.windowFrames)
+        assertEquals(0L, stats.total.maxNanos)
+    }
+
+    @Test
+    fun percentiles_useNearestRank() {
+        val stats = summarize(records(100))
+
+        assertEquals(100L, stats.frames)
+        assertEquals(100, stats.windowFrames)
+        assertEquals(50L, stats.advance.p50Nanos)
+        assertEquals(90L, stats.advance.p90Nanos)
+        assertEquals(99L, stats.advance.p99Nanos)
+        assertEquals(100L, stats.advance.maxNanos)
+        assertEquals(198L, stats.draw.p99Nanos)
+        assertEquals(0L, stats.flush.maxNanos)
+        assertEquals(7L, stats.queueWait.p50Nanos)
+        // Queue wait is not part of the render thread's time.
+        assertEquals(300L, stats.total.maxNanos)
+    }
+
+    @Test
+    fun fullRing_coversOnlyTheNewestFrames() {
+        val count = FrameTimingStats.MAX_RECORDS + 44
+        val stats = summarize(records(count))
+
+        assertEquals(count.toLong(), stats.frames)
+        assertEquals(FrameTimingStats.MAX_RECORDS, stats.windowFrames)
+        // Frames 45 to 300 remain, so the median is the 128th of those.
+        assertEquals(172L, stats.advance.p50Nanos)
+        assertEquals(count.toLong(), stats.advance.maxNanos)
+    }
+
+    @Test
+    fun meanAndStdDev_coverTheLastCompleteBatch() {
+        // Totals are 3i, and the last complete batch of 60 is frames 61 to 120.
+        val stats = summarize(records(130))
+
+        assertEquals(271L, stats.meanTotalNanos)
+        assertEquals(52L, stats.stdDevTotalNanos)
+    }
+
+    @Test
+    fun copyRecords_returnsTheNewestThatFit_oldestFirst() {
+        val out = LongArray(3 * FIELDS)
+        val copied = NativeFrameStatsTestHelper.cppCopyRecords(records(10), out)
+
+        assertEquals(3, copied)
+        assertArrayEquals(records(10).copyOfRange(7 * FIELDS, 10 * FIELDS), out)
+    }
+
+    @Test
+    fun copyRecords_leavesTheRestOfALargerArray() {
+        val out = LongArray(10 * FIELDS) { -1L }
+        val copied = NativeFrameStatsTestHelper.cppCopyRecords(records(2), out)
+
+        assertEquals(2, copied)
+        assertArrayEquals(records(2), out.copyOfRange(0, 2 * FIELDS))
+        assertEquals(-1L, out[2 * FIELDS])
+    }
+}
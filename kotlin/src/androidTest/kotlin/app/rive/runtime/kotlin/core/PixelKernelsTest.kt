@@ -0,0 +1,60 @@
+package app.rive.runtime.kotlin.core
+
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import org.junit.Assert.assertEquals
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+
+/**
+ * The NEON and SSE2 pixel kernels used for image ingestion against their scalar references. On
+ * ABIs without either, the kernels are the references, and parity holds trivially.
+ */
+@RunWith(AndroidJUnit4::class)
+class PixelKernelsTest {
+    private companion object {
+        const val TAG = "PixelKernelsBenchmark"
+        val KERNELS = listOf(
+            "premultiply RGBA",
+            "ARGB to premultiplied RGBA",
+            "premultiplied RGBA to ARGB",
+            "unpremultiply ARGB",
+        )
+
+        // A 2048 x 2048 image.
+        const val BENCHMARK_PIXELS = 2048 * 2048
+        const val BENCHMARK_ITERATIONS = 5
+    }
+
+    @Before
+    fun init() {
+        TestUtils() // Load library.
+    }
+
+    @Test
+    fun kernels_matchScalarExactly() {
+        assertEquals(0, NativePixelKernelsTestHelper.cppCountMismatches())
+    }
+
+    @Test
+    fun benchmark() {
+        fun time(vector: Boolean) = checkNotNull(
+            NativePixelKernelsTestHelper.cppTimeKernels(
+                BENCHMARK_PIXELS,
+                BENCHMARK_ITERATIONS,
+                vector
+            )
+        )
+
+        TestUtils.logTimingComparison(
+            TAG,
+            baseline = { time(vector = false) },
+            candidate = { time(vector = true) }
+        ) { scalar, vector ->
+            KERNELS.indices.joinToString("; ", "$BENCHMARK_PIXELS pixels: ") { i ->
+                "${KERNELS[i]} ${scalar[i] / BENCHMARK_ITERATIONS / 1000} us -> " +
+                    "${vector[i] / BENCHMARK_ITERATIONS / 1000} us"
+            }
+        }
+    }
+}
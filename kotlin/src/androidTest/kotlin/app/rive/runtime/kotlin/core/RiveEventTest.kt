@@ -84,4 +84,47 @@ class RiveEventTest {
             assertEquals(2, observer.events.size)
         }
     }
+
+    @Test
+    fun read_reported_events_matches_events_reported() {
+        val file = File(appContext.resources.openRawResource(R.raw.events_test).readBytes())
+        val stateMachine = file.firstArtboard.stateMachine("State Machine 1")
+        val events = ReportedEvents()
+        (stateMachine.input("FireBothEvents") as SMITrigger).fire()
+        stateMachine.advance(0.016f)
+
+        val expected = stateMachine.eventsReported
+        assertEquals(2, expected.size)
+        assertEquals(expected.size, stateMachine.readReportedEvents(events))
+        expected.forEachIndexed { index, event ->
+            assertEquals(event.name, events.name(index))
+            assertEquals(event.type, events.type(index))
+            assertEquals(event.delay, events.delay(index))
+            if (event is RiveOpenURLEvent) {
+                assertEquals(event.url, events.url(index))
+                assertEquals(event.target, events.target(index))
+            }
+            val properties = hashMapOf<String, Any>()
+            for (property in 0 until events.propertyCount(index)) {
+                properties[events.propertyName(index, property)] =
+                    when (events.propertyType(index, property)) {
+                        ReportedEvents.PropertyType.Boolean ->
+                            events.booleanProperty(index, property)
+
+                        ReportedEvents.PropertyType.Number ->
+                            events.numberProperty(index, property)
+
+                        ReportedEvents.PropertyType.String ->
+                            events.stringProperty(index, property)
+                    }
+            }
+            assertEquals(event.properties, properties)
+        }
+
+        // Reading again after an advance that reports nothing reuses the buffer.
+        stateMachine.advance(0.016f)
+        assertEquals(0, stateMachine.readReportedEvents(events))
+        assertEquals(0, events.size)
+        events.release()
+    }
 }
@@ -1,7 +1,9 @@
 package app.rive.runtime.kotlin.core
 
+import android.os.ParcelFileDescriptor
 import androidx.test.ext.junit.runners.AndroidJUnit4
 import app.rive.runtime.kotlin.core.errors.MalformedFileException
+import app.rive.runtime.kotlin.core.errors.RiveException
 import app.rive.runtime.kotlin.core.errors.UnsupportedRuntimeVersionException
 import app.rive.runtime.kotlin.test.R
 import org.junit.Assert.assertEquals
@@ -40,6 +42,36 @@ class RiveFileLoadTest {
         file.release()
     }
 
+    @Test
+    fun loadFromFileDescriptorRegion() {
+        // Place the file after an unaligned prefix so the import maps from an offset.
+        val prefix = ByteArray(4099) { 0x7f }
+        val bytes = appContext.resources.openRawResource(R.raw.off_road_car_blog).readBytes()
+        val cached = java.io.File(appContext.cacheDir, "load_from_fd.bin")
+        cached.writeBytes(prefix + bytes)
+
+        ParcelFileDescriptor.open(cached, ParcelFileDescriptor.MODE_READ_ONLY).use {
+            val file = File(it, offset = prefix.size.toLong(), length = bytes.size.toLong())
+            assertEquals(5, file.firstArtboard.animationCount)
+            file.release()
+        }
+        cached.delete()
+    }
+
+    @Test(expected = RiveException::class)
+    fun loadFromFileDescriptorPastEnd() {
+        val cached = java.io.File(appContext.cacheDir, "load_from_fd_short.bin")
+        cached.writeBytes(ByteArray(16))
+
+        try {
+            ParcelFileDescriptor.open(cached, ParcelFileDescriptor.MODE_READ_ONLY).use {
+                File(it, offset = 8L, length = 16L)
+            }
+        } finally {
+            cached.delete()
+        }
+    }
+
     @Test
     fun loadFileWithRendererType() {
         val file =
@@ -2,6 +2,7 @@ package app.rive.runtime.kotlin.core
 
 import android.content.Context
 import android.graphics.RectF
+import android.util.Log
 import androidx.lifecycle.Lifecycle
 import androidx.lifecycle.LifecycleObserver
 import androidx.lifecycle.LifecycleOwner
@@ -31,6 +32,27 @@ class TestUtils {
     }
 
     companion object {
+        /**
+         * Runs [baseline] and [candidate] once each to warm up, then again to measure, and logs
+         * [describe]'s summary of the measured results under [tag]. Benchmarks log rather than
+         * assert timings, since they depend on the device; [baseline] and [candidate] should
+         * assert their own correctness.
+         *
+         * @return The measured baseline and candidate results.
+         */
+        inline fun <T> logTimingComparison(
+            tag: String,
+            baseline: () -> T,
+            candidate: () -> T,
+            describe: (baseline: T, candidate: T) -> String,
+        ): Pair<T, T> {
+            baseline()
+            candidate()
+            val measured = baseline() to candidate()
+            Log.i(tag, describe(measured.first, measured.second))
+            return measured
+        }
+
         /**
          * Verifies that [access] cannot run while another thread owns [lock].
          *
@@ -265,6 +287,11 @@ object NativeFontTestHelper {
     external fun cppCleanupFallbacks()
 }
 
+object NativeRiveLogTestHelper {
+    /** Logs [message] under [tag] from native code, at the Android log [priority]. */
+    external fun cppLog(priority: Int, tag: String, message: String)
+}
+
 object NativeStringTestHelper {
     /** Creates a Java string from a native UTF-8 literal containing an emoji. */
     external fun cppMakeEmojiString(): String
@@ -275,3 +302,75 @@ object NativeStringTestHelper {
     /** Converts a Java string to native standard UTF-8 and back to a Java string. */
     external fun cppRoundTripString(value: String): String
 }
+
+object NativeWorkQueueTestHelper {
+    /**
+     * Pushes [tasksPerProducer] tasks from each of [producers] threads into a work queue drained by
+     * one consumer thread, using the worker thread's lock-free queue if [lockFree] is true or a
+     * mutex and condition variable queue otherwise.
+     *
+     * @return Elapsed ns, mean and max enqueue ns, context switches of the whole process, tasks
+     *    run, and tasks run out of their producer's order.
+     */
+    external fun cppRunContentionBenchmark(
+        producers: Int,
+        tasksPerProducer: Int,
+        lockFree: Boolean
+    ): LongArray
+}
+
+object NativeFramePacerTestHelper {
+    /**
+     * Runs a renderer's frame pacer against a simulated clock, with display frames every
+     * [tickIntervalNanos] and a worker that draws scheduled frames one at a time, each taking
+     * [frameCostNanos], or never finishing if it is 0.
+     *
+     * @return The pacer's stats after [ticks] display frames, in the order of
+     *    [app.rive.runtime.kotlin.renderers.FramePacingStats].
+     */
+    external fun cppSimulate(tickIntervalNanos: Long, frameCostNanos: Long, ticks: Int): LongArray
+}
+
+object NativeThreadTestHelper {
+    /**
+     * Reads the sysfs CPU tree at [sysfsRoot] and picks the cores that render threads are pinned
+     * to.
+     */
+    external fun cppSelectPerformanceCpus(sysfsRoot: String): IntArray
+}
+
+object NativeFrameStatsTestHelper {
+    /**
+     * Adds [records], [app.rive.core.FrameTimingStats.RECORD_FIELDS] values each, to new frame
+     * stats.
+     *
+     * @return The stats' summary, as [app.rive.core.FrameTimingStats.fromArray] reads it.
+     */
+    external fun cppSummarize(records: LongArray): LongArray
+
+    /**
+     * Adds [records] to new frame stats as [cppSummarize] does, then copies them back into [out].
+     *
+     * @return The number of records copied.
+     */
+    external fun cppCopyRecords(records: LongArray, out: LongArray): Int
+}
+
+object NativePixelKernelsTestHelper {
+    /**
+     * Runs each image ingestion pixel kernel and its scalar reference over every (channel, alpha)
+     * pair and some random pixels, misaligned and in place.
+     *
+     * @return The number of runs whose output differed from the scalar reference.
+     */
+    external fun cppCountMismatches(): Int
+
+    /**
+     * Times each pixel kernel, or its scalar reference unless [vector], over [pixelCount] random
+     * pixels, [iterations] times.
+     *
+     * @return Total nanoseconds for premultiplying RGBA, ARGB to premultiplied RGBA, premultiplied
+     *    RGBA to ARGB, and unpremultiplying ARGB.
+     */
+    external fun cppTimeKernels(pixelCount: Int, iterations: Int, vector: Boolean): LongArray
+}
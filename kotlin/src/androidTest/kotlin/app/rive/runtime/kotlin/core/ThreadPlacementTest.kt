@@ -0,0 +1,108 @@
+package app.rive.runtime.kotlin.core
+
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import androidx.test.platform.app.InstrumentationRegistry
+import org.junit.After
+import org.junit.Assert.assertArrayEquals
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+import java.io.File
+
+/** Picking performance cores from fake sysfs CPU trees, laid out as `/sys/devices/system/cpu`. */
+@RunWith(AndroidJUnit4::class)
+class ThreadPlacementTest {
+    private lateinit var root: File
+
+    @Before
+    fun init() {
+        TestUtils() // Load library.
+        val context = InstrumentationRegistry.getInstrumentation().targetContext
+        root = File(context.cacheDir, "fake_sysfs_cpu").apply {
+            deleteRecursively()
+            mkdirs()
+        }
+    }
+
+    @After
+    fun cleanup() {
+        root.deleteRecursively()
+    }
+
+    @Test
+    fun bigLittle_picksBigCores() {
+        writeTree(online = "0-7", capacities = listOf(160, 160, 160, 160, 1024, 1024, 1024, 1024))
+
+        assertArrayEquals(intArrayOf(4, 5, 6, 7), select())
+    }
+
+    @Test
+    fun triCluster_skipsOnlyLittleCores() {
+        writeTree(online = "0-7", capacities = listOf(160, 160, 160, 160, 512, 512, 512, 1024))
+
+        assertArrayEquals(intArrayOf(4, 5, 6, 7), select())
+    }
+
+    @Test
+    fun offlineCores_areSkipped() {
+        writeTree(online = "0-3,6-7", capacities = listOf(160, 160, 160, 160, 0, 0, 1024, 1024))
+
+        assertArrayEquals(intArrayOf(6, 7), select())
+    }
+
+    @Test
+    fun missingCapacity_fallsBackToMaxFrequency() {
+        writeTree(
+            online = "0-3",
+            capacities = listOf(0, 0, 0, 0),
+            maxFrequencies = listOf(1_800_000, 1_800_000, 2_800_000, 2_800_000)
+        )
+
+        assertArrayEquals(intArrayOf(2, 3), select())
+    }
+
+    @Test
+    fun missingCapacityAndFrequency_skipsUnknownAndLittleCores() {
+        writeTree(
+            online = "0-3",
+            capacities = listOf(0, 0, 0, 0),
+            maxFrequencies = listOf(0, 1_800_000, 2_800_000, 2_800_000)
+        )
+
+        assertArrayEquals(intArrayOf(2, 3), select())
+    }
+
+    @Test
+    fun homogeneousCores_picksAll() {
+        writeTree(online = "0-3", capacities = listOf(1024, 1024, 1024, 1024))
+
+        assertArrayEquals(intArrayOf(0, 1, 2, 3), select())
+    }
+
+    @Test
+    fun unreadableTree_picksNone() {
+        assertArrayEquals(intArrayOf(), select())
+    }
+
+    private fun select() = NativeThreadTestHelper.cppSelectPerformanceCpus(root.absolutePath)
+
+    /** Writes a tree with the given online list and, for each core, capacity and frequency. */
+    private fun writeTree(
+        online: String,
+        capacities: List<Int>,
+        maxFrequencies: List<Int> = capacities.map { 0 }
+    ) {
+        File(root, "online").writeText("$online\n")
+        capacities.forEachIndexed { cpu, capacity ->
+            val cpuDir = File(root, "cpu$cpu")
+            if (capacity > 0) {
+                cpuDir.mkdirs()
+                File(cpuDir, "cpu_capacity").writeText("$capacity\n")
+            }
+            if (maxFrequencies[cpu] > 0) {
+                File(cpuDir, "cpufreq").mkdirs()
+                File(cpuDir, "cpufreq/cpuinfo_max_freq").writeText("${maxFrequencies[cpu]}\n")
+            }
+        }
+    }
+}
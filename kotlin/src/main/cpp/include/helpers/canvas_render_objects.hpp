@@ -162,8 +162,7 @@ public:
                                           ktBitmap,
                                           clampEnum,
                                           clampEnum);
-        env->DeleteLocalRef(tileModeClass);
-        env->DeleteLocalRef(bitmapShaderClass);
+        env->DeleteLocalRef(clampEnum);
         return ktShader;
     }
 };
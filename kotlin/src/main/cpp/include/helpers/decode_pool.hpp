@@ -0,0 +1,52 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace rive_android
+{
+/**
+ * A small pool of threads for CPU-bound asset decoding, so that decoding does
+ * not block the thread that submits it.
+ *
+ * Unlike WorkStealingPool, tasks are independent and submitted one at a time.
+ * Pool threads are attached to the JVM, so tasks may call into Kotlin, but
+ * have no GL context.
+ *
+ * Tasks still queued when the pool is destroyed are dropped without running;
+ * the destructor waits for running tasks to return.
+ */
+class DecodePool
+{
+public:
+    using Task = std::function<void()>;
+
+    /**
+     * @param threadCount The number of pool threads.
+     * @param name The prefix for the pool threads' names.
+     */
+    DecodePool(size_t threadCount, const char* name);
+    ~DecodePool();
+
+    DecodePool(const DecodePool&) = delete;
+    DecodePool& operator=(const DecodePool&) = delete;
+
+    /** Queues task to run on a pool thread. May be called from any thread. */
+    void run(Task task);
+
+private:
+    void threadMain(std::string name);
+
+    std::mutex m_mutex;
+    std::condition_variable m_taskQueued;
+    std::deque<Task> m_tasks;
+    bool m_isStopping = false;
+    std::vector<std::thread> m_threads;
+};
+} // namespace rive_android
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace rive_android
+{
+/**
+ * Decides whether a draw would repeat the last frame its draw key presented,
+ * so that the command server can skip it.
+ *
+ * A scene changes when its state machine advances without being settled, on
+ * the advance that settles it, and on any command that can change what an
+ * artboard draws without an advance reporting it: view model property sets,
+ * pointer events, artboard resizes, and asset changes. Those commands are not
+ * tied to one artboard, so they touch every scene. The next advance of each
+ * state machine then counts as a change even if it reports settled, since
+ * that advance is what applies them.
+ *
+ * Only accessed from the command server thread.
+ */
+class DrawDirtyTracker
+{
+public:
+    /** Everything besides the scene that determines a draw's pixels. */
+    struct DrawInputs
+    {
+        uint64_t artboard;
+        uint64_t stateMachine;
+        const void* surface;
+        uint64_t targetGeneration;
+        uint8_t fit;
+        float alignmentX;
+        float alignmentY;
+        float scaleFactor;
+        uint32_t clearColor;
+
+        bool operator==(const DrawInputs& other) const;
+        bool operator!=(const DrawInputs& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    /** Marks every scene changed. */
+    void touchAll() { m_epoch++; }
+
+    /**
+     * Records an advance of stateMachine.
+     *
+     * @param changed The result of advanceAndApply, false once settled.
+     */
+    void advanced(uint64_t stateMachine, bool changed);
+
+    /** Forgets a deleted state machine. */
+    void removeStateMachine(uint64_t stateMachine);
+
+    /** Whether drawing inputs under drawKey would differ from its last frame. */
+    bool isDirty(uint64_t drawKey, const DrawInputs& inputs) const;
+
+    /** Records that drawKey presented inputs in the scene's current state. */
+    void drawn(uint64_t drawKey, const DrawInputs& inputs);
+
+    /** Forgets a draw key, so that its next draw is never skipped. */
+    void removeDrawKey(uint64_t drawKey) { m_drawn.erase(drawKey); }
+
+private:
+    struct StateMachineState
+    {
+        uint64_t generation = 0;
+        uint64_t epoch = 0;
+        bool settled = false;
+    };
+
+    struct DrawnFrame
+    {
+        DrawInputs inputs;
+        uint64_t generation;
+        uint64_t epoch;
+    };
+
+    uint64_t generationOf(uint64_t stateMachine) const;
+
+    // Starts at 1 so that a state machine's first advance always counts as a
+    // change.
+    uint64_t m_epoch = 1;
+    std::unordered_map<uint64_t, StateMachineState> m_stateMachines;
+    std::unordered_map<uint64_t, DrawnFrame> m_drawn;
+};
+} // namespace rive_android
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <thread>
+
+namespace rive_android
+{
+/**
+ * Parks threads until another thread changes some lock-free state they are
+ * waiting on, without a mutex. Waiting threads sleep on a futex, and notifying
+ * costs a fence and a load when nobody is waiting.
+ *
+ * Waiters must re-check their condition after prepareWait():
+ *
+ *     while (!condition())
+ *     {
+ *         auto key = events.prepareWait();
+ *         if (condition())
+ *         {
+ *             events.cancelWait();
+ *             break;
+ *         }
+ *         events.wait(key);
+ *     }
+ *
+ * which await() implements. Notifiers change the state first and then call
+ * notifyOne() or notifyAll().
+ */
+class EventCount
+{
+public:
+    using Key = uint32_t;
+
+    Key prepareWait()
+    {
+        m_waiters.fetch_add(1, std::memory_order_seq_cst);
+        return m_epoch.load(std::memory_order_seq_cst);
+    }
+
+    void cancelWait() { m_waiters.fetch_sub(1, std::memory_order_seq_cst); }
+
+    /** Sleeps until a notification after key was taken. May wake spuriously. */
+    void wait(Key key);
+
+    /** Wakes one waiter. Only use when every waiter waits on the same state. */
+    void notifyOne() { notify(1); }
+    void notifyAll() { notify(INT_MAX); }
+
+    /**
+     * Returns once condition() is true, spinning and yielding briefly before
+     * parking so that short waits do not cost a futex round trip.
+     */
+    template <typename Condition> void await(Condition&& condition)
+    {
+        for (int i = 0; i < kSpinCount; i++)
+        {
+            if (condition())
+            {
+                return;
+            }
+        }
+        // Then give the notifying thread a chance to run before parking,
+        // which matters most when both share a core.
+        for (int i = 0; i < kYieldCount; i++)
+        {
+            std::this_thread::yield();
+            if (condition())
+            {
+                return;
+            }
+        }
+        while (!condition())
+        {
+            const Key key = prepareWait();
+            if (condition())
+            {
+                cancelWait();
+                return;
+            }
+            wait(key);
+        }
+    }
+
+private:
+    static constexpr int kSpinCount = 64;
+    static constexpr int kYieldCount = 4;
+
+    void notify(int count)
+    {
+        // Orders the caller's state change before reading m_waiters. Pairs
+        // with the read-modify-write in prepareWait().
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiters.load(std::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+        m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        wake(count);
+    }
+
+    void wake(int count);
+
+    std::atomic<uint32_t> m_epoch{0};
+    std::atomic<uint32_t> m_waiters{0};
+};
+} // namespace rive_android
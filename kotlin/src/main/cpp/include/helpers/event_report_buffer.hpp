@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rive
+{
+class Event;
+class StateMachineInstance;
+} // namespace rive
+
+namespace rive_android
+{
+/**
+ * A reusable buffer holding every event a state machine reported in its last
+ * advance, so that Kotlin can read them without allocating an object, a map,
+ * and boxed values per event.
+ *
+ * The buffer starts with a 4 byte event count followed by a 4 byte offset to
+ * each event's record. Each record is, in native byte order and without
+ * padding:
+ * - The event's core type as 2 bytes and its delay in seconds as 4 bytes.
+ * - The name as a string.
+ * - The open URL target as 1 byte and the URL as a string. Both are zero for
+ *   other event types.
+ * - A 4 byte count of named custom properties, each written as a one byte
+ *   PropertyTag, its name as a string, and its value: 1 byte for booleans, 4
+ *   bytes for numbers, and a string for strings.
+ *
+ * Strings are a 4 byte length followed by that many UTF-8 bytes. The Kotlin
+ * decoder in ReportedEvents.kt must be kept in sync with this layout.
+ */
+class EventReportBuffer
+{
+public:
+    // Values must match ReportedEvents.PROPERTY_* in ReportedEvents.kt.
+    enum class PropertyTag : uint8_t
+    {
+        boolean = 0,
+        number = 1,
+        string = 2,
+    };
+
+    /**
+     * Replaces the buffer's contents with the events stateMachine reported in
+     * its last advance. The storage is kept between calls and only grows.
+     */
+    void write(const rive::StateMachineInstance* stateMachine);
+
+    /** The backing store. Only the first size() bytes are valid. */
+    uint8_t* data() { return m_bytes.data(); }
+    size_t size() const { return m_size; }
+    /**
+     * The size of the backing store. It only changes, together with data(),
+     * when a write() needs more room than the previous capacity.
+     */
+    size_t capacity() const { return m_bytes.size(); }
+
+private:
+    void writeEvent(const rive::Event* event, float delay);
+
+    uint8_t* reserve(size_t length);
+    template <typename T> void put(const T& value);
+    void putString(const std::string& value);
+
+    std::vector<uint8_t> m_bytes;
+    size_t m_size = 0;
+};
+} // namespace rive_android
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace rive_android
+{
+/**
+ * Decides, on each display tick, whether a renderer should schedule a frame.
+ *
+ * The worker reports how long each frame took, and the pacer keeps a smoothed
+ * estimate of the cost and of its variation, as TCP does for round trip times.
+ * Their sum predicts the next frame's cost. When that won't fit in one tick
+ * interval, the pacer lowers the target rate to every second, third, or fourth
+ * tick, and returns to a higher rate once frames comfortably fit again. Ticks
+ * skipped this way are coalesced: no frame runs for them, and the next frame
+ * advances by the whole elapsed time instead.
+ *
+ * Independently, a tick is dropped when the worker already has the maximum
+ * number of frames queued or running.
+ *
+ * onTick() must only be called from one thread (the main thread), and
+ * onFrameFinished() from one thread (the worker thread). The clock is
+ * injectable so that pacing can be tested deterministically.
+ */
+class FramePacer
+{
+public:
+    using Clock = std::function<std::chrono::steady_clock::time_point()>;
+    using TimePoint = std::chrono::steady_clock::time_point;
+    using Duration = std::chrono::nanoseconds;
+
+    static constexpr uint8_t kMaxFramesInFlight = 2;
+    static constexpr uint32_t kMaxTickDivisor = 4;
+
+    enum class Decision
+    {
+        // Schedule a frame for this tick.
+        Schedule,
+        // Skip this tick to hold a lower target rate; the next frame advances
+        // by its time.
+        Coalesce,
+        // Skip this tick because the worker is already full.
+        Drop,
+    };
+
+    struct Tick
+    {
+        Decision decision;
+        // When a scheduled frame should have finished by: the tick at which
+        // the next frame would be scheduled.
+        TimePoint presentDeadline;
+    };
+
+    struct Stats
+    {
+        uint64_t scheduledFrames = 0;
+        uint64_t coalescedFrames = 0;
+        uint64_t droppedFrames = 0;
+        // Frames that finished after their present deadline.
+        uint64_t lateFrames = 0;
+        Duration predictedFrameCost{0};
+        Duration tickInterval{0};
+        // The target rate is one frame every this many ticks.
+        uint32_t tickDivisor = 1;
+    };
+
+    /** @param clock The time source, or null for std::chrono::steady_clock. */
+    explicit FramePacer(Clock clock = nullptr);
+
+    TimePoint now() const { return m_clock(); }
+
+    /**
+     * Called on each display tick, returning whether to schedule a frame.
+     *
+     * @param framesInFlight Frames scheduled that have not yet finished or
+     *   been dropped by the worker.
+     */
+    Tick onTick(uint8_t framesInFlight);
+
+    /**
+     * Called on the worker when a scheduled frame finishes, at the time now()
+     * returns.
+     *
+     * @param started When the frame started running.
+     * @param presentDeadline The deadline onTick() gave the frame.
+     */
+    void onFrameFinished(TimePoint started, TimePoint presentDeadline);
+
+    /** A snapshot of the stats. May be called from any thread. */
+    Stats stats() const;
+
+private:
+    // Assumed until ticks have been measured.
+    static constexpr Duration kDefaultTickInterval{16'666'667};
+    // Gaps longer than this are pauses, not tick intervals.
+    static constexpr Duration kMaxTickInterval{100'000'000};
+    // Return to a faster rate only once the predicted cost fits it with this
+    // much to spare, so the rate doesn't flip between two neighbours.
+    static constexpr float kSpeedUpHeadroom = 0.8f;
+
+    Clock m_clock;
+
+    // Only accessed by onTick().
+    TimePoint m_lastTick{};
+    // Starts full so that the first tick schedules a frame.
+    uint32_t m_ticksSinceFrame = kMaxTickDivisor;
+
+    // Written by onTick().
+    std::atomic<int64_t> m_tickIntervalNanos{kDefaultTickInterval.count()};
+    std::atomic<uint32_t> m_tickDivisor{1};
+    std::atomic<uint64_t> m_scheduledFrames{0};
+    std::atomic<uint64_t> m_coalescedFrames{0};
+    std::atomic<uint64_t> m_droppedFrames{0};
+
+    // Written by onFrameFinished(). The predicted cost is read by onTick().
+    int64_t m_smoothedCostNanos = 0;
+    int64_t m_costDeviationNanos = 0;
+    bool m_hasCostSample = false;
+    std::atomic<int64_t> m_predictedCostNanos{0};
+    std::atomic<uint64_t> m_lateFrames{0};
+};
+} // namespace rive_android
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <jni.h>
+#include <mutex>
+
+#include "helpers/rendering_stats.hpp"
+
+namespace rive_android
+{
+/**
+ * How long each stage of one frame took, in nanoseconds.
+ *
+ * The stages are the ones traced as Rive/Frame/...: advancing the scene,
+ * beginning and recording the draw, flushing it to the GPU, and presenting or
+ * swapping. Queue wait is the time between the frame being requested and its
+ * work starting on the render thread.
+ */
+struct FrameRecord
+{
+    int64_t advanceNanos = 0;
+    int64_t drawNanos = 0;
+    int64_t flushNanos = 0;
+    int64_t presentNanos = 0;
+    int64_t queueWaitNanos = 0;
+
+    /** The render thread's time in the frame, excluding queue wait. */
+    int64_t totalNanos() const
+    {
+        return advanceNanos + drawNanos + flushNanos + presentNanos;
+    }
+
+    static int64_t Nanos(std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+            .count();
+    }
+};
+
+/**
+ * A fixed-size ring of the most recent frame records, with percentiles over
+ * them.
+ *
+ * Records are added on the render thread and read from any thread. Both take
+ * a mutex that is only ever held for a copy of at most the whole ring, so the
+ * render thread never waits long on a reader.
+ */
+class FrameStats
+{
+public:
+    static constexpr size_t kCapacity = 256;
+    // The fields of a FrameRecord, in declaration order.
+    static constexpr size_t kRecordFields = 5;
+    // Percentile rows: one for each field, then one for the total.
+    static constexpr size_t kSummaryRows = kRecordFields + 1;
+    // p50, p90, p99, and max.
+    static constexpr size_t kPercentileCount = 4;
+
+    struct Summary
+    {
+        // Frames recorded since creation.
+        uint64_t frames = 0;
+        // Frames in the ring, which the percentiles cover.
+        uint32_t windowFrames = 0;
+        std::array<std::array<int64_t, kPercentileCount>, kSummaryRows>
+            percentiles{};
+        // Over the last complete batch of kTotalTimeSamples frames.
+        int64_t meanTotalNanos = 0;
+        int64_t stdDevTotalNanos = 0;
+    };
+
+    void add(const FrameRecord& record);
+
+    /** Percentiles over the frames in the ring. */
+    Summary summary() const;
+
+    /**
+     * Copies the most recent records, oldest first, as kRecordFields values
+     * each in FrameRecord's field order.
+     *
+     * @param out Room for maxRecords records.
+     * @return The number of records copied.
+     */
+    size_t copyRecords(int64_t* out, size_t maxRecords) const;
+
+private:
+    // About one second at 60Hz.
+    static constexpr size_t kTotalTimeSamples = 60;
+
+    mutable std::mutex m_mutex;
+    std::array<FrameRecord, kCapacity> m_records{};
+    // Where the next record goes.
+    size_t m_next = 0;
+    uint64_t m_frames = 0;
+    RenderingStats m_totalTimes{kTotalTimeSamples};
+};
+
+/**
+ * The summary as a Java long array: frames, window frames, the percentile rows
+ * in order, then the mean and standard deviation of the total.
+ */
+jlongArray FrameStatsSummaryToJava(JNIEnv*, const FrameStats&);
+
+/**
+ * Copies the most recent records that fit into a Java long array, as
+ * FrameStats::copyRecords() does.
+ *
+ * @return The number of records copied.
+ */
+jint CopyFrameRecordsToJava(JNIEnv*, const FrameStats&, jlongArray);
+} // namespace rive_android
@@ -39,7 +39,7 @@ extern JavaVM* g_JVM;
 extern long g_sdkVersion;
 void SetSDKVersion();
 void LogReferenceTables();
-jlong Import(uint8_t*,
+jlong Import(const uint8_t*,
              jint,
              RendererType = RendererType::Rive,
              rive::FileAssetLoader* = nullptr);
@@ -3,8 +3,10 @@
 #include <android/bitmap.h>
 #include <cstdint>
 #include <jni.h>
+#include <memory>
 #include <vector>
 
+#include "helpers/pixel_kernels.hpp"
 #include "models/render_context.hpp"
 #include "rive/refcnt.hpp"
 #include "rive/renderer.hpp"
@@ -30,6 +32,31 @@ rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
     bool isPremultiplied,
     RenderContext* context = nullptr);
 
+/**
+ * Decodes with Android BitmapFactory through JNI into RGBA bytes, premultiplied
+ * unless isPremultiplied says the source already is.
+ *
+ * Unlike renderImageFromAndroidDecode, this creates no render image, so it may
+ * be called from any thread attached to the JVM.
+ *
+ * @return The pixels, or null if decoding failed, in which case width and
+ *   height are left unset.
+ */
+std::unique_ptr<uint8_t[]> decodeToRGBA(rive::Span<const uint8_t> encodedBytes,
+                                        bool isPremultiplied,
+                                        uint32_t* width,
+                                        uint32_t* height);
+
+/**
+ * Reads an encoded image's dimensions from its header without decoding it.
+ * Recognizes PNG, JPEG, WebP, and GIF.
+ *
+ * @return Whether the format was recognized with nonzero dimensions.
+ */
+bool readEncodedImageSize(rive::Span<const uint8_t> encodedBytes,
+                          uint32_t* width,
+                          uint32_t* height);
+
 /** Rive (GL) path: From RGBA bytes -> AndroidImage */
 rive::rcp<rive::RenderImage> renderImageFromRGBABytesRive(
     uint32_t width,
@@ -66,10 +93,6 @@ rive::rcp<rive::RenderImage> renderImageFromBitmapRive(jobject jBitmap,
 /** Canvas path: Android Bitmap -> wrap -> CanvasRenderImage */
 rive::rcp<rive::RenderImage> renderImageFromBitmapCanvas(jobject jBitmap);
 
-/** Premultiply/unpremultiply helpers for a given channel */
-uint32_t premultiply(uint8_t c, uint8_t a);
-uint32_t unpremultiply(uint8_t c, uint8_t a);
-
 /** Lock an Android Bitmap to access its buffer and ensure it's RGBA_8888
  * format. */
 bool lockBitmapRGBA8888(JNIEnv* env,
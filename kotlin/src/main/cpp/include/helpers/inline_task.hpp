@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rive_android
+{
+// With the ops pointer, the default makes a task 48 bytes, so that a task and
+// a 64-bit sequence number fit a 64 byte cache line. Storage is only pointer
+// aligned to keep tasks this small; over-aligned callables go to the heap.
+template <typename Signature, size_t InlineSize = 40> class InlineTask;
+
+/**
+ * A move-only callable, like std::function, that stores small callables
+ * inline instead of on the heap.
+ *
+ * Callables up to InlineSize bytes with a non-throwing move constructor, which
+ * covers lambdas capturing a few pointers or rcps, are stored in the task
+ * itself. Larger callables fall back to a heap allocation. Unlike
+ * std::function, move-only callables are accepted.
+ *
+ * A default constructed or moved-from task is empty and converts to false.
+ */
+template <typename R, typename... Args, size_t InlineSize>
+class InlineTask<R(Args...), InlineSize>
+{
+public:
+    InlineTask() = default;
+    InlineTask(std::nullptr_t) {}
+
+    template <typename F,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::decay_t<F>, InlineTask> &&
+                  std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+    InlineTask(F&& callable)
+    {
+        using Callable = std::decay_t<F>;
+        if constexpr (FitsInline<Callable>)
+        {
+            new (m_storage) Callable(std::forward<F>(callable));
+            m_ops = &InlineOps<Callable>::kOps;
+        }
+        else
+        {
+            *reinterpret_cast<Callable**>(m_storage) =
+                new Callable(std::forward<F>(callable));
+            m_ops = &HeapOps<Callable>::kOps;
+        }
+    }
+
+    InlineTask(InlineTask&& other) noexcept { moveFrom(other); }
+
+    InlineTask& operator=(InlineTask&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineTask(const InlineTask&) = delete;
+    InlineTask& operator=(const InlineTask&) = delete;
+
+    ~InlineTask() { reset(); }
+
+    explicit operator bool() const { return m_ops != nullptr; }
+
+    R operator()(Args... args)
+    {
+        return m_ops->invoke(m_storage, std::forward<Args>(args)...);
+    }
+
+    /** Destroys the callable, leaving the task empty. */
+    void reset()
+    {
+        if (m_ops != nullptr)
+        {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+private:
+    struct Ops
+    {
+        R (*invoke)(void* storage, Args&&... args);
+        // Move constructs into to and destroys from.
+        void (*relocate)(void* from, void* to);
+        void (*destroy)(void* storage);
+    };
+
+    template <typename F>
+    static constexpr bool FitsInline =
+        sizeof(F) <= InlineSize && alignof(F) <= alignof(void*) &&
+        std::is_nothrow_move_constructible_v<F>;
+
+    template <typename F> struct InlineOps
+    {
+        static R invoke(void* storage, Args&&... args)
+        {
+            return std::invoke(*static_cast<F*>(storage),
+                               std::forward<Args>(args)...);
+        }
+        static void relocate(void* from, void* to)
+        {
+            new (to) F(std::move(*static_cast<F*>(from)));
+            static_cast<F*>(from)->~F();
+        }
+        static void destroy(void* storage) { static_cast<F*>(storage)->~F(); }
+        static constexpr Ops kOps = {&invoke, &relocate, &destroy};
+    };
+
+    template <typename F> struct HeapOps
+    {
+        static R invoke(void* storage, Args&&... args)
+        {
+            return std::invoke(**static_cast<F**>(storage),
+                               std::forward<Args>(args)...);
+        }
+        static void relocate(void* from, void* to)
+        {
+            *static_cast<F**>(to) = *static_cast<F**>(from);
+        }
+        static void destroy(void* storage)
+        {
+            delete *static_cast<F**>(storage);
+        }
+        static constexpr Ops kOps = {&invoke, &relocate, &destroy};
+    };
+
+    void moveFrom(InlineTask& other)
+    {
+        if (other.m_ops != nullptr)
+        {
+            other.m_ops->relocate(other.m_storage, m_storage);
+            m_ops = other.m_ops;
+            other.m_ops = nullptr;
+        }
+    }
+
+    alignas(void*) unsigned char m_storage[InlineSize];
+    const Ops* m_ops = nullptr;
+};
+} // namespace rive_android
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <sys/types.h>
+
+namespace rive_android
+{
+/**
+ * A read-only memory mapping of a region of a file descriptor, unmapped when
+ * this object is destroyed.
+ *
+ * Lets a .riv file be read in place from the page cache instead of first being
+ * read into a Java byte array. The region does not need to be page aligned.
+ */
+class MappedFile
+{
+public:
+    /**
+     * Maps [offset, offset + length) of fd. Check valid() for success; failures
+     * are logged.
+     *
+     * @param fd File descriptor open for reading. The mapping stays valid if it
+     * is closed afterwards.
+     * @param offset Byte offset of the region within the file.
+     * @param length Length of the region in bytes. Must be positive.
+     */
+    MappedFile(int fd, off_t offset, size_t length);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool valid() const { return m_mapping != nullptr; }
+    /** The first byte of the region, or nullptr if mapping failed. */
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    void* m_mapping = nullptr;
+    size_t m_mappedLength = 0;
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+};
+} // namespace rive_android
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace rive_android
+{
+/**
+ * Packs command queue messages into a caller-owned buffer, typically the
+ * backing store of a direct ByteBuffer, so that many messages can be handed to
+ * Kotlin in a single upcall.
+ *
+ * Each record is a one byte tag followed by its fields in order, in native
+ * byte order and without padding:
+ * - Integers and floats as sizeof(T) bytes, e.g. request IDs and handles as 8
+ *   bytes, jint and float as 4 bytes.
+ * - Booleans as 1 byte (0 or 1).
+ * - Strings as a 4 byte length followed by that many UTF-8 bytes.
+ *
+ * A record is either written in full or not at all. The Kotlin decoder in
+ * MessageBatchDecoder.kt must be kept in sync with this layout.
+ */
+class MessageBatch
+{
+public:
+    /**
+     * Sets the buffer that records are written into, discarding any records
+     * already written. Passing nullptr disables batching.
+     */
+    void setBuffer(uint8_t* data, size_t capacity)
+    {
+        m_data = data;
+        m_capacity = data == nullptr ? 0 : capacity;
+        m_size = 0;
+    }
+
+    bool enabled() const { return m_data != nullptr; }
+    bool empty() const { return m_size == 0; }
+    size_t size() const { return m_size; }
+
+    /** Discard written records, typically after they have been delivered. */
+    void clear() { m_size = 0; }
+
+    /**
+     * Appends a record if batching is enabled, all fields are packable, and
+     * the record fits in the remaining space.
+     *
+     * @return true if the record was written
+     */
+    template <typename... Fields>
+    bool tryAppend(uint8_t tag, const Fields&... fields)
+    {
+        if constexpr (!(IsPackable<Fields>::value && ...))
+        {
+            return false;
+        }
+        else
+        {
+            if (m_data == nullptr)
+            {
+                return false;
+            }
+            const size_t recordSize = 1 + (packedSize(fields) + ... + 0);
+            if (recordSize > m_capacity - m_size)
+            {
+                return false;
+            }
+            uint8_t* out = m_data + m_size;
+            *out++ = tag;
+            (write(out, fields), ...);
+            m_size += recordSize;
+            return true;
+        }
+    }
+
+private:
+    template <typename T>
+    struct IsPackable
+        : std::integral_constant<bool,
+                                 std::is_arithmetic<T>::value ||
+                                     std::is_same<T, std::string>::value>
+    {};
+
+    template <typename T> static size_t packedSize(const T&)
+    {
+        return std::is_same<T, bool>::value ? 1 : sizeof(T);
+    }
+
+    static size_t packedSize(const std::string& value)
+    {
+        return sizeof(int32_t) + value.size();
+    }
+
+    template <typename T> static void write(uint8_t*& out, const T& value)
+    {
+        if constexpr (std::is_same<T, bool>::value)
+        {
+            *out++ = value ? 1 : 0;
+        }
+        else
+        {
+            std::memcpy(out, &value, sizeof(T));
+            out += sizeof(T);
+        }
+    }
+
+    static void write(uint8_t*& out, const std::string& value)
+    {
+        const auto length = static_cast<int32_t>(value.size());
+        std::memcpy(out, &length, sizeof(length));
+        out += sizeof(length);
+        std::memcpy(out, value.data(), value.size());
+        out += value.size();
+    }
+
+    uint8_t* m_data = nullptr;
+    size_t m_capacity = 0;
+    size_t m_size = 0;
+};
+} // namespace rive_android
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rive_android
+{
+/**
+ * Premultiplies one channel by alpha, rounding to nearest: c * a / 255.
+ */
+uint32_t premultiply(uint8_t c, uint8_t a);
+
+/**
+ * Unpremultiplies one channel, rounding to nearest and clamping to 255:
+ * c * 255 / a, or 0 when a is 0.
+ */
+uint32_t unpremultiply(uint8_t c, uint8_t a);
+
+/*
+ * Pixel conversions for image ingestion.
+ *
+ * RGBA means bytes in R, G, B, A order. ARGB means uint32_t values with alpha
+ * in the top byte, as Android's Bitmap and Color use; in memory, on the
+ * little-endian ABIs Android supports, these are bytes in B, G, R, A order.
+ *
+ * Each function uses NEON on arm64 and SSE2 on x86, processing 16 or 4 pixels
+ * at a time, and the scalar functions in rive_android::scalar for the rest.
+ * The results are identical to the scalar functions for every input. Source
+ * and destination may be the same buffer, but may not otherwise overlap.
+ */
+
+/** RGBA to premultiplied RGBA. */
+void premultiplyRGBA(const uint8_t* src, uint8_t* dst, size_t pixelCount);
+
+/** ARGB to RGBA, premultiplying if premultiplyAlpha. */
+void argbToRGBA(const uint32_t* src,
+                uint8_t* dst,
+                size_t pixelCount,
+                bool premultiplyAlpha);
+
+/** RGBA to ARGB, unpremultiplying if unpremultiplyAlpha. */
+void rgbaToARGB(const uint8_t* src,
+                uint32_t* dst,
+                size_t pixelCount,
+                bool unpremultiplyAlpha);
+
+/** Premultiplied ARGB to unpremultiplied ARGB. */
+void unpremultiplyARGB(const uint32_t* src, uint32_t* dst, size_t pixelCount);
+
+/**
+ * Copies rows of rowBytes each between buffers with different strides, such
+ * as out of a locked Bitmap whose rows are padded.
+ */
+void copyRows(const uint8_t* src,
+              size_t srcStride,
+              uint8_t* dst,
+              size_t dstStride,
+              size_t rowBytes,
+              size_t rows);
+
+/** One pixel at a time reference versions, for the tails and for tests. */
+namespace scalar
+{
+void premultiplyRGBA(const uint8_t* src, uint8_t* dst, size_t pixelCount);
+void argbToRGBA(const uint32_t* src,
+                uint8_t* dst,
+                size_t pixelCount,
+                bool premultiplyAlpha);
+void rgbaToARGB(const uint8_t* src,
+                uint32_t* dst,
+                size_t pixelCount,
+                bool unpremultiplyAlpha);
+void unpremultiplyARGB(const uint32_t* src, uint32_t* dst, size_t pixelCount);
+} // namespace scalar
+} // namespace rive_android
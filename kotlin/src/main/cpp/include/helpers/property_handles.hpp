@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include "rive/command_queue.hpp"
+#include "rive/command_server.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_runtime.hpp"
+
+namespace rive_android
+{
+/** The property accessor a handle was last resolved with. */
+enum class PropertyKind : uint8_t
+{
+    none,
+    number,
+    string,
+    boolean,
+    enumeration,
+    color,
+    trigger,
+};
+
+/**
+ * View model properties addressed by a numeric handle rather than a path.
+ *
+ * Each handle names a (view model instance, path) pair. The path is resolved
+ * against the instance on first use and the resulting property runtime is
+ * cached, so repeated sets skip both the JNI string conversion and the path
+ * lookup. The runtimes are owned by their view model instance, so cached
+ * pointers are dropped when the instance is deleted (removeInstance) or when
+ * a nested view model that a path may traverse is replaced (invalidateAll).
+ *
+ * Only accessed from the command server thread.
+ */
+class PropertyHandleTable
+{
+public:
+    struct Property
+    {
+        rive::ViewModelInstanceHandle viewModelInstance;
+        std::string path;
+        PropertyKind resolvedKind = PropertyKind::none;
+        void* resolved = nullptr;
+    };
+
+    void add(uint64_t id,
+             rive::ViewModelInstanceHandle viewModelInstance,
+             std::string path);
+    void remove(uint64_t id);
+    /** Removes every handle on a deleted view model instance. */
+    void removeInstance(rive::ViewModelInstanceHandle viewModelInstance);
+    /** Forgets all resolved runtimes; they are resolved again on next use. */
+    void invalidateAll();
+
+    /** The property for id, or nullptr if it was released or removed. */
+    Property* find(uint64_t id);
+
+    /**
+     * The runtime for property as kind, resolving it with lookup if it is not
+     * already cached.
+     *
+     * @param lookup Called with the instance's ViewModelInstanceRuntime and
+     * the path, e.g. to call propertyNumber.
+     * @return The runtime, or nullptr if the instance or path does not
+     * resolve.
+     */
+    template <typename Lookup>
+    auto resolve(rive::CommandServer* server,
+                 Property& property,
+                 PropertyKind kind,
+                 Lookup&& lookup)
+        -> std::invoke_result_t<Lookup,
+                                rive::ViewModelInstanceRuntime*,
+                                const std::string&>
+    {
+        using RuntimeT = std::invoke_result_t<Lookup,
+                                              rive::ViewModelInstanceRuntime*,
+                                              const std::string&>;
+        if (property.resolvedKind != kind || property.resolved == nullptr)
+        {
+            auto* instance =
+                server->getViewModelInstance(property.viewModelInstance);
+            property.resolved = instance == nullptr
+                                    ? nullptr
+                                    : lookup(instance, property.path);
+            property.resolvedKind = kind;
+        }
+        return static_cast<RuntimeT>(property.resolved);
+    }
+
+private:
+    std::unordered_map<uint64_t, Property> m_properties;
+};
+} // namespace rive_android
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdarg>
+#include <cstdint>
 #include <jni.h>
 #include <mutex>
 
@@ -16,8 +17,15 @@ void InitializeRiveLog();
 
 /**
  * Logging functions that call the Kotlin RiveLog infrastructure.
- * These functions format the message in C++ and then call the Kotlin RiveLog
- * methods, which respect the configured logger.
+ *
+ * A message below the level set from Kotlin with SetRiveLogMinPriority() is
+ * discarded with a single comparison, before it is formatted. Others are
+ * formatted in C++ and pushed onto a lock-free ring, from which a low priority
+ * thread passes them to the Kotlin RiveLog methods, which respect the
+ * configured logger. The calling thread never waits: if the ring is full, the
+ * message is dropped and counted.
+ *
+ * Before InitializeRiveLog(), messages go straight to the Android log.
  *
  * All functions are thread-safe and cache JNI class/method IDs for efficiency.
  */
@@ -27,4 +35,13 @@ void RiveLogI(const char* tag, const char* format, ...);
 void RiveLogW(const char* tag, const char* format, ...);
 void RiveLogE(const char* tag, const char* format, ...);
 
+/**
+ * Sets the lowest Android log priority (ANDROID_LOG_VERBOSE to
+ * ANDROID_LOG_SILENT) of the messages to pass to Kotlin.
+ */
+void SetRiveLogMinPriority(int priority);
+
+/** The number of messages dropped because the ring was full. */
+uint64_t RiveLogDroppedMessages();
+
 } // namespace rive_android
@@ -18,7 +18,9 @@
 
 #include <cstdint>
 #include <mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 // Enable thread safety attributes only with clang.
 // The attributes can be safely erased when compiling with other compilers.
@@ -40,9 +42,43 @@ enum class Affinity
 {
     None,
     Even,
-    Odd
+    Odd,
+    // The cores faster than the slowest class, see selectPerformanceCpus().
+    Performance
 };
 
+/** A CPU core and how fast it is, as reported by sysfs. */
+struct CpuCore
+{
+    int32_t cpu;
+    // The kernel's relative capacity, where the fastest core is 1024, or 0 if
+    // not reported.
+    uint32_t capacity;
+    // The maximum frequency in kHz, or 0 if not reported.
+    uint32_t maxFrequencyKHz;
+};
+
+constexpr const char* kSysfsCpuRoot = "/sys/devices/system/cpu";
+
+/**
+ * Reads the online cores from a sysfs CPU tree.
+ *
+ * @param sysfsRoot The tree's root, normally kSysfsCpuRoot. Tests may pass a
+ *   fake tree with the same layout.
+ * @return The online cores, or none if the online list can't be read.
+ */
+std::vector<CpuCore> readCpuTopology(const std::string& sysfsRoot);
+
+/**
+ * Picks the cores for latency sensitive threads: all but the slowest class of
+ * cores, ranked by capacity, or by maximum frequency if any core's capacity is
+ * unknown. On big.LITTLE this is the big cores, and on tri-cluster designs the
+ * middle and prime cores, so that threads pinned together still have more than
+ * one core. Returns every core if they are all alike or their speeds unknown.
+ */
+std::vector<int32_t> selectPerformanceCpus(const std::vector<CpuCore>& cores);
+
+/** The number of cores the calling thread may run on. */
 int32_t getNumCpus();
 
 void setAffinity(int32_t cpu);
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "helpers/event_count.hpp"
+
+namespace rive_android
+{
+/**
+ * A bounded, lock-free, multi-producer single-consumer FIFO of tasks.
+ *
+ * Each push takes a ticket with a single atomic increment and writes the task
+ * into that ticket's slot in a ring of Capacity slots, so producers never
+ * take a lock or allocate. Tickets are consecutive from 0 and tasks are popped
+ * in ticket order, so a ticket also says how many tasks run before it.
+ *
+ * Each slot carries a sequence number that says whether it is free for the
+ * ticket that maps to it, or holds a published task. Producers only wait when
+ * their slot is still full, and the consumer only waits when the next slot is
+ * empty; both spin briefly and then park on a futex (EventCount).
+ *
+ * pop() must only be called from one thread at a time.
+ */
+template <typename Task, size_t Capacity> class WorkQueue
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+public:
+    using Ticket = uint64_t;
+
+    /**
+     * Publishing a task notifies published, if given, instead of the queue's
+     * own EventCount. This lets one consumer wait on several queues at once,
+     * checking hasWork() on each before calling pop().
+     */
+    explicit WorkQueue(EventCount* published = nullptr) :
+        m_publishedEvents(published != nullptr ? published : &m_published)
+    {
+        for (size_t i = 0; i < Capacity; i++)
+        {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    WorkQueue(const WorkQueue&) = delete;
+    WorkQueue& operator=(const WorkQueue&) = delete;
+
+    /** Appends task, parking while the ring is full. */
+    Ticket push(Task&& task)
+    {
+        return pushWith(std::move(task), [this](Slot& slot, Ticket ticket) {
+            m_slotFreed[ticket & kMask].await(
+                [&] { return slot.isFreeFor(ticket); });
+        });
+    }
+
+    /**
+     * Appends task, calling whileFull() instead of parking while the ring is
+     * full. For the consumer thread, which would otherwise wait on itself:
+     * whileFull() can pop() to make room.
+     */
+    template <typename WhileFull>
+    Ticket pushOrElse(Task&& task, WhileFull&& whileFull)
+    {
+        return pushWith(std::move(task), [&](Slot& slot, Ticket ticket) {
+            while (!slot.isFreeFor(ticket))
+            {
+                whileFull();
+            }
+        });
+    }
+
+    /**
+     * Appends task if the ring has room, without ever waiting. For producers
+     * that would rather drop a task than stall.
+     *
+     * @return false, leaving task unmoved, if the ring is full.
+     */
+    bool tryPush(Task&& task)
+    {
+        Ticket ticket = m_tail.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = m_slots[ticket & kMask];
+            if (!slot.isFreeFor(ticket))
+            {
+                // The ring is full, unless another producer took this ticket
+                // since it was loaded.
+                const Ticket tail = m_tail.load(std::memory_order_relaxed);
+                if (tail == ticket)
+                {
+                    return false;
+                }
+                ticket = tail;
+                continue;
+            }
+            if (m_tail.compare_exchange_weak(ticket,
+                                             ticket + 1,
+                                             std::memory_order_relaxed))
+            {
+                slot.task = std::move(task);
+                slot.sequence.store(ticket + 1, std::memory_order_release);
+                m_publishedEvents->notifyOne();
+                return true;
+            }
+        }
+    }
+
+    /** Removes the oldest task, parking until one is published. */
+    Task pop()
+    {
+        Slot& slot = m_slots[m_head & kMask];
+        const Ticket head = m_head;
+        m_publishedEvents->await([&] { return slot.isPublishedFor(head); });
+        Task task = std::move(slot.task);
+        // Free the slot for the ticket one lap later.
+        slot.sequence.store(head + Capacity, std::memory_order_release);
+        // Only producers waiting for this slot are woken. Several can wait on
+        // it when producers are more than a lap ahead.
+        m_slotFreed[m_head & kMask].notifyAll();
+        ++m_head;
+        return task;
+    }
+
+    /** Whether pop() would return without waiting. Consumer only. */
+    bool hasWork() const
+    {
+        return m_slots[m_head & kMask].isPublishedFor(m_head);
+    }
+
+    /** The number of tickets taken so far. */
+    Ticket pushedCount() const
+    {
+        return m_tail.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct alignas(kCacheLineSize) Slot
+    {
+        // Equal to the ticket that may fill the slot, or one past the ticket
+        // whose task it holds.
+        std::atomic<Ticket> sequence;
+        Task task;
+
+        bool isFreeFor(Ticket ticket) const
+        {
+            return sequence.load(std::memory_order_acquire) == ticket;
+        }
+        bool isPublishedFor(Ticket ticket) const
+        {
+            return sequence.load(std::memory_order_acquire) == ticket + 1;
+        }
+    };
+
+    template <typename WaitForSlot>
+    Ticket pushWith(Task&& task, WaitForSlot&& waitForSlot)
+    {
+        const Ticket ticket = m_tail.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = m_slots[ticket & kMask];
+        if (!slot.isFreeFor(ticket))
+        {
+            waitForSlot(slot, ticket);
+        }
+        slot.task = std::move(task);
+        slot.sequence.store(ticket + 1, std::memory_order_release);
+        m_publishedEvents->notifyOne();
+        return ticket;
+    }
+
+    Slot m_slots[Capacity];
+    alignas(kCacheLineSize) std::atomic<Ticket> m_tail{0};
+    // Only accessed by the consumer.
+    alignas(kCacheLineSize) Ticket m_head = 0;
+    // Notified when a task is published; only the consumer waits on it.
+    EventCount m_published;
+    EventCount* const m_publishedEvents;
+    // Notified when each slot is freed; producers wait on their slot when the
+    // ring is full.
+    EventCount m_slotFreed[Capacity];
+};
+} // namespace rive_android
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "helpers/event_count.hpp"
+
+namespace rive_android
+{
+/**
+ * A fork-join pool for running a batch of independent tasks across cores.
+ *
+ * parallelFor() splits the task indices into one contiguous range per
+ * participant, the calling thread included. Each participant works through
+ * the front of its own range, and once it runs dry steals the back half of
+ * the next non-empty range, so uneven tasks still balance out. Claiming and
+ * stealing are single compare-and-swaps on a packed range, with no locks.
+ *
+ * Pool threads park on a futex between batches, and are all woken for each
+ * batch. They are not attached to the JVM and have no GL context, so tasks
+ * must not use either.
+ *
+ * parallelFor() must only be called from one thread at a time.
+ */
+class WorkStealingPool
+{
+public:
+    /**
+     * @param threadCount The number of pool threads, not counting the thread
+     * calling parallelFor().
+     * @param name The prefix for the pool threads' names.
+     */
+    WorkStealingPool(size_t threadCount, const char* name);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /** The number of threads running a batch, including the caller. */
+    size_t concurrency() const { return m_threads.size() + 1; }
+
+    /**
+     * Calls task(i) for every i in [0, count), from the calling thread and
+     * the pool threads, returning once every call has returned.
+     */
+    template <typename Task> void parallelFor(size_t count, Task&& task)
+    {
+        run(count,
+            [](void* context, size_t index) {
+                (*static_cast<std::remove_reference_t<Task>*>(context))(index);
+            },
+            &task);
+    }
+
+private:
+    using TaskFn = void (*)(void* context, size_t index);
+
+    // A range of task indices [begin, end), packed so that it can be claimed
+    // from and stolen from with one compare-and-swap.
+    struct alignas(64) Range
+    {
+        std::atomic<uint64_t> bounds{0};
+    };
+
+    static uint64_t Pack(uint32_t begin, uint32_t end)
+    {
+        return static_cast<uint64_t>(end) << 32 | begin;
+    }
+    static uint32_t Begin(uint64_t bounds)
+    {
+        return static_cast<uint32_t>(bounds);
+    }
+    static uint32_t End(uint64_t bounds)
+    {
+        return static_cast<uint32_t>(bounds >> 32);
+    }
+
+    void run(size_t count, TaskFn fn, void* context);
+    void threadMain(size_t participant, std::string name);
+    void runTasks(size_t participant);
+    bool claim(size_t participant, uint32_t* index);
+    bool steal(size_t participant, uint32_t* index);
+
+    // One range per participant; the calling thread is participant 0.
+    std::unique_ptr<Range[]> m_ranges;
+    std::vector<std::thread> m_threads;
+
+    // The current batch. Written before m_generation is bumped.
+    TaskFn m_fn = nullptr;
+    void* m_context = nullptr;
+
+    std::atomic<uint64_t> m_generation{0};
+    std::atomic<bool> m_isStopping{false};
+    EventCount m_batchStarted;
+
+    // Tasks not yet finished in the current batch.
+    std::atomic<size_t> m_remaining{0};
+    // Pool threads that have not yet left the current batch.
+    std::atomic<size_t> m_participating{0};
+    EventCount m_batchFinished;
+};
+} // namespace rive_android
@@ -43,7 +43,9 @@ public:
 
 private:
     explicit RefWorker(const RendererType rendererType) :
-        WorkerThread(RendererName(rendererType), Affinity::None, rendererType)
+        WorkerThread(RendererName(rendererType),
+                     Affinity::Performance,
+                     rendererType)
     {}
 
     void externalRefCountDidReachZero();
@@ -16,25 +16,61 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
-#include <condition_variable>
-#include <mutex>
-#include <queue>
-#include <stack>
+#include <chrono>
+#include <deque>
 #include <thread>
 
+#include "helpers/event_count.hpp"
 #include "helpers/general.hpp"
+#include "helpers/inline_task.hpp"
 #include "helpers/thread_state_egl.hpp"
+#include "helpers/work_queue.hpp"
 #include "thread.hpp"
 
 namespace rive_android
 {
+/**
+ * The lanes of a WorkerThread. Frame work runs ahead of background work, so
+ * that frames aren't held up by bulk resource work queued for other views
+ * sharing the worker. Work within a lane runs in the order it was queued.
+ */
+enum class WorkLane : uint8_t
+{
+    // Latency critical: frames, and anything that must stay ordered with them
+    // or that frames read from, such as uploads of buffers and textures.
+    Frame,
+    // Work no frame depends on, e.g. releasing GPU resources.
+    Background,
+};
+
 class WorkerThread
 {
 public:
-    using Work = std::function<void(DrawableThreadState*)>;
+    // Stored inline in the work queue; only captures larger than 32 bytes
+    // allocate. With its deadline and enqueue time, queued work and its
+    // sequence number fill a 64 byte cache line.
+    using Work = InlineTask<void(DrawableThreadState*), 32>;
     using WorkID = uint64_t;
+    using Clock = std::chrono::steady_clock;
     constexpr static WorkID kWorkIDAlwaysFinished = 0;
+    constexpr static Clock::time_point kNoDeadline = Clock::time_point::max();
+
+    struct LaneStats
+    {
+        // Work queued or running.
+        uint64_t queueDepth = 0;
+        // The most work that has been queued or running at once.
+        uint64_t peakQueueDepth = 0;
+        uint64_t ranCount = 0;
+        // Work skipped because it started after its deadline.
+        uint64_t droppedCount = 0;
+        // Time from being queued to starting (or being dropped).
+        Clock::duration totalWait{0};
+        Clock::duration maxWait{0};
+    };
 
     // A worker object that starts a background thread to perform its tasks.
     WorkerThread(const char* name,
@@ -42,8 +78,7 @@ public:
                  const RendererType rendererType) :
         m_RendererType(rendererType),
         mName(name),
-        mAffinity(affinity),
-        mWorkMutex{}
+        mAffinity(affinity)
     {
         // Don't launch the worker thread until all of our objects are fully
         // initialized.
@@ -70,51 +105,68 @@ public:
         return m_threadState.get();
     }
 
-    WorkID run(Work&& work)
+    // Work that hasn't started by its deadline is dropped without running,
+    // though its captures are still destroyed on the worker thread, and it
+    // still counts as complete.
+    WorkID run(Work&& work,
+               WorkLane lane = WorkLane::Frame,
+               Clock::time_point deadline = kNoDeadline)
     {
-        assert(work !=
-               nullptr); // Clients can't push the null termination token.
-        uint64_t pushedWorkID;
-        {
-            std::lock_guard workLock(mWorkMutex);
-            assert(!mIsTerminated);
-            mWorkQueue.emplace(std::move(work));
-            pushedWorkID = ++m_lastPushedWorkID;
-        }
-        m_workPushedCondition.notify_one();
-        return pushedWorkID;
+        assert(work); // Clients can't push the null termination token.
+        assert(!mIsTerminated);
+        auto ticket = push(lane, {std::move(work), deadline, Clock::now()});
+        return MakeWorkID(lane, ticket);
     }
 
     void waitUntilComplete(WorkID workID)
     {
-        if (m_lastCompletedWorkID >= workID)
+        // Work within a lane completes in order, so each lane only tracks its
+        // last completed work.
+        const auto& lastCompleted = m_lanes[LaneIndex(workID)].lastCompleted;
+        const WorkID sequence = workID / kLaneCount;
+        auto isComplete = [&] {
+            return lastCompleted.load(std::memory_order_acquire) >= sequence;
+        };
+        if (isComplete())
         {
-            return; // Early out that doesn't require a mutex!
-        }
-        std::lock_guard<std::mutex> threadLock(mWorkMutex);
-        while (m_lastCompletedWorkID < workID)
-        {
-            m_workedCompletedCondition.wait(mWorkMutex);
+            return; // Early out that doesn't require parking!
         }
+        m_workCompleted.await(isComplete);
+    }
+
+    void runAndWait(Work&& work, WorkLane lane = WorkLane::Frame)
+    {
+        waitUntilComplete(run(std::move(work), lane));
     }
 
-    void runAndWait(Work&& work) { waitUntilComplete(run(std::move(work))); }
+    LaneStats laneStats(WorkLane lane) const
+    {
+        const Lane& l = m_lanes[static_cast<size_t>(lane)];
+        LaneStats stats;
+        stats.ranCount = l.ranCount.load(std::memory_order_relaxed);
+        stats.droppedCount = l.droppedCount.load(std::memory_order_relaxed);
+        const uint64_t completed = stats.ranCount + stats.droppedCount;
+        const uint64_t pushed = l.queue.pushedCount();
+        stats.queueDepth = pushed > completed ? pushed - completed : 0;
+        stats.peakQueueDepth =
+            l.peakQueueDepth.load(std::memory_order_relaxed);
+        stats.totalWait =
+            Clock::duration(l.totalWait.load(std::memory_order_relaxed));
+        stats.maxWait =
+            Clock::duration(l.maxWait.load(std::memory_order_relaxed));
+        return stats;
+    }
 
     void terminateThread()
     {
-        bool didSendTerminationToken = false;
+        if (!mIsTerminated.exchange(true))
         {
-            std::lock_guard workLock(mWorkMutex);
-            if (!mIsTerminated)
+            // Each lane is closed with a termination token, and the thread
+            // ends once every lane is closed and drained.
+            for (size_t i = 0; i < kLaneCount; i++)
             {
-                mWorkQueue.emplace(nullptr);
-                mIsTerminated = true;
-                didSendTerminationToken = true;
+                push(static_cast<WorkLane>(i), {});
             }
-        }
-        if (didSendTerminationToken)
-        {
-            m_workPushedCondition.notify_one();
             // Check if the current thread is the worker thread itself. Since we
             // dispose async this could happen directly on the worker thread
             // itself.
@@ -128,7 +180,11 @@ public:
             {
                 // It's safe to join from another thread.
                 mThread.join();
-                assert(m_lastCompletedWorkID == m_lastPushedWorkID);
+                // Everything but the termination tokens was completed.
+                for ([[maybe_unused]] const Lane& lane : m_lanes)
+                {
+                    assert(lane.lastCompleted + 1 == lane.queue.pushedCount());
+                }
             }
         }
     }
@@ -141,6 +197,66 @@ protected:
 private:
     static constexpr auto* TAG = "RiveLN/WorkerThread";
 
+    // Bounds the work waiting in each lane, e.g. frames, surface changes,
+    // and GPU resource uploads and releases.
+    static constexpr size_t kWorkQueueCapacity = 256;
+    static constexpr size_t kLaneCount = 2;
+    // After this much frame work in a row, one background work runs even if
+    // frame work is waiting, so background work is never starved.
+    static constexpr int kMaxFrameWorkInARow = 8;
+
+    struct QueuedWork
+    {
+        Work work;
+        Clock::time_point deadline = kNoDeadline;
+        Clock::time_point enqueueTime;
+    };
+    using LaneQueue = WorkQueue<QueuedWork, kWorkQueueCapacity>;
+
+    struct Lane
+    {
+        explicit Lane(EventCount* published) : queue(published) {}
+
+        LaneQueue queue;
+        // The sequence (ticket + 1) of the last work completed in this lane.
+        std::atomic<WorkID> lastCompleted = kWorkIDAlwaysFinished;
+        // Stats, only written by the worker thread.
+        std::atomic<uint64_t> ranCount = 0;
+        std::atomic<uint64_t> droppedCount = 0;
+        std::atomic<uint64_t> peakQueueDepth = 0;
+        std::atomic<Clock::rep> totalWait = 0;
+        std::atomic<Clock::rep> maxWait = 0;
+        // Only accessed by the worker thread.
+        bool isClosed = false;
+        // Work moved out of the full queue, oldest first, so that work queued
+        // by a task on the worker has room. It runs before anything still in
+        // the queue, keeping the lane in order. Only accessed by the worker
+        // thread.
+        std::deque<QueuedWork> spilled;
+
+        bool hasWork() const { return !spilled.empty() || queue.hasWork(); }
+
+        // Only called on the worker thread, once hasWork().
+        QueuedWork pop()
+        {
+            if (spilled.empty())
+            {
+                return queue.pop();
+            }
+            QueuedWork work = std::move(spilled.front());
+            spilled.pop_front();
+            return work;
+        }
+    };
+
+    // IDs interleave lanes, with sequences starting at 1 so that 0 is
+    // kWorkIDAlwaysFinished.
+    static WorkID MakeWorkID(WorkLane lane, LaneQueue::Ticket ticket)
+    {
+        return (ticket + 1) * kLaneCount + static_cast<WorkID>(lane);
+    }
+    static size_t LaneIndex(WorkID workID) { return workID % kLaneCount; }
+
     static std::unique_ptr<DrawableThreadState> MakeThreadState(
         const RendererType type);
 
@@ -153,53 +269,121 @@ private:
         GetJNIEnv(); // Attach thread to JVM.
         m_threadState = MakeThreadState(m_RendererType);
 
-        std::unique_lock lock(mWorkMutex);
         RiveLogD(TAG, "Worker thread: Beginning work loop.");
-        for (;;)
+        while (runNextWork())
         {
-            while (mWorkQueue.empty())
-            {
-                m_workPushedCondition.wait(mWorkMutex);
-            }
-            Work work = mWorkQueue.front();
-            mWorkQueue.pop();
+        }
+        m_threadState.reset();
+        RiveLogD(TAG,
+                 "Worker thread: End of worker threadMain. Detaching thread.");
+        DetachThread();
+    }
+
+    LaneQueue::Ticket push(WorkLane lane, QueuedWork&& work)
+    {
+        Lane& l = m_lanes[static_cast<size_t>(lane)];
+        if (std::this_thread::get_id() == mThread.get_id())
+        {
+            // Work queued by a task: the worker can't park waiting for room
+            // that only it can make, and running the oldest work here would
+            // nest it inside the running task, completing it out of order. So
+            // the oldest work moves out of the queue, unrun, to make room.
+            return l.queue.pushOrElse(std::move(work), [&l]() {
+                l.spilled.push_back(l.queue.pop());
+            });
+        }
+        return l.queue.push(std::move(work));
+    }
+
+    // Only called on the worker thread. Picks the lane to run from next.
+    Lane& nextLane()
+    {
+        Lane& frame = m_lanes[static_cast<size_t>(WorkLane::Frame)];
+        Lane& background = m_lanes[static_cast<size_t>(WorkLane::Background)];
+        m_workPublished.await(
+            [&] { return frame.hasWork() || background.hasWork(); });
+        if (frame.hasWork() &&
+            (m_frameWorkInARow < kMaxFrameWorkInARow || !background.hasWork()))
+        {
+            m_frameWorkInARow++;
+            return frame;
+        }
+        m_frameWorkInARow = 0;
+        return background;
+    }
 
-            if (!work)
+    // Only called on the worker thread. Returns false once every lane has
+    // been closed by its termination token.
+    bool runNextWork()
+    {
+        Lane& lane = nextLane();
+        QueuedWork queued = lane.pop();
+        if (!queued.work)
+        {
+            // A null function is a special token that closes its lane.
+            lane.isClosed = true;
+            bool allClosed = std::all_of(std::begin(m_lanes),
+                                         std::end(m_lanes),
+                                         [](const Lane& l) {
+                                             return l.isClosed;
+                                         });
+            if (allClosed)
             {
-                // A null function is a special token that tells the thread to
-                // terminate.
                 RiveLogD(
                     TAG,
                     "Worker thread: Encountered null work item - terminating loop.");
-                break;
             }
+            return !allClosed;
+        }
 
-            lock.unlock();
-            work(m_threadState.get());
-            lock.lock();
+        const auto now = Clock::now();
+        const Clock::rep wait = (now - queued.enqueueTime).count();
+        const uint64_t depth =
+            lane.queue.pushedCount() -
+            lane.lastCompleted.load(std::memory_order_relaxed);
+        lane.totalWait.fetch_add(wait, std::memory_order_relaxed);
+        if (wait > lane.maxWait.load(std::memory_order_relaxed))
+        {
+            lane.maxWait.store(wait, std::memory_order_relaxed);
+        }
+        if (depth > lane.peakQueueDepth.load(std::memory_order_relaxed))
+        {
+            lane.peakQueueDepth.store(depth, std::memory_order_relaxed);
+        }
 
-            ++m_lastCompletedWorkID;
-            m_workedCompletedCondition.notify_all();
+        if (now > queued.deadline)
+        {
+            // Stale, e.g. a frame that would be drawn too late to be useful.
+            lane.droppedCount.fetch_add(1, std::memory_order_relaxed);
         }
-        lock.unlock();
-        m_threadState.reset();
-        RiveLogD(TAG,
-                 "Worker thread: End of worker threadMain. Detaching thread.");
-        DetachThread();
+        else
+        {
+            queued.work(m_threadState.get());
+            lane.ranCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        // Release captures before reporting completion.
+        queued.work.reset();
+
+        lane.lastCompleted.store(
+            lane.lastCompleted.load(std::memory_order_relaxed) + 1,
+            std::memory_order_release);
+        m_workCompleted.notifyAll();
+        return true;
     }
 
     const std::string mName;
     const Affinity mAffinity;
 
-    WorkID m_lastPushedWorkID = kWorkIDAlwaysFinished;
-    std::atomic<WorkID> m_lastCompletedWorkID = kWorkIDAlwaysFinished;
-    bool mIsTerminated = false;
+    std::atomic<bool> mIsTerminated = false;
 
-    std::queue<std::function<void(DrawableThreadState*)>> mWorkQueue;
-    std::condition_variable_any m_workPushedCondition;
-    std::condition_variable_any m_workedCompletedCondition;
+    // Notified when work is queued in any lane; only the worker waits on it.
+    EventCount m_workPublished;
+    Lane m_lanes[kLaneCount] = {Lane(&m_workPublished),
+                                Lane(&m_workPublished)};
+    // Only accessed by the worker thread.
+    int m_frameWorkInARow = 0;
+    EventCount m_workCompleted;
 
-    std::mutex mWorkMutex;
     std::thread mThread;
     std::unique_ptr<DrawableThreadState> m_threadState;
 };
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <jni.h>
+
+namespace rive_android
+{
+/** The native methods of one Java class, in RegisterNatives form. */
+struct NativeClassMethods
+{
+    const char* className;
+    const JNINativeMethod* methods;
+    size_t count;
+};
+
+/**
+ * Every native method in the library, grouped by class. Defined in the
+ * generated jni_native_table.cpp; see tools/jni/generate_native_table.py.
+ */
+extern const NativeClassMethods kNativeClassMethods[];
+extern const size_t kNativeClassMethodsCount;
+
+/**
+ * Binds every native method in kNativeClassMethods with RegisterNatives.
+ *
+ * Called once from JNI_OnLoad, whose class loader can see the app's classes.
+ * Registering explicitly means the `Java_` symbols need not be exported, and
+ * calls skip the symbol lookup on first use.
+ *
+ * Classes that are not present, such as test-only classes outside of
+ * instrumentation tests, are skipped. A method missing from a class that is
+ * present is logged and skipped without affecting the rest of that class.
+ */
+void RegisterNativeMethods(JNIEnv* env);
+} // namespace rive_android
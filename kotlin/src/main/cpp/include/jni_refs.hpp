@@ -6,12 +6,24 @@
 
 namespace rive_android
 {
+/**
+ * Resolves every class, method and field ID exposed by this header and caches
+ * them for the lifetime of the process.
+ *
+ * Called once from JNI_OnLoad, before any other accessor is used. The returned
+ * jclass values are global refs owned by this cache, so callers must not
+ * delete them. Classes unavailable on the running API level (e.g. BlendMode
+ * below API 29) resolve to nullptr.
+ */
+extern void InitJNIRefs(JNIEnv*);
+
 extern jint ThrowRiveException(const char* message);
 extern jint ThrowMalformedFileException(const char* message);
 extern jint ThrowUnsupportedRuntimeVersionException(const char* message);
 
 extern jclass GetHashMapClass();
 extern jmethodID GetHashMapConstructorId();
+extern jmethodID GetHashMapPutMethodId();
 extern jclass GetFloatClass();
 extern jmethodID GetFloatConstructor();
 extern jclass GetBooleanClass();
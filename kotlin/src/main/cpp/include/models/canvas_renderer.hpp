@@ -37,7 +37,6 @@ private:
         jclass porterDuffModeClass = GetPorterDuffClass();
         jobject clearMode =
             env->GetStaticObjectField(porterDuffModeClass, GetPdClear());
-        env->DeleteLocalRef(porterDuffModeClass);
         if (clearMode == nullptr)
         {
             RiveLogE(TAG, "Failed to get PorterDuff.Mode.CLEAR.");
@@ -6,6 +6,8 @@
 #include <jni.h>
 #include <variant>
 
+#include "helpers/frame_pacer.hpp"
+#include "helpers/frame_stats.hpp"
 #include "helpers/worker_ref.hpp"
 #include "models/worker_impl.hpp"
 
@@ -34,6 +36,16 @@ public:
 
     float averageFps() const { return m_averageFps; }
 
+    FramePacer::Stats framePacingStats() const { return m_framePacer.stats(); }
+
+    /** Timings of the most recent frames drawn. */
+    const FrameStats& frameStats() const { return m_frameStats; }
+
+    WorkerThread::LaneStats workerLaneStats(WorkLane lane) const
+    {
+        return m_worker->laneStats(lane);
+    }
+
     RendererType rendererType() const { return m_worker->rendererType(); }
 
     int width() const
@@ -78,7 +90,8 @@ public:
     }
 
 private:
-    static constexpr uint8_t kMaxScheduledFrames = 2;
+    // About three frames at 60Hz.
+    static constexpr std::chrono::milliseconds kFrameDeadline{50};
     static constexpr int INVALID_DIMENSION = -1;
     static constexpr int kContextEventLost = 0;
     static constexpr int kContextEventRecovered = 1;
@@ -112,6 +125,11 @@ private:
     std::thread::id m_workerThreadID;
     std::unique_ptr<WorkerImpl> m_workerImpl;
     std::atomic_uint8_t m_numScheduledFrames = 0;
+    // Decides which doFrame() calls schedule a frame, from the cost of the
+    // frames the worker has drawn.
+    FramePacer m_framePacer;
+    // Written on the worker thread for each frame drawn.
+    FrameStats m_frameStats;
 
     /* Helpers for FPS calculations.*/
     std::chrono::steady_clock::time_point m_fpsLastFrameTime;
@@ -1,9 +1,13 @@
 #pragma once
 
 #include <EGL/egl.h>
+#include <GLES3/gl3.h>
+#include <array>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "models/render_surface.hpp"
 #include "rive/renderer/render_context.hpp"
@@ -154,6 +158,62 @@ public:
                             uint32_t height,
                             uint8_t* pixels) = 0;
 
+    /**
+     * Called on the render thread when an asynchronous readback finishes, with
+     * the RGBA pixels, or null if the read failed. The pixels are only valid
+     * during the call.
+     */
+    using ReadPixelsCallback = std::function<void(const uint8_t* pixels)>;
+
+    /**
+     * Start reading pixels from the current render target, calling back once
+     * they are available, from this call or a later completeReadbacks().
+     * Callbacks are made in the order the reads were started.
+     *
+     * The default reads synchronously with readPixels() and calls back before
+     * returning, reading straight into destination if there is one.
+     *
+     * @param surface Backend-specific surface pointer.
+     * @param width Width to read in pixels.
+     * @param height Height to read in pixels.
+     * @param destination Where to write the pixels, at least width * height *
+     *   4 bytes, which must stay valid until the callback. The callback is then
+     *   passed destination. If null, the pixels are passed in a temporary
+     *   buffer instead.
+     * @param callback Called once with the pixels.
+     */
+    virtual void readPixelsAsync(RenderSurface* surface,
+                                 uint32_t width,
+                                 uint32_t height,
+                                 uint8_t* destination,
+                                 ReadPixelsCallback callback)
+    {
+        if (destination != nullptr)
+        {
+            callback(readPixels(surface, width, height, destination)
+                         ? destination
+                         : nullptr);
+            return;
+        }
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+        callback(readPixels(surface, width, height, pixels.data())
+                     ? pixels.data()
+                     : nullptr);
+    }
+
+    /**
+     * Call back for the asynchronous readbacks that have finished, or, if
+     * wait, for all of them once they finish.
+     */
+    virtual void completeReadbacks(bool wait) {}
+
+    /**
+     * Whether the render target's rows read back bottom first, as they do from
+     * glReadPixels. Draws to be read back are then flipped vertically with the
+     * renderer's transform, so their rows arrive top first without a CPU pass.
+     */
+    virtual bool readsBottomUp() const { return false; }
+
     std::unique_ptr<rive::gpu::RenderContext> riveContext;
 };
 
@@ -184,10 +244,52 @@ struct RenderContextGL : RenderContext
                     uint32_t height,
                     uint8_t* pixels) override;
 
+    /**
+     * Reads into one of a ring of pixel buffer objects and fences the read,
+     * so the GPU copies the pixels while the render thread moves on. Only
+     * waits if every buffer in the ring is still being read into.
+     */
+    void readPixelsAsync(RenderSurface* surface,
+                         uint32_t width,
+                         uint32_t height,
+                         uint8_t* destination,
+                         ReadPixelsCallback callback) override;
+    void completeReadbacks(bool wait) override;
+    bool readsBottomUp() const override { return true; }
+
     EGLDisplay eglDisplay;
     EGLContext eglContext;
 
 private:
+    /** A pixel buffer object and the read into it, if one is in flight. */
+    struct Readback
+    {
+        GLuint buffer = 0;
+        size_t capacity = 0;
+        size_t size = 0;
+        // Signaled once the read into buffer has finished; null when idle.
+        GLsync fence = nullptr;
+        // Where the mapped pixels are copied before the callback, if set.
+        uint8_t* destination = nullptr;
+        ReadPixelsCallback callback;
+    };
+
+    // Two, so one read can be in flight while the next frame draws.
+    static constexpr size_t kReadbackBuffers = 2;
+
+    /**
+     * Calls back for a readback once its fence signals, or at once if wait.
+     *
+     * @return false if it has not finished and wait is false.
+     */
+    bool completeReadback(Readback& readback, bool wait);
+    /** Completes every readback and deletes the buffers. */
+    void releaseReadbacks();
+
+    std::array<Readback, kReadbackBuffers> m_readbacks;
+    // The next slot to read into, which is also the oldest in flight.
+    size_t m_nextReadback = 0;
+
     /** A 1x1 PBuffer to bind to the context (some devices do not support
      * surface-less bindings).
      * We must have a valid binding for `MakeContext` to succeed. */
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 
@@ -10,6 +12,44 @@ namespace rive_android
 
 class RenderContext;
 
+/**
+ * Frame counters for one surface, written on the command server thread and
+ * readable from any thread.
+ *
+ * Draw time is the command server's time in one draw, from recording through
+ * flush, and through present for direct frames. Its mean for each mode is the
+ * server's cost per frame, so the ratio is the pipelining throughput gain.
+ * Added latency is the time pipelined frames waited between their flush and
+ * their deferred present. Skipped frames are draws that would have repeated
+ * the frame already on the surface, and cost no GPU work.
+ */
+struct FramePipelineStats
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::atomic<uint64_t> directFrames{0};
+    std::atomic<uint64_t> directDrawNanos{0};
+    std::atomic<uint64_t> pipelinedFrames{0};
+    std::atomic<uint64_t> pipelinedDrawNanos{0};
+    std::atomic<uint64_t> presents{0};
+    std::atomic<uint64_t> presentNanos{0};
+    std::atomic<uint64_t> deferredPresents{0};
+    std::atomic<uint64_t> addedLatencyNanos{0};
+    std::atomic<uint64_t> skippedFrames{0};
+
+    /** Records a drawn frame and the server time it took. */
+    void addFrame(bool pipelined, Clock::duration drawTime);
+    /** Records a present and the time it blocked for. */
+    void addPresent(Clock::duration blockedTime);
+    /** Records a deferred present and how long after its flush it started. */
+    void addDeferredPresent(Clock::duration addedLatency);
+    /** Records a draw skipped because its frame was already presented. */
+    void addSkippedFrame()
+    {
+        skippedFrames.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
 /**
  * Backend-specific surface wrapper that owns its lazy Rive render target.
  *
@@ -50,9 +90,35 @@ public:
      */
     void resize(uint32_t requestedWidth, uint32_t requestedHeight);
 
-    /** Drops the concrete render target so it is recreated on the next draw. */
+    /**
+     * Drops the concrete render target so it is recreated on the next draw,
+     * along with any frame still waiting to present to it.
+     */
     void resetRenderTarget();
 
+    /**
+     * Counts render target resets, so that draws can tell whether the target
+     * they last presented to is still current.
+     */
+    uint64_t targetGeneration() const { return m_targetGeneration; }
+
+    /**
+     * Whether a pipelined draw flushed a frame to this surface and deferred
+     * its present. At most one frame is ever pending.
+     *
+     * Must be called on the command server thread, as must the other pending
+     * present functions.
+     */
+    bool hasPendingPresent() const { return m_hasPendingPresent; }
+
+    /** Marks the frame just flushed as pending, to be presented later. */
+    void deferPresent(FramePipelineStats::Clock::time_point flushedAt);
+
+    /** Clears the pending present, returning when its frame was flushed. */
+    FramePipelineStats::Clock::time_point takePendingPresent();
+
+    FramePipelineStats& pipelineStats() { return m_pipelineStats; }
+
 protected:
     /**
      * Backend hook called during resize before the concrete target is dropped.
@@ -69,6 +135,10 @@ private:
     uint32_t m_requestedWidth;
     uint32_t m_requestedHeight;
     std::unique_ptr<rive::gpu::RenderTarget, RenderTargetUnref> m_renderTarget;
+    uint64_t m_targetGeneration = 0;
+    bool m_hasPendingPresent = false;
+    FramePipelineStats::Clock::time_point m_pendingFlushedAt;
+    FramePipelineStats m_pipelineStats;
 };
 
 } // namespace rive_android
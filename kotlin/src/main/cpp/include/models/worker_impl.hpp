@@ -3,6 +3,7 @@
 #include <variant>
 
 #include "canvas_renderer.hpp"
+#include "helpers/frame_stats.hpp"
 #include "helpers/thread_state_pls.hpp"
 #include "jni_refs.hpp"
 #include "rive/renderer/rive_renderer.hpp"
@@ -21,11 +22,15 @@ namespace rive_android
  * This is needed because frame execution can abort at multiple stages
  * (`makeCurrent`, draw/flush, `swapBuffers`) and callers need one unified
  * status object to drive render-loop behavior and recovery decisions.
+ *
+ * `timings` holds the stages that ran, and is only complete when `didDraw`.
+ * Queue wait is left to the caller, which knows when the frame was requested.
  */
 struct WorkerFrameResult
 {
     bool didDraw = false;
     EGLResult eglResult = EGLResult::Ok();
+    FrameRecord timings;
 };
 
 class WorkerImpl
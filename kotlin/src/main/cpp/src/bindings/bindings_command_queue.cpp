@@ -1,18 +1,33 @@
 #include <android/native_window_jni.h>
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstring>
+#include <functional>
 #include <future>
 #include <jni.h>
+#include <memory>
+#include <numeric>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "helpers/android_factories.hpp"
+#include "helpers/decode_pool.hpp"
+#include "helpers/draw_dirty_tracker.hpp"
+#include "helpers/frame_stats.hpp"
 #include "helpers/image_decode.hpp"
 #include "helpers/jni_resource.hpp"
 #include "helpers/jni_string.hpp"
+#include "helpers/mapped_file.hpp"
+#include "helpers/message_batch.hpp"
+#include "helpers/property_handles.hpp"
 #include "helpers/rive_log.hpp"
+#include "helpers/thread.hpp"
 #include "helpers/tracer.hpp"
+#include "helpers/work_stealing_pool.hpp"
 #include "models/jni_renderer.hpp"
 #include "models/render_context.hpp"
 #include "models/render_surface.hpp"
@@ -20,7 +35,14 @@
 #include "rive/command_queue.hpp"
 #include "rive/command_server.hpp"
 #include "rive/file.hpp"
+#include "rive/renderer.hpp"
 #include "rive/renderer/rive_render_image.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_boolean_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_color_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_enum_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_number_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_string_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_trigger_runtime.hpp"
 
 using namespace rive_android;
 
@@ -36,51 +58,276 @@ template <typename HandleT> static jlong longFromHandle(HandleT handle)
     return static_cast<jlong>(reinterpret_cast<uint64_t>(handle));
 }
 
+/**
+ * Converts a native callback argument to the value passed through JNI
+ * varargs. Strings are converted to a local jstring that lives as long as
+ * this object, which for a temporary is the end of the calling expression.
+ */
+template <typename T> class JniArg
+{
+public:
+    JniArg(JNIEnv*, const T& value) : m_value(value) {}
+    T get() const { return m_value; }
+
+private:
+    T m_value;
+};
+
+template <> class JniArg<std::string>
+{
+public:
+    JniArg(JNIEnv* env, const std::string& value) :
+        m_value(MakeJString(env, value))
+    {}
+    jstring get() const { return m_value.get(); }
+
+private:
+    JniResource<jstring> m_value;
+};
+
 /**
  * Holds a reference to a Kotlin CommandQueue instance and allows calling
  * methods on it. Used by the Listener classes for callbacks.
+ *
+ * All callback method IDs are resolved once on construction, so that
+ * dispatching a message is a table lookup rather than a string-keyed
+ * GetMethodID. A single instance is shared by all listeners created in
+ * cppCreateListeners.
+ *
+ * When a message buffer is set, messages whose arguments are all scalars or
+ * strings are packed into it with MessageBatch instead of being delivered
+ * one upcall at a time. The batch is handed to Kotlin with a single
+ * onMessageBatch upcall when it fills up, before any message that cannot be
+ * packed (to preserve ordering), and at the end of each poll.
  */
 class JCommandQueue
 {
 public:
+    /** The Kotlin CommandQueue callbacks, indexing into the method table. */
+    enum class Callback : uint8_t
+    {
+        OnFileError,
+        OnArtboardInstantiated,
+        OnViewModelInstanceInstantiated,
+        OnFileLoaded,
+        OnArtboardsListed,
+        OnFileAssetsListed,
+        OnViewModelsListed,
+        OnViewModelInstancesListed,
+        OnViewModelPropertiesListed,
+        OnEnumsListed,
+        OnArtboardError,
+        OnStateMachineInstantiated,
+        OnStateMachinesListed,
+        OnArtboardVolumeReceived,
+        OnDefaultViewModelInfoReceived,
+        OnStateMachineError,
+        OnStateMachineSettled,
+        OnViewModelInstanceError,
+        OnViewModelInstanceViewModelNameReceived,
+        OnViewModelInstanceNameReceived,
+        OnNumberPropertyUpdated,
+        OnStringPropertyUpdated,
+        OnBooleanPropertyUpdated,
+        OnEnumPropertyUpdated,
+        OnColorPropertyUpdated,
+        OnTriggerPropertyUpdated,
+        OnViewModelListSizeReceived,
+        OnImageDecoded,
+        OnImageError,
+        OnAudioDecoded,
+        OnAudioError,
+        OnFontDecoded,
+        OnFontError,
+        OnMessageBatch,
+        Count,
+    };
+
     JCommandQueue(JNIEnv* env, jobject jQueue) :
         m_class(reinterpret_cast<jclass>(
             env->NewGlobalRef(GetObjectClass(env, jQueue).get()))),
         m_jQueue(env->NewGlobalRef(jQueue))
-    {}
+    {
+        for (size_t i = 0; i < kCallbackCount; i++)
+        {
+            const auto& spec = kMethodSpecs[i];
+            m_methods[i] = env->GetMethodID(m_class, spec.name, spec.sig);
+            if (m_methods[i] == nullptr)
+            {
+                JNIExceptionHandler::ClearAndLogErrors(env, TAG, spec.name);
+            }
+        }
+    }
 
     ~JCommandQueue()
     {
         auto env = GetJNIEnv();
+        if (m_jMessageBuffer != nullptr)
+        {
+            env->DeleteGlobalRef(m_jMessageBuffer);
+        }
         env->DeleteGlobalRef(m_class);
         env->DeleteGlobalRef(m_jQueue);
     }
 
+    JCommandQueue(const JCommandQueue&) = delete;
+    JCommandQueue& operator=(const JCommandQueue&) = delete;
+
     /**
-     * Call a CommandQueue Kotlin instance method.
+     * Call a CommandQueue Kotlin instance method, or pack the message into the
+     * message batch if one is set.
      *
-     * @param name Kotlin method name
-     * @param sig JNI signature string
-     * @param args Arguments forwarded to CallVoidMethod
+     * @param callback The callback to invoke
+     * @param args Native arguments, converted with JniArg and forwarded to
+     * CallVoidMethod. Must match the callback's JNI signature.
      */
     template <typename... Args>
-    void call(const char* name, const char* sig, Args... args) const
+    void call(Callback callback, const Args&... args)
     {
+        const auto tag = static_cast<uint8_t>(callback);
+        if (m_batch.tryAppend(tag, args...))
+        {
+            return;
+        }
+        if (!m_batch.empty())
+        {
+            // Either the batch is full or this message cannot be packed.
+            // Deliver what we have first so that Kotlin sees messages in order.
+            flushMessageBatch();
+            if (m_batch.tryAppend(tag, args...))
+            {
+                return;
+            }
+        }
+
+        auto mid = m_methods[tag];
+        if (mid == nullptr)
+        {
+            // Already reported when the table was built
+            return;
+        }
         auto env = GetJNIEnv();
-        jmethodID mid = env->GetMethodID(m_class, name, sig);
-        env->CallVoidMethod(m_jQueue, mid, args...);
+        env->CallVoidMethod(m_jQueue, mid, JniArg<Args>(env, args).get()...);
+    }
+
+    /**
+     * Use the given direct ByteBuffer for batched message delivery, or disable
+     * batching if it is null. Must be called from the polling thread.
+     */
+    void setMessageBuffer(JNIEnv* env, jobject jBuffer)
+    {
+        flushMessageBatch();
+        if (m_jMessageBuffer != nullptr)
+        {
+            env->DeleteGlobalRef(m_jMessageBuffer);
+            m_jMessageBuffer = nullptr;
+        }
+        m_batch.setBuffer(nullptr, 0);
+        if (jBuffer == nullptr)
+        {
+            return;
+        }
+
+        auto* data =
+            static_cast<uint8_t*>(env->GetDirectBufferAddress(jBuffer));
+        auto capacity = env->GetDirectBufferCapacity(jBuffer);
+        if (data == nullptr || capacity <= 0)
+        {
+            RiveLogE(TAG, "Message buffer must be a non-empty direct buffer");
+            return;
+        }
+        m_jMessageBuffer = env->NewGlobalRef(jBuffer);
+        m_batch.setBuffer(data, static_cast<size_t>(capacity));
+    }
+
+    /** Deliver any batched messages to Kotlin with a single upcall. */
+    void flushMessageBatch()
+    {
+        if (m_batch.empty())
+        {
+            return;
+        }
+        auto mid = m_methods[static_cast<size_t>(Callback::OnMessageBatch)];
+        if (mid != nullptr)
+        {
+            // Kotlin decodes synchronously, so the buffer can be reused as
+            // soon as the upcall returns.
+            GetJNIEnv()->CallVoidMethod(m_jQueue,
+                                        mid,
+                                        static_cast<jint>(m_batch.size()));
+        }
+        m_batch.clear();
     }
 
 private:
+    constexpr static auto* TAG = "RiveN/JCommandQueue";
+    constexpr static auto kCallbackCount =
+        static_cast<size_t>(Callback::Count);
+
+    struct MethodSpec
+    {
+        const char* name;
+        const char* sig;
+    };
+
+    /** Kotlin name and JNI signature per Callback, in enum order. */
+    constexpr static MethodSpec kMethodSpecs[] = {
+        {"onFileError", "(JLjava/lang/String;)V"},
+        {"onArtboardInstantiated", "(JJ)V"},
+        {"onViewModelInstanceInstantiated", "(JJ)V"},
+        {"onFileLoaded", "(JJ)V"},
+        {"onArtboardsListed", "(JLjava/util/List;)V"},
+        {"onFileAssetsListed", "(JLjava/util/List;)V"},
+        {"onViewModelsListed", "(JLjava/util/List;)V"},
+        {"onViewModelInstancesListed", "(JLjava/util/List;)V"},
+        {"onViewModelPropertiesListed", "(JLjava/util/List;)V"},
+        {"onEnumsListed", "(JLjava/util/List;)V"},
+        {"onArtboardError", "(JLjava/lang/String;)V"},
+        {"onStateMachineInstantiated", "(JJ)V"},
+        {"onStateMachinesListed", "(JLjava/util/List;)V"},
+        {"onArtboardVolumeReceived", "(JF)V"},
+        {"onDefaultViewModelInfoReceived",
+         "(JLjava/lang/String;Ljava/lang/String;)V"},
+        {"onStateMachineError", "(JLjava/lang/String;)V"},
+        {"onStateMachineSettled", "(JJ)V"},
+        {"onViewModelInstanceError", "(JLjava/lang/String;)V"},
+        {"onViewModelInstanceViewModelNameReceived",
+         "(JLjava/lang/String;)V"},
+        {"onViewModelInstanceNameReceived", "(JLjava/lang/String;)V"},
+        {"onNumberPropertyUpdated", "(JJLjava/lang/String;F)V"},
+        {"onStringPropertyUpdated",
+         "(JJLjava/lang/String;Ljava/lang/String;)V"},
+        {"onBooleanPropertyUpdated", "(JJLjava/lang/String;Z)V"},
+        {"onEnumPropertyUpdated", "(JJLjava/lang/String;Ljava/lang/String;)V"},
+        {"onColorPropertyUpdated", "(JJLjava/lang/String;I)V"},
+        {"onTriggerPropertyUpdated", "(JJLjava/lang/String;)V"},
+        {"onViewModelListSizeReceived", "(JI)V"},
+        {"onImageDecoded", "(JJ)V"},
+        {"onImageError", "(JLjava/lang/String;)V"},
+        {"onAudioDecoded", "(JJ)V"},
+        {"onAudioError", "(JLjava/lang/String;)V"},
+        {"onFontDecoded", "(JJ)V"},
+        {"onFontError", "(JLjava/lang/String;)V"},
+        {"onMessageBatch", "(I)V"},
+    };
+    static_assert(std::size(kMethodSpecs) == kCallbackCount,
+                  "kMethodSpecs must have one entry per Callback");
+
     jclass m_class;
     jobject m_jQueue;
+    std::array<jmethodID, kCallbackCount> m_methods{};
+    jobject m_jMessageBuffer = nullptr;
+    MessageBatch m_batch;
 };
 
+using Callback = JCommandQueue::Callback;
+
 class FileListener : public rive::CommandQueue::FileListener
 {
 public:
-    FileListener(JNIEnv* env, jobject jQueue) :
-        rive::CommandQueue::FileListener(), m_queue(env, jQueue)
+    explicit FileListener(std::shared_ptr<JCommandQueue> queue) :
+        rive::CommandQueue::FileListener(),
+        m_queue(std::move(queue))
     {}
 
     virtual ~FileListener() = default;
@@ -89,21 +336,16 @@ public:
                      uint64_t requestID,
                      std::string error) override
     {
-        auto jError = MakeJString(GetJNIEnv(), error);
-        m_queue.call("onFileError",
-                     "(JLjava/lang/String;)V",
-                     requestID,
-                     jError.get());
+        m_queue->call(Callback::OnFileError, requestID, error);
     }
 
     void onArtboardInstantiated(const rive::FileHandle,
                                 uint64_t requestID,
                                 rive::ArtboardHandle handle) override
     {
-        m_queue.call("onArtboardInstantiated",
-                     "(JJ)V",
-                     requestID,
-                     longFromHandle(handle));
+        m_queue->call(Callback::OnArtboardInstantiated,
+                      requestID,
+                      longFromHandle(handle));
     }
 
     void onViewModelInstanceInstantiated(
@@ -111,16 +353,17 @@ public:
         uint64_t requestID,
         rive::ViewModelInstanceHandle handle) override
     {
-        m_queue.call("onViewModelInstanceInstantiated",
-                     "(JJ)V",
-                     requestID,
-                     longFromHandle(handle));
+        m_queue->call(Callback::OnViewModelInstanceInstantiated,
+                      requestID,
+                      longFromHandle(handle));
     }
 
     void onFileLoaded(const rive::FileHandle handle,
                       uint64_t requestID) override
     {
-        m_queue.call("onFileLoaded", "(JJ)V", requestID, handle);
+        m_queue->call(Callback::OnFileLoaded,
+                      requestID,
+                      longFromHandle(handle));
     }
 
     void onArtboardsListed(const rive::FileHandle,
@@ -128,10 +371,7 @@ public:
                            std::vector<std::string> artboardNames) override
     {
         auto jList = VecStringToJStringList(GetJNIEnv(), artboardNames);
-        m_queue.call("onArtboardsListed",
-                     "(JLjava/util/List;)V",
-                     requestID,
-                     jList.get());
+        m_queue->call(Callback::OnArtboardsListed, requestID, jList.get());
     }
 
     void onFileAssetsListed(
@@ -176,10 +416,7 @@ public:
             env->CallBooleanMethod(jAssets.get(), arrayListAddFn, jAsset.get());
         }
 
-        m_queue.call("onFileAssetsListed",
-                     "(JLjava/util/List;)V",
-                     requestID,
-                     jAssets.get());
+        m_queue->call(Callback::OnFileAssetsListed, requestID, jAssets.get());
     }
 
     void onViewModelsListed(const rive::FileHandle,
@@ -187,10 +424,7 @@ public:
                             std::vector<std::string> viewModelNames) override
     {
         auto jList = VecStringToJStringList(GetJNIEnv(), viewModelNames);
-        m_queue.call("onViewModelsListed",
-                     "(JLjava/util/List;)V",
-                     requestID,
-                     jList.get());
+        m_queue->call(Callback::OnViewModelsListed, requestID, jList.get());
     }
 
     void onViewModelInstanceNamesListed(
@@ -200,10 +434,9 @@ public:
         std::vector<std::string> instanceNames) override
     {
         auto jList = VecStringToJStringList(GetJNIEnv(), instanceNames);
-        m_queue.call("onViewModelInstancesListed",
-                     "(JLjava/util/List;)V",
-                     requestID,
-                     jList.get());
+        m_queue->call(Callback::OnViewModelInstancesListed,
+                      requestID,
+                      jList.get());
     }
 
     void onViewModelPropertiesListed(
@@ -259,10 +492,9 @@ public:
                                    propertyObject.get());
         }
 
-        m_queue.call("onViewModelPropertiesListed",
-                     "(JLjava/util/List;)V",
-                     requestID,
-                     jPropertyList.get());
+        m_queue->call(Callback::OnViewModelPropertiesListed,
+                      requestID,
+                      jPropertyList.get());
     }
 
     void onViewModelEnumsListed(const rive::FileHandle,
@@ -316,21 +548,19 @@ public:
                                    jEnumObject.get());
         }
 
-        m_queue.call("onEnumsListed",
-                     "(JLjava/util/List;)V",
-                     requestID,
-                     jEnumsList.get());
+        m_queue->call(Callback::OnEnumsListed, requestID, jEnumsList.get());
     }
 
 private:
-    JCommandQueue m_queue;
+    std::shared_ptr<JCommandQueue> m_queue;
 };
 
 class ArtboardListener : public rive::CommandQueue::ArtboardListener
 {
 public:
-    ArtboardListener(JNIEnv* env, jobject jQueue) :
-        rive::CommandQueue::ArtboardListener(), m_queue(env, jQueue)
+    explicit ArtboardListener(std::shared_ptr<JCommandQueue> queue) :
+        rive::CommandQueue::ArtboardListener(),
+        m_queue(std::move(queue))
     {}
 
     virtual ~ArtboardListener() = default;
@@ -339,21 +569,16 @@ public:
                          uint64_t requestID,
                          std::string error) override
     {
-        auto jError = MakeJString(GetJNIEnv(), error);
-        m_queue.call("onArtboardError",
-                     "(JLjava/lang/String;)V",
-                     requestID,
-                     jError.get());
+        m_queue->call(Callback::OnArtboardError, requestID, error);
     }
 
     void onStateMachineInstantiated(const rive::ArtboardHandle,
                                     uint64_t requestID,
                                     rive::StateMachineHandle handle) override
     {
-        m_queue.call("onStateMachineInstantiated",
-                     "(JJ)V",
-                     requestID,
-                     longFromHandle(handle));
+        m_queue->call(Callback::OnStateMachineInstantiated,
+                      requestID,
+                      longFromHandle(handle));
     }
 
     void onStateMachinesListed(
@@ -362,17 +587,14 @@ public:
         std::vector<std::string> stateMachineNames) override
     {
         auto jList = VecStringToJStringList(GetJNIEnv(), stateMachineNames);
-        m_queue.call("onStateMachinesListed",
-                     "(JLjava/util/List;)V",
-                     requestID,
-                     jList.get());
+        m_queue->call(Callback::OnStateMachinesListed, requestID, jList.get());
     }
 
     void onArtboardVolumeReceived(const rive::ArtboardHandle,
                                   uint64_t requestID,
                                   float volume) override
     {
-        m_queue.call("onArtboardVolumeReceived", "(JF)V", requestID, volume);
+        m_queue->call(Callback::OnArtboardVolumeReceived, requestID, volume);
     }
 
     void onDefaultViewModelInfoReceived(const rive::ArtboardHandle,
@@ -380,25 +602,22 @@ public:
                                         std::string viewModelName,
                                         std::string instanceName) override
     {
-        auto env = GetJNIEnv();
-        auto jViewModelName = MakeJString(env, viewModelName);
-        auto jInstanceName = MakeJString(env, instanceName);
-        m_queue.call("onDefaultViewModelInfoReceived",
-                     "(JLjava/lang/String;Ljava/lang/String;)V",
-                     requestID,
-                     jViewModelName.get(),
-                     jInstanceName.get());
+        m_queue->call(Callback::OnDefaultViewModelInfoReceived,
+                      requestID,
+                      viewModelName,
+                      instanceName);
     }
 
 private:
-    JCommandQueue m_queue;
+    std::shared_ptr<JCommandQueue> m_queue;
 };
 
 class StateMachineListener : public rive::CommandQueue::StateMachineListener
 {
 public:
-    StateMachineListener(JNIEnv* env, jobject jQueue) :
-        rive::CommandQueue::StateMachineListener(), m_queue(env, jQueue)
+    explicit StateMachineListener(std::shared_ptr<JCommandQueue> queue) :
+        rive::CommandQueue::StateMachineListener(),
+        m_queue(std::move(queue))
     {}
 
     virtual ~StateMachineListener() = default;
@@ -407,32 +626,28 @@ public:
                              uint64_t requestID,
                              std::string error) override
     {
-        auto jError = MakeJString(GetJNIEnv(), error);
-        m_queue.call("onStateMachineError",
-                     "(JLjava/lang/String;)V",
-                     requestID,
-                     jError.get());
+        m_queue->call(Callback::OnStateMachineError, requestID, error);
     }
 
     void onStateMachineSettled(const rive::StateMachineHandle smHandle,
                                uint64_t requestID) override
     {
-        m_queue.call("onStateMachineSettled",
-                     "(JJ)V",
-                     requestID,
-                     longFromHandle(smHandle));
+        m_queue->call(Callback::OnStateMachineSettled,
+                      requestID,
+                      longFromHandle(smHandle));
     }
 
 private:
-    JCommandQueue m_queue;
+    std::shared_ptr<JCommandQueue> m_queue;
 };
 
 class ViewModelInstanceListener
     : public rive::CommandQueue::ViewModelInstanceListener
 {
 public:
-    ViewModelInstanceListener(JNIEnv* env, jobject jQueue) :
-        rive::CommandQueue::ViewModelInstanceListener(), m_queue(env, jQueue)
+    explicit ViewModelInstanceListener(std::shared_ptr<JCommandQueue> queue) :
+        rive::CommandQueue::ViewModelInstanceListener(),
+        m_queue(std::move(queue))
     {}
 
     virtual ~ViewModelInstanceListener() = default;
@@ -441,11 +656,7 @@ public:
                                   uint64_t requestID,
                                   std::string error) override
     {
-        auto jError = MakeJString(GetJNIEnv(), error);
-        m_queue.call("onViewModelInstanceError",
-                     "(JLjava/lang/String;)V",
-                     requestID,
-                     jError.get());
+        m_queue->call(Callback::OnViewModelInstanceError, requestID, error);
     }
 
     void onViewModelInstanceViewModelNameReceived(
@@ -453,22 +664,18 @@ public:
         uint64_t requestID,
         std::string viewModelName) override
     {
-        auto jName = MakeJString(GetJNIEnv(), viewModelName);
-        m_queue.call("onViewModelInstanceViewModelNameReceived",
-                     "(JLjava/lang/String;)V",
-                     requestID,
-                     jName.get());
+        m_queue->call(Callback::OnViewModelInstanceViewModelNameReceived,
+                      requestID,
+                      viewModelName);
     }
 
     void onViewModelInstanceNameReceived(const rive::ViewModelInstanceHandle,
                                          uint64_t requestID,
                                          std::string instanceName) override
     {
-        auto jName = MakeJString(GetJNIEnv(), instanceName);
-        m_queue.call("onViewModelInstanceNameReceived",
-                     "(JLjava/lang/String;)V",
-                     requestID,
-                     jName.get());
+        m_queue->call(Callback::OnViewModelInstanceNameReceived,
+                      requestID,
+                      instanceName);
     }
 
     void onViewModelDataReceived(
@@ -476,59 +683,51 @@ public:
         uint64_t requestID,
         rive::CommandQueue::ViewModelInstanceData data) override
     {
-        auto env = GetJNIEnv();
-        auto jPropertyName = MakeJString(env, data.metaData.name);
+        const auto& propertyName = data.metaData.name;
+        const auto vmiHandleLong = longFromHandle(vmiHandle);
 
         switch (data.metaData.type)
         {
             case rive::DataType::number:
-                m_queue.call("onNumberPropertyUpdated",
-                             "(JJLjava/lang/String;F)V",
-                             requestID,
-                             longFromHandle(vmiHandle),
-                             jPropertyName.get(),
-                             data.numberValue);
+                m_queue->call(Callback::OnNumberPropertyUpdated,
+                              requestID,
+                              vmiHandleLong,
+                              propertyName,
+                              static_cast<jfloat>(data.numberValue));
                 break;
             case rive::DataType::string:
-                m_queue.call("onStringPropertyUpdated",
-                             "(JJLjava/lang/String;Ljava/"
-                             "lang/String;)V",
-                             requestID,
-                             longFromHandle(vmiHandle),
-                             jPropertyName.get(),
-                             MakeJString(env, data.stringValue).get());
+                m_queue->call(Callback::OnStringPropertyUpdated,
+                              requestID,
+                              vmiHandleLong,
+                              propertyName,
+                              data.stringValue);
                 break;
             case rive::DataType::boolean:
-                m_queue.call("onBooleanPropertyUpdated",
-                             "(JJLjava/lang/String;Z)V",
-                             requestID,
-                             longFromHandle(vmiHandle),
-                             jPropertyName.get(),
-                             data.boolValue);
+                m_queue->call(Callback::OnBooleanPropertyUpdated,
+                              requestID,
+                              vmiHandleLong,
+                              propertyName,
+                              static_cast<bool>(data.boolValue));
                 break;
             case rive::DataType::enumType:
-                m_queue.call("onEnumPropertyUpdated",
-                             "(JJLjava/lang/String;Ljava/"
-                             "lang/String;)V",
-                             requestID,
-                             longFromHandle(vmiHandle),
-                             jPropertyName.get(),
-                             MakeJString(env, data.stringValue).get());
+                m_queue->call(Callback::OnEnumPropertyUpdated,
+                              requestID,
+                              vmiHandleLong,
+                              propertyName,
+                              data.stringValue);
                 break;
             case rive::DataType::color:
-                m_queue.call("onColorPropertyUpdated",
-                             "(JJLjava/lang/String;I)V",
-                             requestID,
-                             longFromHandle(vmiHandle),
-                             jPropertyName.get(),
-                             data.colorValue);
+                m_queue->call(Callback::OnColorPropertyUpdated,
+                              requestID,
+                              vmiHandleLong,
+                              propertyName,
+                              static_cast<jint>(data.colorValue));
                 break;
             case rive::DataType::trigger:
-                m_queue.call("onTriggerPropertyUpdated",
-                             "(JJLjava/lang/String;)V",
-                             requestID,
-                             longFromHandle(vmiHandle),
-                             jPropertyName.get());
+                m_queue->call(Callback::OnTriggerPropertyUpdated,
+                              requestID,
+                              longFromHandle(vmiHandle),
+                              propertyName);
                 break;
             default:
                 RiveLogE(TAG,
@@ -542,19 +741,22 @@ public:
                                      std::string path,
                                      size_t size) override
     {
-        m_queue.call("onViewModelListSizeReceived", "(JI)V", requestId, size);
+        m_queue->call(Callback::OnViewModelListSizeReceived,
+                      requestId,
+                      static_cast<jint>(size));
     }
 
 private:
     constexpr static auto* TAG = "RiveN/VMIListener";
-    JCommandQueue m_queue;
+    std::shared_ptr<JCommandQueue> m_queue;
 };
 
 class ImageListener : public rive::CommandQueue::RenderImageListener
 {
 public:
-    ImageListener(JNIEnv* env, jobject jQueue) :
-        rive::CommandQueue::RenderImageListener(), m_queue(env, jQueue)
+    explicit ImageListener(std::shared_ptr<JCommandQueue> queue) :
+        rive::CommandQueue::RenderImageListener(),
+        m_queue(std::move(queue))
     {}
 
     virtual ~ImageListener() = default;
@@ -562,32 +764,28 @@ public:
     void onRenderImageDecoded(const rive::RenderImageHandle handle,
                               uint64_t requestID) override
     {
-        m_queue.call("onImageDecoded",
-                     "(JJ)V",
-                     requestID,
-                     longFromHandle(handle));
+        m_queue->call(Callback::OnImageDecoded,
+                      requestID,
+                      longFromHandle(handle));
     }
 
     void onRenderImageError(const rive::RenderImageHandle,
                             uint64_t requestID,
                             std::string error) override
     {
-        auto jError = MakeJString(GetJNIEnv(), error);
-        m_queue.call("onImageError",
-                     "(JLjava/lang/String;)V",
-                     requestID,
-                     jError.get());
+        m_queue->call(Callback::OnImageError, requestID, error);
     }
 
 private:
-    JCommandQueue m_queue;
+    std::shared_ptr<JCommandQueue> m_queue;
 };
 
 class AudioListener : public rive::CommandQueue::AudioSourceListener
 {
 public:
-    AudioListener(JNIEnv* env, jobject queue) :
-        rive::CommandQueue::AudioSourceListener(), m_queue(env, queue)
+    explicit AudioListener(std::shared_ptr<JCommandQueue> queue) :
+        rive::CommandQueue::AudioSourceListener(),
+        m_queue(std::move(queue))
     {}
 
     virtual ~AudioListener() = default;
@@ -595,32 +793,28 @@ public:
     void onAudioSourceDecoded(const rive::AudioSourceHandle handle,
                               uint64_t requestID) override
     {
-        m_queue.call("onAudioDecoded",
-                     "(JJ)V",
-                     requestID,
-                     longFromHandle(handle));
+        m_queue->call(Callback::OnAudioDecoded,
+                      requestID,
+                      longFromHandle(handle));
     }
 
     void onAudioSourceError(const rive::AudioSourceHandle,
                             uint64_t requestID,
                             std::string error) override
     {
-        auto jError = MakeJString(GetJNIEnv(), error);
-        m_queue.call("onAudioError",
-                     "(JLjava/lang/String;)V",
-                     requestID,
-                     jError.get());
+        m_queue->call(Callback::OnAudioError, requestID, error);
     }
 
 private:
-    JCommandQueue m_queue;
+    std::shared_ptr<JCommandQueue> m_queue;
 };
 
 class FontListener : public rive::CommandQueue::FontListener
 {
 public:
-    FontListener(JNIEnv* env, jobject jQueue) :
-        rive::CommandQueue::FontListener(), m_queue(env, jQueue)
+    explicit FontListener(std::shared_ptr<JCommandQueue> queue) :
+        rive::CommandQueue::FontListener(),
+        m_queue(std::move(queue))
     {}
 
     virtual ~FontListener() = default;
@@ -628,28 +822,25 @@ public:
     void onFontDecoded(const rive::FontHandle handle,
                        uint64_t requestID) override
     {
-        m_queue.call("onFontDecoded",
-                     "(JJ)V",
-                     requestID,
-                     longFromHandle(handle));
+        m_queue->call(Callback::OnFontDecoded,
+                      requestID,
+                      longFromHandle(handle));
     }
 
     void onFontError(const rive::FontHandle,
                      uint64_t requestID,
                      std::string error) override
     {
-        auto jError = MakeJString(GetJNIEnv(), error);
-        m_queue.call("onFontError",
-                     "(JLjava/lang/String;)V",
-                     requestID,
-                     jError.get());
+        m_queue->call(Callback::OnFontError, requestID, error);
     }
 
 private:
-    JCommandQueue m_queue;
+    std::shared_ptr<JCommandQueue> m_queue;
 };
 
 /** Typedef for the below setProperty function. */
+static void markScenesChanged(jlong ref);
+
 template <typename T>
 using PropertySetter =
     void (rive::CommandQueue::*)(rive::ViewModelInstanceHandle,
@@ -674,6 +865,7 @@ void setProperty(JNIEnv* env,
                             propertyPath,
                             std::move(value),
                             0); // Pass 0 for requestID
+    markScenesChanged(ref);
 }
 
 /** Typedef for the below getProperty function. */
@@ -699,6 +891,37 @@ void getProperty(JNIEnv* env,
 
 constexpr static auto* TAG_CQ = "RiveN/CQ";
 
+/**
+ * A render image whose pixels are decoded off the command server thread.
+ *
+ * It starts with the dimensions read from the encoded image's header and no
+ * texture, which the renderer draws as nothing, until complete() hands it the
+ * uploaded texture. Only accessed from the command server thread.
+ */
+class DeferredRenderImage : public rive::RiveRenderImage
+{
+public:
+    DeferredRenderImage(uint32_t width, uint32_t height) :
+        rive::RiveRenderImage(static_cast<int>(width), static_cast<int>(height))
+    {}
+
+    /** Takes the texture of uploaded, the decoded pixels' render image. */
+    void complete(const rive::rcp<rive::RenderImage>& uploaded)
+    {
+        auto* image =
+            rive::lite_rtti_cast<rive::RiveRenderImage*>(uploaded.get());
+        if (image == nullptr)
+        {
+            return;
+        }
+        // The header should agree with the decoder, but the texture must
+        // match whatever was actually decoded.
+        m_Width = image->width();
+        m_Height = image->height();
+        resetTexture(image->refTexture());
+    }
+};
+
 /**
  * A factory for use with the command server.
  *
@@ -708,30 +931,87 @@ constexpr static auto* TAG_CQ = "RiveN/CQ";
  * For buffers, we defer to the existing rive::gpu::RenderContext's
  * implementation, since it is itself a factory.
  *
- * For decoding images, we pass to a method that performs Kotlin decoding.
+ * For decoding images, we pass to a method that performs Kotlin decoding. When
+ * the image's dimensions can be read from its header, that runs on a decode
+ * pool and a DeferredRenderImage stands in for the image, so that only the
+ * texture upload runs on the command server thread. Otherwise the image is
+ * decoded in place.
+ *
+ * Fonts and audio keep the base class implementations. They make no JNI calls
+ * and are parsed lazily by the runtime, and unlike an image there is no empty
+ * stand-in that the runtime could use until they are ready.
  *
  * Ideally this would subclass RenderContext to only override decoding images,
  * but it's constructor is effectively hidden behind the static MakeContext
  * function. So instead this class wraps and delegates to it instead.
  *
- * This class must not outlive the passed renderContext, which is held as a raw
- * pointer.
+ * This class must not outlive the passed renderContext, commandQueue, or
+ * drawDirtyTracker, which are held as raw pointers.
  */
 class CommandServerFactory : public rive::RiveRenderFactory
 {
 public:
-    explicit CommandServerFactory(RenderContext* renderContext) :
-        m_renderContext(renderContext)
+    CommandServerFactory(RenderContext* renderContext,
+                         rive::CommandQueue* commandQueue,
+                         DrawDirtyTracker* drawDirtyTracker) :
+        m_renderContext(renderContext),
+        m_commandQueue(commandQueue),
+        m_drawDirtyTracker(drawDirtyTracker)
     {}
     ~CommandServerFactory() override = default;
 
     rive::rcp<rive::RenderImage> decodeImage(
         rive::Span<const uint8_t> encodedBytes) override
     {
-        RiveLogD("RiveN/CQFactory", "Decoding encoded image");
-        return renderImageFromAndroidDecode(encodedBytes,
-                                            false,
-                                            m_renderContext);
+        uint32_t width = 0;
+        uint32_t height = 0;
+        if (!readEncodedImageSize(encodedBytes, &width, &height))
+        {
+            RiveLogD("RiveN/CQFactory", "Decoding encoded image");
+            return renderImageFromAndroidDecode(encodedBytes,
+                                                false,
+                                                m_renderContext);
+        }
+
+        RiveLogD("RiveN/CQFactory",
+                 "Decoding encoded %ux%u image in the background",
+                 width,
+                 height);
+        auto image = rive::make_rcp<DeferredRenderImage>(width, height);
+        decodePool().run(
+            [commandQueue = m_commandQueue,
+             drawDirtyTracker = m_drawDirtyTracker,
+             image,
+             encoded = std::vector<uint8_t>(
+                 encodedBytes.data(),
+                 encodedBytes.data() + encodedBytes.size())]() {
+                auto decoded = std::make_shared<DecodedImage>();
+                decoded->pixels = decodeToRGBA(
+                    rive::Span<const uint8_t>(encoded.data(), encoded.size()),
+                    false,
+                    &decoded->width,
+                    &decoded->height);
+                if (decoded->pixels == nullptr)
+                {
+                    RiveLogE("RiveN/CQFactory",
+                             "Background image decode failed");
+                    return;
+                }
+                commandQueue->runOnce(
+                    [drawDirtyTracker, image, decoded](
+                        rive::CommandServer* server) {
+                        auto factory = reinterpret_cast<CommandServerFactory*>(
+                            server->factory());
+                        image->complete(
+                            factory->getRenderContext()->createRenderImage(
+                                decoded->width,
+                                decoded->height,
+                                std::move(decoded->pixels)));
+                        // Scenes drawing the image have only drawn it empty.
+                        drawDirtyTracker->touchAll();
+                    });
+            });
+        return image;
     }
 
     rive::rcp<rive::RenderBuffer> makeRenderBuffer(
@@ -755,7 +1035,37 @@ public:
     RenderContext* getRenderContext() { return m_renderContext; }
 
 private:
+    static constexpr size_t kMaxDecodeThreads = 2;
+
+    struct DecodedImage
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::unique_ptr<uint8_t[]> pixels;
+    };
+
+    /**
+     * The pool for image decodes, started on first use. Destroyed with this
+     * factory, dropping decodes that have not started.
+     */
+    DecodePool& decodePool()
+    {
+        if (m_decodePool == nullptr)
+        {
+            const size_t cores = std::thread::hardware_concurrency();
+            const size_t threads =
+                std::clamp<size_t>(cores > 1 ? cores - 1 : 1,
+                                   1,
+                                   kMaxDecodeThreads);
+            m_decodePool = std::make_unique<DecodePool>(threads, "Rive Decode");
+        }
+        return *m_decodePool;
+    }
+
     RenderContext* const m_renderContext = nullptr;
+    rive::CommandQueue* const m_commandQueue = nullptr;
+    DrawDirtyTracker* const m_drawDirtyTracker = nullptr;
+    std::unique_ptr<DecodePool> m_decodePool;
 };
 
 /**
@@ -770,14 +1080,21 @@ public:
     /**
      * Starts the command server thread.
      *
+     * Commands may be enqueued as soon as this returns. They are buffered in
+     * the queue until the command server begins serving, or are never served
+     * if startup fails.
+     *
      * @param renderContext The render context to use in the command server
      * thread. Its resources will be created and destroyed within the thread,
      * but the object itself must still be managed by the caller and outlive the
      * thread.
-     * @param promise A promise to signal startup success or failure.
+     * @param onStartup Called once on the command server thread to signal
+     * startup success or failure. The thread is attached to the JVM during the
+     * call unless attaching was what failed.
      */
-    void startCommandServer(RenderContext* renderContext,
-                            std::promise<StartupResult>&& promise)
+    void startCommandServer(
+        RenderContext* renderContext,
+        std::function<void(const StartupResult&)> onStartup)
     {
         // Wrap command queue in an RCP, adding +1 ref with ref_rcp.
         // Before this RCP falls out of scope (-1) it is copied (+1) into the
@@ -786,8 +1103,8 @@ public:
 
         m_commandServerThread = std::thread([renderContext,
                                              self,
-                                             promise =
-                                                 std::move(promise)]() mutable {
+                                             onStartup = std::move(
+                                                 onStartup)]() mutable {
             self->m_commandServerThreadId = std::this_thread::get_id();
             const auto THREAD_NAME = "Rive CmdServer";
             JNIEnv* env = nullptr;
@@ -801,7 +1118,7 @@ public:
                 RiveLogE(TAG_CQ,
                          "Failed to attach command server thread to JVM: %d",
                          attachResult);
-                promise.set_value(
+                onStartup(
                     {false, EGL_BAD_ALLOC, "Failed to attach thread to JVM"});
                 return;
             }
@@ -825,6 +1142,8 @@ public:
             RiveLogD(TAG_CQ, "Setting command server thread name");
             // Set the native thread name
             pthread_setname_np(pthread_self(), THREAD_NAME);
+            // Keep the command server, which draws, off the slowest cores.
+            setAffinity(Affinity::Performance);
             // Set the JVM thread name
             // Scope the JniResource objects to fall out of scope and delete
             // local refs before detaching the thread (which makes the JNIEnv
@@ -855,13 +1174,15 @@ public:
                 RiveLogE(TAG_CQ,
                          "Failed to initialize the Rive render context");
                 renderContext->destroy();
-                promise.set_value(result);
+                onStartup(result);
                 return;
             }
 
             // Stack allocated factory for the command server
             RiveLogD(TAG_CQ, "Creating command server factory");
-            auto factory = CommandServerFactory(renderContext);
+            auto factory = CommandServerFactory(renderContext,
+                                                self.get(),
+                                                &self->m_drawDirtyTracker);
 
             // Stack allocated command server
             // Takes a copy of this object's RCP, increasing the ref count to 3,
@@ -869,8 +1190,8 @@ public:
             RiveLogD(TAG_CQ, "Creating command server");
             auto commandServer = rive::CommandServer(self, &factory);
 
-            // Signal success and unblock the main thread
-            promise.set_value(
+            // Signal success, unblocking the main thread if it is waiting
+            onStartup(
                 {true, EGL_SUCCESS, "Command Server started successfully"});
 
             // Begin the serving loop. This will "block" the thread until
@@ -913,6 +1234,35 @@ public:
         }
     }
 
+    /**
+     * Sets the Kotlin callback receiver shared by this queue's listeners, used
+     * to flush batched messages after polling. Held weakly since the listeners
+     * own it and are deleted separately from this queue.
+     */
+    void setCallbacks(const std::shared_ptr<JCommandQueue>& callbacks)
+    {
+        m_callbacks = callbacks;
+    }
+
+    /** Sets or clears the direct ByteBuffer for batched message delivery. */
+    void setMessageBuffer(JNIEnv* env, jobject jBuffer)
+    {
+        if (auto callbacks = m_callbacks.lock())
+        {
+            callbacks->setMessageBuffer(env, jBuffer);
+        }
+    }
+
+    /** Processes pending messages, then delivers any batched messages. */
+    void pollMessages()
+    {
+        processMessages();
+        if (auto callbacks = m_callbacks.lock())
+        {
+            callbacks->flushMessageBatch();
+        }
+    }
+
     void setTracingEnabled(bool enabled) { m_tracingEnabled = enabled; }
     bool tracingEnabled() const { return m_tracingEnabled; }
     bool isCurrentThreadCommandServer() const
@@ -938,39 +1288,497 @@ public:
         return m_stateMachineNullKeys.insert(key).second;
     }
 
+    /** Issues a new property handle ID. Called from the JNI calling thread. */
+    uint64_t nextPropertyHandle() { return m_nextPropertyHandle++; }
+
+    /** Resolved property handles. Only use on the command server thread. */
+    PropertyHandleTable& propertyHandles() { return m_propertyHandles; }
+
+    /**
+     * Records the view model instance bound to a state machine, so that
+     * batched advances keep state machines sharing an instance on one thread.
+     * Called from the JNI calling thread, where binds are issued.
+     */
+    void setBoundViewModelInstance(uint64_t stateMachine,
+                                   uint64_t viewModelInstance)
+    {
+        m_boundViewModelInstances[stateMachine] = viewModelInstance;
+    }
+
+    /** Forgets a deleted state machine's binding. */
+    void removeBoundViewModelInstance(uint64_t stateMachine)
+    {
+        m_boundViewModelInstances.erase(stateMachine);
+    }
+
+    /** The view model instance bound to a state machine, or 0 if none. */
+    uint64_t boundViewModelInstance(uint64_t stateMachine) const
+    {
+        auto it = m_boundViewModelInstances.find(stateMachine);
+        return it != m_boundViewModelInstances.end() ? it->second : 0;
+    }
+
+    /**
+     * Which draw keys' scenes changed since they last presented. Only use on
+     * the command server thread.
+     */
+    DrawDirtyTracker& drawDirtyTracker() { return m_drawDirtyTracker; }
+
+    /**
+     * Marks every scene changed once the commands issued so far have run.
+     * Called from the JNI calling thread after a command that the command
+     * server applies without reporting it, such as a path based property set.
+     */
+    void markScenesChanged()
+    {
+        runOnce([this](rive::CommandServer*) {
+            m_drawDirtyTracker.touchAll();
+        });
+    }
+
+    /**
+     * Adds to the advance time to attribute to the next frame drawn. Only use
+     * on the command server thread.
+     */
+    void addAdvanceTime(std::chrono::steady_clock::duration duration)
+    {
+        m_pendingAdvanceNanos += FrameRecord::Nanos(duration);
+    }
+
+    /**
+     * Records a drawn frame, attributing to it the advance time added since
+     * the previous one, whichever state machines it was for. Only use on the
+     * command server thread.
+     */
+    void addFrame(FrameRecord record)
+    {
+        record.advanceNanos = std::exchange(m_pendingAdvanceNanos, 0);
+        m_frameStats.add(record);
+    }
+
+    /** Timings of the most recent frames drawn, for every surface. */
+    const FrameStats& frameStats() const { return m_frameStats; }
+
+    /**
+     * Counts an asynchronous readback as queued. Called on the JNI calling
+     * thread before queuing the readback's commands.
+     */
+    void readbackQueued()
+    {
+        m_queuedReadbacks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Counts a queued asynchronous readback as drawn. Only use on the command
+     * server thread.
+     *
+     * @return true if no other readback is queued after it.
+     */
+    bool readbackDrawn()
+    {
+        return m_queuedReadbacks.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    /**
+     * The pool for parallel batched advances, started on first use with a
+     * thread for each other core. Only use on the command server thread.
+     */
+    WorkStealingPool& advancePool()
+    {
+        if (m_advancePool == nullptr)
+        {
+            const size_t cores = std::thread::hardware_concurrency();
+            const size_t threads =
+                std::min(kMaxAdvanceThreads, cores > 1 ? cores - 1 : 0);
+            m_advancePool =
+                std::make_unique<WorkStealingPool>(threads, "Rive Advance");
+        }
+        return *m_advancePool;
+    }
+
 private:
+    static constexpr size_t kMaxAdvanceThreads = 7;
+
     std::thread m_commandServerThread;
     std::thread::id m_commandServerThreadId;
     // CommandQueue JNI calls are currently required to run on the main
     // thread, so this remains a plain bool. If it changes to accept commands
     // from other threads, this should become atomic.
     bool m_tracingEnabled = false;
+    std::weak_ptr<JCommandQueue> m_callbacks;
     // Holds that an error has been reported, to avoid log spam
     std::unordered_set<rive::DrawKey> m_artboardNullKeys;
     std::unordered_set<rive::DrawKey> m_stateMachineNullKeys;
+    // Like m_tracingEnabled, only issued from the main thread.
+    uint64_t m_nextPropertyHandle = 1;
+    PropertyHandleTable m_propertyHandles;
+    // State machine handle to bound view model instance handle. Like
+    // m_nextPropertyHandle, only used from the main thread.
+    std::unordered_map<uint64_t, uint64_t> m_boundViewModelInstances;
+    std::unique_ptr<WorkStealingPool> m_advancePool;
+    DrawDirtyTracker m_drawDirtyTracker;
+    // Only written on the command server thread.
+    int64_t m_pendingAdvanceNanos = 0;
+    FrameStats m_frameStats;
+    // Asynchronous readbacks queued but not yet drawn.
+    std::atomic<uint32_t> m_queuedReadbacks{0};
+};
+
+static void markScenesChanged(jlong ref)
+{
+    reinterpret_cast<CommandQueueWithThread*>(ref)->markScenesChanged();
+}
+
+/**
+ * A generic setter for properties addressed by a handle from cppResolveProperty.
+ *
+ * On the command server thread, the value is applied straight to the cached
+ * property runtime. If the handle's path no longer resolves, the equivalent
+ * path based command is sent instead, so that the failure is reported through
+ * the view model instance error callback exactly as for a path based set.
+ *
+ * @param lookup Resolves the property runtime from its instance and path.
+ * @param apply Sets the value on the resolved runtime.
+ * @param fallback The path based setter used to report resolution failures.
+ */
+template <typename T, typename Lookup, typename Apply>
+static void setPropertyByHandle(jlong ref,
+                                jlong jPropertyHandle,
+                                PropertyKind kind,
+                                T value,
+                                Lookup lookup,
+                                Apply apply,
+                                PropertySetter<T> fallback)
+{
+    auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+    auto id = static_cast<uint64_t>(jPropertyHandle);
+
+    commandQueue->runOnce(
+        [=, value = std::move(value)](rive::CommandServer* server) {
+            commandQueue->drawDirtyTracker().touchAll();
+            auto& handles = commandQueue->propertyHandles();
+            auto* property = handles.find(id);
+            if (property == nullptr)
+            {
+                RiveLogW(TAG_CQ,
+                         "Ignoring set of released property handle %llu",
+                         static_cast<unsigned long long>(id));
+                return;
+            }
+            auto* runtime = handles.resolve(server, *property, kind, lookup);
+            if (runtime == nullptr)
+            {
+                (commandQueue->*fallback)(property->viewModelInstance,
+                                          property->path,
+                                          value,
+                                          0);
+                return;
+            }
+            apply(runtime, value);
+        });
+}
+
+/** Update tags in a PropertyBatch. Must match PropertyBatch.kt. */
+enum class PropertyBatchTag : uint8_t
+{
+    number = 0,
+    boolean = 1,
+    color = 2,
+    enumIndex = 3,
+    string = 4,
+    trigger = 5,
+};
+
+/** Reads the fields of a packed PropertyBatch, bounds checking each read. */
+class PropertyBatchReader
+{
+public:
+    explicit PropertyBatchReader(const std::vector<uint8_t>& bytes) :
+        m_data(bytes.data()), m_remaining(bytes.size())
+    {}
+
+    bool done() const { return m_remaining == 0; }
+
+    template <typename T> bool read(T* out)
+    {
+        if (m_remaining < sizeof(T))
+        {
+            return false;
+        }
+        std::memcpy(out, m_data, sizeof(T));
+        advance(sizeof(T));
+        return true;
+    }
+
+    bool readString(std::string* out)
+    {
+        uint32_t length = 0;
+        if (!read(&length) || m_remaining < length)
+        {
+            return false;
+        }
+        out->assign(reinterpret_cast<const char*>(m_data), length);
+        advance(length);
+        return true;
+    }
+
+private:
+    void advance(size_t count)
+    {
+        m_data += count;
+        m_remaining -= count;
+    }
+
+    const uint8_t* m_data;
+    size_t m_remaining;
 };
 
 /**
- * Execute one traced state machine advance on the command server thread.
+ * Apply a packed PropertyBatch on the command server thread.
+ *
+ * Runs as a single runOnce command, so every update lands between the same
+ * two advances. Updates whose handle no longer resolves are reported like
+ * setPropertyByHandle does, by sending the path based command, and do not
+ * stop the rest of the batch.
+ */
+static void applyPropertyBatch(CommandQueueWithThread* commandQueue,
+                               rive::CommandServer* server,
+                               const std::vector<uint8_t>& bytes)
+{
+    auto& handles = commandQueue->propertyHandles();
+    PropertyBatchReader reader(bytes);
+    while (!reader.done())
+    {
+        uint8_t tag = 0;
+        uint64_t id = 0;
+        if (!reader.read(&tag) || !reader.read(&id))
+        {
+            RiveLogE(TAG_CQ, "Truncated property batch");
+            return;
+        }
+        auto* property = handles.find(id);
+        if (property == nullptr)
+        {
+            RiveLogW(TAG_CQ,
+                     "Ignoring batched update of released property handle "
+                     "%llu",
+                     static_cast<unsigned long long>(id));
+        }
+
+        bool complete = true;
+        switch (static_cast<PropertyBatchTag>(tag))
+        {
+            case PropertyBatchTag::number:
+            {
+                float value = 0.0f;
+                complete = reader.read(&value);
+                if (!complete || property == nullptr)
+                {
+                    break;
+                }
+                auto* runtime = handles.resolve(
+                    server,
+                    *property,
+                    PropertyKind::number,
+                    [](rive::ViewModelInstanceRuntime* instance,
+                       const std::string& path) {
+                        return instance->propertyNumber(path);
+                    });
+                if (runtime != nullptr)
+                {
+                    runtime->value(value);
+                }
+                else
+                {
+                    commandQueue->setViewModelInstanceNumber(
+                        property->viewModelInstance,
+                        property->path,
+                        value,
+                        0);
+                }
+                break;
+            }
+            case PropertyBatchTag::boolean:
+            {
+                uint8_t value = 0;
+                complete = reader.read(&value);
+                if (!complete || property == nullptr)
+                {
+                    break;
+                }
+                auto* runtime = handles.resolve(
+                    server,
+                    *property,
+                    PropertyKind::boolean,
+                    [](rive::ViewModelInstanceRuntime* instance,
+                       const std::string& path) {
+                        return instance->propertyBoolean(path);
+                    });
+                if (runtime != nullptr)
+                {
+                    runtime->value(value != 0);
+                }
+                else
+                {
+                    commandQueue->setViewModelInstanceBool(
+                        property->viewModelInstance,
+                        property->path,
+                        value != 0,
+                        0);
+                }
+                break;
+            }
+            case PropertyBatchTag::color:
+            {
+                uint32_t value = 0;
+                complete = reader.read(&value);
+                if (!complete || property == nullptr)
+                {
+                    break;
+                }
+                auto* runtime = handles.resolve(
+                    server,
+                    *property,
+                    PropertyKind::color,
+                    [](rive::ViewModelInstanceRuntime* instance,
+                       const std::string& path) {
+                        return instance->propertyColor(path);
+                    });
+                if (runtime != nullptr)
+                {
+                    runtime->value(static_cast<int>(value));
+                }
+                else
+                {
+                    commandQueue->setViewModelInstanceColor(
+                        property->viewModelInstance,
+                        property->path,
+                        value,
+                        0);
+                }
+                break;
+            }
+            case PropertyBatchTag::enumIndex:
+            {
+                uint32_t value = 0;
+                complete = reader.read(&value);
+                if (!complete || property == nullptr)
+                {
+                    break;
+                }
+                auto* runtime = handles.resolve(
+                    server,
+                    *property,
+                    PropertyKind::enumeration,
+                    [](rive::ViewModelInstanceRuntime* instance,
+                       const std::string& path) {
+                        return instance->propertyEnum(path);
+                    });
+                if (runtime != nullptr)
+                {
+                    runtime->valueIndex(value);
+                }
+                else
+                {
+                    // There is no index based command to report through.
+                    RiveLogE(TAG_CQ,
+                             "Enum property %s not found",
+                             property->path.c_str());
+                }
+                break;
+            }
+            case PropertyBatchTag::string:
+            {
+                std::string value;
+                complete = reader.readString(&value);
+                if (!complete || property == nullptr)
+                {
+                    break;
+                }
+                auto* runtime = handles.resolve(
+                    server,
+                    *property,
+                    PropertyKind::string,
+                    [](rive::ViewModelInstanceRuntime* instance,
+                       const std::string& path) {
+                        return instance->propertyString(path);
+                    });
+                if (runtime != nullptr)
+                {
+                    runtime->value(value);
+                }
+                else
+                {
+                    commandQueue->setViewModelInstanceString(
+                        property->viewModelInstance,
+                        property->path,
+                        std::move(value),
+                        0);
+                }
+                break;
+            }
+            case PropertyBatchTag::trigger:
+            {
+                if (property == nullptr)
+                {
+                    break;
+                }
+                auto* runtime = handles.resolve(
+                    server,
+                    *property,
+                    PropertyKind::trigger,
+                    [](rive::ViewModelInstanceRuntime* instance,
+                       const std::string& path) {
+                        return instance->propertyTrigger(path);
+                    });
+                if (runtime != nullptr)
+                {
+                    runtime->trigger();
+                }
+                else
+                {
+                    commandQueue->fireViewModelTrigger(
+                        property->viewModelInstance,
+                        property->path);
+                }
+                break;
+            }
+            default:
+                RiveLogE(TAG_CQ, "Unknown property batch tag %u", tag);
+                return;
+        }
+        if (!complete)
+        {
+            RiveLogE(TAG_CQ, "Truncated property batch");
+            return;
+        }
+    }
+}
+
+/**
+ * Execute one state machine advance on the command server thread.
  *
  * Necessary because command server's advance command cannot be extended to
- * include tracing. To avoid three queued messages for trace begin/advance/end,
- * we advance directly in one runOnce callback.
+ * include tracing, nor report whether the advance changed the scene for draw
+ * skipping. To avoid three queued messages for trace begin/advance/end, we
+ * advance directly in one runOnce callback.
  *
  * If the passed state machine handle fails to resolve or if the advance would
  * cause a settle, we send an additional advance command to ensure the error or
  * settled handlers respectively are called. That command must reuse requestID
  * so the callback remains associated with the direct advance that produced it.
  */
-static void executeTracedAdvanceWork(
-    const Tracer* tracer,
-    rive::CommandQueue* commandQueue,
-    rive::CommandServer* server,
-    uint64_t requestID,
-    rive::StateMachineHandle stateMachineHandle,
-    float_t deltaSeconds)
+template <typename TracerType>
+static void executeAdvanceWork(const TracerType* tracer,
+                               CommandQueueWithThread* commandQueue,
+                               rive::CommandServer* server,
+                               uint64_t requestID,
+                               rive::StateMachineHandle stateMachineHandle,
+                               float_t deltaSeconds)
 {
-    TraceScope<Tracer> advanceTrace(*tracer, "Rive/Frame/Advance");
+    [[maybe_unused]] TraceScope<TracerType> advanceTrace(*tracer,
+                                                         "Rive/Frame/Advance");
+    const auto advanceStart = std::chrono::steady_clock::now();
     auto* stateMachine = server->getStateMachineInstance(stateMachineHandle);
 
     // When the state machine handle fails to resolve, preserve existing error
@@ -983,20 +1791,319 @@ static void executeTracedAdvanceWork(
         return;
     }
 
+    const bool changed = stateMachine->advanceAndApply(deltaSeconds);
+    commandQueue->addAdvanceTime(std::chrono::steady_clock::now() -
+                                 advanceStart);
+    commandQueue->drawDirtyTracker().advanced(
+        static_cast<uint64_t>(stateMachineHandle),
+        changed);
+
     // If the advance results in the state machine settling, preserve settled
     // callback behavior with an extra command to advance by 0.
-    if (!stateMachine->advanceAndApply(deltaSeconds))
+    if (!changed)
     {
         commandQueue->advanceStateMachine(stateMachineHandle, 0.0f, requestID);
     }
 }
 
+/**
+ * State machines from one cppAdvanceStateMachines call, ordered into groups
+ * that are independent of each other. Each group is stateMachines
+ * [groupEnds[i - 1], groupEnds[i]), advanced in the order they were added.
+ */
+struct AdvanceBatch
+{
+    std::vector<rive::StateMachineHandle> stateMachines;
+    std::vector<uint32_t> groupEnds;
+};
+
+/**
+ * Groups (artboard, state machine) pairs so that state machines sharing an
+ * artboard, or a directly bound view model instance, land in the same group.
+ * Called on the JNI calling thread, where the bindings are tracked.
+ */
+static AdvanceBatch groupIndependentAdvances(
+    const CommandQueueWithThread* commandQueue,
+    const jlong* pairs,
+    uint32_t count)
+{
+    // Union-find over the pairs, joining each to the first pair that shares
+    // its artboard or bound instance.
+    std::vector<uint32_t> parent(count);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&](uint32_t i) {
+        while (parent[i] != i)
+        {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    auto unite = [&](uint32_t a, uint32_t b) { parent[find(a)] = find(b); };
+
+    std::unordered_map<uint64_t, uint32_t> firstByArtboard;
+    std::unordered_map<uint64_t, uint32_t> firstByInstance;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto artboard = static_cast<uint64_t>(pairs[i * 2]);
+        auto stateMachine = static_cast<uint64_t>(pairs[i * 2 + 1]);
+        auto [artboardIt, newArtboard] = firstByArtboard.emplace(artboard, i);
+        if (!newArtboard)
+        {
+            unite(i, artboardIt->second);
+        }
+        auto instance = commandQueue->boundViewModelInstance(stateMachine);
+        if (instance != 0)
+        {
+            auto [instanceIt, newInstance] =
+                firstByInstance.emplace(instance, i);
+            if (!newInstance)
+            {
+                unite(i, instanceIt->second);
+            }
+        }
+    }
+
+    // Number the groups by first appearance, then lay them out contiguously,
+    // keeping batch order within each.
+    std::vector<uint32_t> groupOf(count);
+    std::vector<uint32_t> groupSizes;
+    std::unordered_map<uint32_t, uint32_t> groupByRoot;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto [it, isNew] = groupByRoot.emplace(
+            find(i),
+            static_cast<uint32_t>(groupSizes.size()));
+        if (isNew)
+        {
+            groupSizes.push_back(0);
+        }
+        groupOf[i] = it->second;
+        groupSizes[it->second]++;
+    }
+
+    AdvanceBatch batch;
+    batch.groupEnds.resize(groupSizes.size());
+    std::partial_sum(groupSizes.begin(),
+                     groupSizes.end(),
+                     batch.groupEnds.begin());
+    std::vector<uint32_t> next(groupSizes.size());
+    std::transform(batch.groupEnds.begin(),
+                   batch.groupEnds.end(),
+                   groupSizes.begin(),
+                   next.begin(),
+                   std::minus<uint32_t>());
+    batch.stateMachines.resize(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        batch.stateMachines[next[groupOf[i]]++] =
+            handleFromLong<rive::StateMachineHandle>(pairs[i * 2 + 1]);
+    }
+    return batch;
+}
+
+/**
+ * Advances a batch of state machines, optionally fanning the independent
+ * groups out across the advance pool and joining before returning, so that
+ * draws queued after the batch see every state machine advanced.
+ *
+ * Only the advance itself runs on the pool. Resolving handles and reporting
+ * errors and settles happen on the command server thread, the latter through
+ * the standard command as in executeAdvanceWork, reusing requestID.
+ */
+template <typename TracerType>
+static void executeAdvanceBatch(const TracerType* tracer,
+                                CommandQueueWithThread* commandQueue,
+                                rive::CommandServer* server,
+                                uint64_t requestID,
+                                const AdvanceBatch& batch,
+                                float_t deltaSeconds,
+                                bool parallel)
+{
+    [[maybe_unused]] TraceScope<TracerType> advanceTrace(
+        *tracer,
+        "Rive/Frame/AdvanceBatch");
+    const auto advanceStart = std::chrono::steady_clock::now();
+
+    const size_t count = batch.stateMachines.size();
+    std::vector<rive::StateMachineInstance*> instances(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        instances[i] =
+            server->getStateMachineInstance(batch.stateMachines[i]);
+        if (instances[i] == nullptr)
+        {
+            // Report the error through the standard command.
+            commandQueue->advanceStateMachine(batch.stateMachines[i],
+                                              deltaSeconds,
+                                              requestID);
+        }
+    }
+
+    // Not a vector<bool>, whose elements share bytes across groups.
+    std::vector<uint8_t> settled(count, 0);
+    auto advanceGroup = [&](size_t group) {
+        const uint32_t begin = group == 0 ? 0 : batch.groupEnds[group - 1];
+        for (uint32_t i = begin; i < batch.groupEnds[group]; i++)
+        {
+            if (instances[i] != nullptr)
+            {
+                settled[i] = !instances[i]->advanceAndApply(deltaSeconds);
+            }
+        }
+    };
+    const size_t groupCount = batch.groupEnds.size();
+    if (parallel && groupCount > 1)
+    {
+        commandQueue->advancePool().parallelFor(groupCount, advanceGroup);
+    }
+    else
+    {
+        for (size_t group = 0; group < groupCount; group++)
+        {
+            advanceGroup(group);
+        }
+    }
+    commandQueue->addAdvanceTime(std::chrono::steady_clock::now() -
+                                 advanceStart);
+
+    auto& dirtyTracker = commandQueue->drawDirtyTracker();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (instances[i] == nullptr)
+        {
+            continue;
+        }
+        dirtyTracker.advanced(static_cast<uint64_t>(batch.stateMachines[i]),
+                              !settled[i]);
+        if (settled[i])
+        {
+            commandQueue->advanceStateMachine(batch.stateMachines[i],
+                                              0.0f,
+                                              requestID);
+        }
+    }
+}
+
+/** Pointer actions in a PointerEventBatch. Must match PointerEventBatch.kt. */
+enum class PointerAction : uint8_t
+{
+    move = 0,
+    down = 1,
+    up = 2,
+    exit = 3,
+};
+
+/** One event of a PointerEventBatch, unpacked on the calling thread. */
+struct PointerSample
+{
+    PointerAction action;
+    int pointerID;
+    rive::Vec2D position;
+};
+
+/**
+ * Replay a batch of pointer events on the command server thread.
+ *
+ * Equivalent to the command server handling one pointer command per sample,
+ * but the state machine is resolved and the surface-to-artboard transform is
+ * computed once for the whole batch.
+ *
+ * If the state machine handle fails to resolve, the first sample is sent as a
+ * standard pointer command so the error callback fires exactly as it would
+ * have for unbatched events.
+ */
+static void executePointerEvents(rive::CommandQueue* commandQueue,
+                                 rive::CommandServer* server,
+                                 rive::StateMachineHandle stateMachineHandle,
+                                 rive::CommandQueue::PointerEvent layout,
+                                 const std::vector<PointerSample>& samples)
+{
+    auto* stateMachine = server->getStateMachineInstance(stateMachineHandle);
+    if (stateMachine == nullptr)
+    {
+        layout.position = samples.front().position;
+        layout.pointerId = samples.front().pointerID;
+        commandQueue->pointerMove(stateMachineHandle, layout);
+        return;
+    }
+
+    auto surfaceBounds =
+        rive::AABB(0.0f, 0.0f, layout.screenBounds.x, layout.screenBounds.y);
+    auto inverse = rive::computeAlignment(layout.fit,
+                                          layout.alignment,
+                                          surfaceBounds,
+                                          stateMachine->bounds(),
+                                          layout.scaleFactor)
+                       .invertOrIdentity();
+
+    for (const auto& sample : samples)
+    {
+        auto position = inverse * sample.position;
+        switch (sample.action)
+        {
+            case PointerAction::move:
+                stateMachine->pointerMove(position, 0.0f, sample.pointerID);
+                break;
+            case PointerAction::down:
+                stateMachine->pointerDown(position, sample.pointerID);
+                break;
+            case PointerAction::up:
+                stateMachine->pointerUp(position, sample.pointerID);
+                break;
+            case PointerAction::exit:
+                stateMachine->pointerExit(position, sample.pointerID);
+                break;
+        }
+    }
+}
+
+/**
+ * Present the frame that a pipelined draw left flushed but not presented to
+ * the surface, if any.
+ */
+template <typename TracerType>
+static void presentPendingFrame(const TracerType* tracer,
+                                RenderContext* renderContext,
+                                RenderSurface* nativeSurface)
+{
+    if (!nativeSurface->hasPendingPresent())
+    {
+        return;
+    }
+    [[maybe_unused]] TraceScope<TracerType> presentTrace(
+        *tracer,
+        "Rive/Frame/Draw/Present");
+    const auto flushedAt = nativeSurface->takePendingPresent();
+    const auto presentStart = FramePipelineStats::Clock::now();
+    renderContext->present(nativeSurface);
+    auto& stats = nativeSurface->pipelineStats();
+    stats.addDeferredPresent(presentStart - flushedAt);
+    stats.addPresent(FramePipelineStats::Clock::now() - presentStart);
+}
+
 /**
  * Execute one draw on the command server thread.
  *
  * This helper is templated so traced and non-traced paths share one draw
  * implementation without duplicating frame logic. The tracer type is chosen
  * at the call site (`Tracer` or `NoopTracer`).
+ *
+ * A pipelined draw flushes its frame but defers the present, which can block
+ * on the display, until the surface's next draw. The GPU finishes the frame
+ * while the server runs the commands queued before that draw, which presents
+ * the previous frame first, then begins its own target, records and flushes.
+ * This keeps one frame in flight and trades a frame of latency for keeping
+ * the server busy while presents would have blocked it.
+ *
+ * A draw that would repeat the frame the surface already shows, because its
+ * scene and inputs are unchanged since the draw key's last frame, is skipped
+ * without beginning a frame. It only presents a frame left pending by a
+ * pipelined draw.
+ *
+ * Each drawn frame's stage timings are added to the queue's frame stats, with
+ * queue wait measured from requestedAt. A pipelined frame's present time is
+ * that of the previous frame, which it presented.
  */
 template <typename TracerType>
 static void executeDrawWork(const TracerType* tracer,
@@ -1009,7 +2116,9 @@ static void executeDrawWork(const TracerType* tracer,
                             rive::Alignment alignment,
                             uint32_t clearColor,
                             float_t scaleFactor,
+                            bool pipelined,
                             rive::DrawKey drawKey,
+                            FramePipelineStats::Clock::time_point requestedAt,
                             rive::CommandServer* server)
 {
     auto artboard = server->getArtboardInstance(artboardHandle);
@@ -1036,11 +2145,45 @@ static void executeDrawWork(const TracerType* tracer,
         return;
     }
 
+    auto& dirtyTracker = commandQueue->drawDirtyTracker();
+    DrawDirtyTracker::DrawInputs inputs{
+        .artboard = static_cast<uint64_t>(artboardHandle),
+        .stateMachine = static_cast<uint64_t>(stateMachineHandle),
+        .surface = nativeSurface,
+        .targetGeneration = nativeSurface->targetGeneration(),
+        .fit = static_cast<uint8_t>(fit),
+        .alignmentX = alignment.x(),
+        .alignmentY = alignment.y(),
+        .scaleFactor = scaleFactor,
+        .clearColor = clearColor,
+    };
+    if (!dirtyTracker.isDirty(static_cast<uint64_t>(drawKey), inputs))
+    {
+        presentPendingFrame(tracer, renderContext, nativeSurface);
+        nativeSurface->pipelineStats().addSkippedFrame();
+        return;
+    }
+
     [[maybe_unused]] TraceScope<TracerType> drawTrace(*tracer,
                                                       "Rive/Frame/Draw");
+    const auto drawStart = FramePipelineStats::Clock::now();
+    FrameRecord record;
+    record.queueWaitNanos = FrameRecord::Nanos(drawStart - requestedAt);
 
     auto factory = reinterpret_cast<CommandServerFactory*>(server->factory());
     auto riveContext = factory->getRenderContext()->riveContext.get();
+
+    // The previous frame's present is finished before this frame begins, so
+    // that a Rive frame is only begun once its render target is known to be
+    // usable and is always flushed.
+    if (nativeSurface->hasPendingPresent())
+    {
+        const auto presentStart = FramePipelineStats::Clock::now();
+        presentPendingFrame(tracer, renderContext, nativeSurface);
+        record.presentNanos = FrameRecord::Nanos(
+            FramePipelineStats::Clock::now() - presentStart);
+    }
+
     rive::gpu::RenderTarget* concreteRenderTarget = nullptr;
     {
         [[maybe_unused]] TraceScope<TracerType> beginTrace(
@@ -1088,25 +2231,297 @@ static void executeDrawWork(const TracerType* tracer,
         artboard->draw(&renderer);
     }
 
+    const auto flushStart = FramePipelineStats::Clock::now();
+    record.drawNanos =
+        FrameRecord::Nanos(flushStart - drawStart) - record.presentNanos;
+    {
+        [[maybe_unused]] TraceScope<TracerType> flushTrace(
+            *tracer,
+            "Rive/Frame/Draw/Flush");
+        if (!renderContext->flush(nativeSurface))
+        {
+            return;
+        }
+    }
+    // Beginning the frame may have recreated the target.
+    inputs.targetGeneration = nativeSurface->targetGeneration();
+    dirtyTracker.drawn(static_cast<uint64_t>(drawKey), inputs);
+
+    auto& stats = nativeSurface->pipelineStats();
+    if (pipelined)
+    {
+        const auto flushedAt = FramePipelineStats::Clock::now();
+        nativeSurface->deferPresent(flushedAt);
+        stats.addFrame(true, flushedAt - drawStart);
+        record.flushNanos = FrameRecord::Nanos(flushedAt - flushStart);
+        commandQueue->addFrame(record);
+        return;
+    }
+
+    {
+        [[maybe_unused]] TraceScope<TracerType> presentTrace(
+            *tracer,
+            "Rive/Frame/Draw/Present");
+        const auto presentStart = FramePipelineStats::Clock::now();
+        renderContext->present(nativeSurface);
+        const auto presentEnd = FramePipelineStats::Clock::now();
+        stats.addPresent(presentEnd - presentStart);
+        stats.addFrame(false, presentEnd - drawStart);
+        record.flushNanos = FrameRecord::Nanos(presentStart - flushStart);
+        record.presentNanos = FrameRecord::Nanos(presentEnd - presentStart);
+    }
+    commandQueue->addFrame(record);
+}
+
+/** The outcome of drawing for a buffer readback. */
+enum class DrawToBufferResult
+{
+    Success,
+    ArtboardNull,
+    StateMachineNull,
+    RenderTargetUnavailable,
+};
+
+/** What to draw into a buffer, and where. */
+struct DrawToBufferRequest
+{
+    CommandQueueWithThread* commandQueue;
+    RenderContext* renderContext;
+    RenderSurface* nativeSurface;
+    rive::ArtboardHandle artboardHandle;
+    rive::StateMachineHandle stateMachineHandle;
+    uint32_t width;
+    uint32_t height;
+    rive::Fit fit;
+    rive::Alignment alignment;
+    float_t scaleFactor;
+    uint32_t clearColor;
+};
+
+/**
+ * Draw and flush a frame to be read back, on the command server thread.
+ *
+ * If the render context reads rows bottom first, the frame is drawn upside
+ * down so that they read back top first.
+ */
+static DrawToBufferResult drawForReadback(const DrawToBufferRequest& request,
+                                          rive::DrawKey drawKey,
+                                          rive::CommandServer* server)
+{
+    auto* commandQueue = request.commandQueue;
+    auto artboard = server->getArtboardInstance(request.artboardHandle);
+    if (artboard == nullptr)
+    {
+        if (commandQueue->shouldLogArtboardNull(drawKey))
+        {
+            RiveLogE(
+                TAG_CQ,
+                "Draw failed: Artboard instance is null (only reported once)");
+        }
+        return DrawToBufferResult::ArtboardNull;
+    }
+
+    auto stateMachine =
+        server->getStateMachineInstance(request.stateMachineHandle);
+    if (stateMachine == nullptr)
+    {
+        if (commandQueue->shouldLogStateMachineNull(drawKey))
+        {
+            RiveLogE(
+                TAG_CQ,
+                "Draw failed: State machine instance is null (only reported once)");
+        }
+        return DrawToBufferResult::StateMachineNull;
+    }
+
+    auto* renderContext = request.renderContext;
+    auto concreteRenderTarget =
+        renderContext->beginFrame(request.nativeSurface);
+    if (concreteRenderTarget == nullptr ||
+        concreteRenderTarget->width() == 0 ||
+        concreteRenderTarget->height() == 0)
+    {
+        return DrawToBufferResult::RenderTargetUnavailable;
+    }
+    auto targetWidth = static_cast<float_t>(concreteRenderTarget->width());
+    auto targetHeight = static_cast<float_t>(concreteRenderTarget->height());
+    // Retrieve the Rive RenderContext from the CommandServer
+    auto factory = reinterpret_cast<CommandServerFactory*>(server->factory());
+    auto riveContext = factory->getRenderContext()->riveContext.get();
+
+    riveContext->beginFrame(rive::gpu::RenderContext::FrameDescriptor{
+        .renderTargetWidth = concreteRenderTarget->width(),
+        .renderTargetHeight = concreteRenderTarget->height(),
+        .loadAction = rive::gpu::LoadAction::clear,
+        .clearColor = request.clearColor,
+    });
+
+    auto renderer = rive::RiveRenderer(riveContext);
+    if (renderContext->readsBottomUp())
+    {
+        renderer.transform(
+            rive::Mat2D(1.0f, 0.0f, 0.0f, -1.0f, 0.0f, targetHeight));
+    }
+    renderer.align(request.fit,
+                   request.alignment,
+                   rive::AABB(0.0f, 0.0f, targetWidth, targetHeight),
+                   artboard->bounds(),
+                   request.scaleFactor);
+    artboard->draw(&renderer);
+
+    if (!renderContext->flush(request.nativeSurface))
+    {
+        return DrawToBufferResult::RenderTargetUnavailable;
+    }
+    return DrawToBufferResult::Success;
+}
+
+/** The message for a failed draw into a buffer, or null on success. */
+static const char* drawToBufferError(DrawToBufferResult result)
+{
+    switch (result)
+    {
+        case DrawToBufferResult::Success:
+            return nullptr;
+        case DrawToBufferResult::ArtboardNull:
+            return "Failed to draw into buffer: Artboard instance is null";
+        case DrawToBufferResult::StateMachineNull:
+            return "Failed to draw into buffer: State machine instance is null";
+        case DrawToBufferResult::RenderTargetUnavailable:
+            return "Failed to draw into buffer: render target is unavailable";
+    }
+    return nullptr;
+}
+
+/**
+ * Called on the command server thread when a readback completes, with its
+ * pixels or null, and null or the error message. The pixels are only valid for
+ * the duration of the call.
+ */
+using ReadbackCompletion =
+    std::function<void(const uint8_t* pixels, const char* error)>;
+
+/**
+ * Queue a draw and an asynchronous readback of it, calling complete when the
+ * pixels are ready or the draw fails.
+ *
+ * Queued in order with other commands rather than as a coalesced draw, so that
+ * every request is drawn, each with the state it was requested in.
+ *
+ * @param destination Where the render context writes the pixels, which are
+ *   then passed to complete, or null to pass them in a temporary buffer. See
+ *   RenderContext::readPixelsAsync.
+ */
+static void queueReadback(const DrawToBufferRequest& request,
+                          jlong drawKey,
+                          uint8_t* destination,
+                          ReadbackCompletion complete)
+{
+    request.commandQueue->readbackQueued();
+    request.commandQueue->runOnce(
+        [request, drawKey, destination, complete = std::move(complete)](
+            rive::CommandServer* server) {
+            auto result =
+                drawForReadback(request,
+                                handleFromLong<rive::DrawKey>(drawKey),
+                                server);
+            if (result == DrawToBufferResult::Success)
+            {
+                request.renderContext->readPixelsAsync(
+                    request.nativeSurface,
+                    request.width,
+                    request.height,
+                    destination,
+                    [complete](const uint8_t* pixels) {
+                        complete(pixels,
+                                 pixels == nullptr
+                                     ? drawToBufferError(
+                                           DrawToBufferResult::
+                                               RenderTargetUnavailable)
+                                     : nullptr);
+                    });
+            }
+            else
+            {
+                complete(nullptr, drawToBufferError(result));
+            }
+            // Readbacks requested together are left in flight while the next
+            // is drawn, and waited for after the last.
+            request.renderContext->completeReadbacks(
+                request.commandQueue->readbackDrawn());
+        });
+}
+
+/**
+ * Call a Kotlin (String?) -> Unit readback callback with null or the error
+ * message, logging and clearing anything it throws.
+ */
+static void invokeReadbackCallback(JNIEnv* env,
+                                   jobject jOnComplete,
+                                   const char* error)
+{
+    // Kotlin's (String?) -> Unit compiles to Function1<String, Unit>.
+    auto function1Class = GetObjectClass(env, jOnComplete);
+    auto invokeMethod =
+        env->GetMethodID(function1Class.get(),
+                         "invoke",
+                         "(Ljava/lang/Object;)Ljava/lang/Object;");
+    auto jError = error == nullptr ? JniResource<jstring>(nullptr, env)
+                                   : MakeJString(env, error);
+    env->CallObjectMethod(jOnComplete, invokeMethod, jError.get());
+    JNIExceptionHandler::ClearAndLogErrors(
+        env,
+        TAG_CQ,
+        "drawToBufferAsync: Exception thrown in Kotlin callback:");
+}
+
+/**
+ * Read a Rive file from a region of a file descriptor into a new byte vector
+ * by mapping it, rather than reading it through a Java byte array.
+ *
+ * The mapping only lives for the duration of this call. The command queue
+ * takes ownership of the bytes it imports, so they must be copied out of the
+ * mapping either way. Doing that here, off the main thread, means submitting
+ * the load is a move of the vector rather than a copy.
+ *
+ * @return The bytes, owned by the caller, or nullptr if mapping failed.
+ */
+static std::vector<uint8_t>* mapFileBytes(int fd, off_t offset, size_t length)
+{
+    MappedFile mapping(fd, offset, length);
+    if (!mapping.valid())
     {
-        [[maybe_unused]] TraceScope<TracerType> flushTrace(
-            *tracer,
-            "Rive/Frame/Draw/Flush");
-        if (!renderContext->flush(nativeSurface))
-        {
-            return;
-        }
+        return nullptr;
     }
+    return new std::vector<uint8_t>(mapping.data(),
+                                    mapping.data() + mapping.size());
+}
 
+/**
+ * Report a command server's startup result to the Kotlin CommandQueueStartup
+ * that cppConstructorAsync was given, then delete its global reference.
+ */
+static void reportStartup(JNIEnv* env,
+                          jobject jGlobalStartup,
+                          const StartupResult& result)
+{
     {
-        [[maybe_unused]] TraceScope<TracerType> presentTrace(
-            *tracer,
-            "Rive/Frame/Draw/Present");
-        if (!renderContext->present(nativeSurface))
-        {
-            return;
-        }
+        auto startupClass = GetObjectClass(env, jGlobalStartup);
+        auto onResultFn = env->GetMethodID(startupClass.get(),
+                                           "onResult",
+                                           "(ZILjava/lang/String;)V");
+        auto jMessage = MakeJString(env, result.message);
+        env->CallVoidMethod(jGlobalStartup,
+                            onResultFn,
+                            static_cast<jboolean>(result.success),
+                            static_cast<jint>(result.errorCode),
+                            jMessage.get());
+        JNIExceptionHandler::ClearAndLogErrors(
+            env,
+            TAG_CQ,
+            "Exception thrown reporting command server startup:");
     }
+    env->DeleteGlobalRef(jGlobalStartup);
 }
 
 extern "C"
@@ -1121,8 +2536,8 @@ extern "C"
             reinterpret_cast<RenderContext*>(renderContextPtr);
 
         // Used by the CommandServer thread to signal startup success or failure
-        std::promise<StartupResult> promise;
-        std::future<StartupResult> resultFuture = promise.get_future();
+        auto promise = std::make_shared<std::promise<StartupResult>>();
+        std::future<StartupResult> resultFuture = promise->get_future();
 
         /* Create a command queue with an owned thread handle (ref count 1).
          * The command server thread will also own 1 after calling
@@ -1131,7 +2546,11 @@ extern "C"
         auto commandQueue =
             rive::rcp<CommandQueueWithThread>(new CommandQueueWithThread());
         // Start the C++ thread that drives the CommandServer
-        commandQueue->startCommandServer(renderContext, std::move(promise));
+        commandQueue->startCommandServer(
+            renderContext,
+            [promise](const StartupResult& result) {
+                promise->set_value(result);
+            });
 
         // Wait for the command server to start, blocking the main thread, and
         // return the result
@@ -1157,6 +2576,58 @@ extern "C"
         return reinterpret_cast<jlong>(commandQueue.release());
     }
 
+    /**
+     * Like cppConstructor, but returns without waiting for the command server
+     * to start. The result is reported to jStartup's onResult on the command
+     * server thread.
+     */
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppConstructorAsync(
+        JNIEnv* env,
+        jobject,
+        jlong renderContextPtr,
+        jobject jStartup)
+    {
+        auto* renderContext =
+            reinterpret_cast<RenderContext*>(renderContextPtr);
+        // Deleted once the result is reported
+        jobject jGlobalStartup = env->NewGlobalRef(jStartup);
+
+        // Ownership is the same as in cppConstructor.
+        auto commandQueue =
+            rive::rcp<CommandQueueWithThread>(new CommandQueueWithThread());
+        commandQueue->startCommandServer(
+            renderContext,
+            [jGlobalStartup](const StartupResult& result) {
+                JNIEnv* env = nullptr;
+                if (g_JVM->GetEnv(reinterpret_cast<void**>(&env),
+                                  JNI_VERSION_1_6) == JNI_OK)
+                {
+                    reportStartup(env, jGlobalStartup, result);
+                    return;
+                }
+                // The command server thread failed to attach. Attach again
+                // just long enough to report it, since otherwise the caller
+                // would wait forever on a queue that will never serve.
+                JavaVMAttachArgs args{.version = JNI_VERSION_1_6,
+                                      .name = "Rive CmdServer",
+                                      .group = nullptr};
+                if (g_JVM->AttachCurrentThread(&env, &args) != JNI_OK)
+                {
+                    RiveLogE(TAG_CQ,
+                             "Failed to report command server startup, "
+                             "CommandQueueStartupListener will not be "
+                             "called: %s",
+                             result.message.c_str());
+                    return;
+                }
+                reportStartup(env, jGlobalStartup, result);
+                g_JVM->DetachCurrentThread();
+            });
+
+        return reinterpret_cast<jlong>(commandQueue.release());
+    }
+
     JNIEXPORT void JNICALL
     Java_app_rive_core_CommandQueueJNIBridge_cppDelete(JNIEnv*,
                                                        jobject,
@@ -1216,16 +2687,20 @@ extern "C"
         auto listenersConstructor =
             env->GetMethodID(listenersClass.get(), "<init>", "(JJJJJJJ)V");
 
-        auto commandQueue = reinterpret_cast<rive::CommandQueue*>(ref);
+        auto commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
 
-        auto fileListener = new FileListener(env, jReceiver);
-        auto artboardListener = new ArtboardListener(env, jReceiver);
-        auto stateMachineListener = new StateMachineListener(env, jReceiver);
-        auto viewModelInstanceListener =
-            new ViewModelInstanceListener(env, jReceiver);
-        auto imageListener = new ImageListener(env, jReceiver);
-        auto audioListener = new AudioListener(env, jReceiver);
-        auto fontListener = new FontListener(env, jReceiver);
+        // Resolve the callback table once; all listeners share it and the
+        // last one deleted releases the receiver.
+        auto jQueue = std::make_shared<JCommandQueue>(env, jReceiver);
+        commandQueue->setCallbacks(jQueue);
+
+        auto fileListener = new FileListener(jQueue);
+        auto artboardListener = new ArtboardListener(jQueue);
+        auto stateMachineListener = new StateMachineListener(jQueue);
+        auto viewModelInstanceListener = new ViewModelInstanceListener(jQueue);
+        auto imageListener = new ImageListener(jQueue);
+        auto audioListener = new AudioListener(jQueue);
+        auto fontListener = new FontListener(jQueue);
 
         commandQueue->setGlobalFileListener(fileListener);
         commandQueue->setGlobalArtboardListener(artboardListener);
@@ -1255,8 +2730,19 @@ extern "C"
                                                              jobject,
                                                              jlong ref)
     {
-        auto commandQueue = reinterpret_cast<rive::CommandQueue*>(ref);
-        commandQueue->processMessages();
+        auto commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        commandQueue->pollMessages();
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppSetMessageBuffer(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jobject jBuffer)
+    {
+        auto commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        commandQueue->setMessageBuffer(env, jBuffer);
     }
 
     JNIEXPORT void JNICALL
@@ -1281,7 +2767,87 @@ extern "C"
         auto byteVec = ByteArrayToUint8Vec(env, bytes);
 
         return longFromHandle(
-            commandQueue->loadFile(byteVec, nullptr, requestID));
+            commandQueue->loadFile(std::move(byteVec),
+                                   nullptr,
+                                   requestID));
+    }
+
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppCopyFileBytes(JNIEnv* env,
+                                                              jobject,
+                                                              jobject jBuffer,
+                                                              jint position,
+                                                              jint length)
+    {
+        auto* address =
+            static_cast<const uint8_t*>(env->GetDirectBufferAddress(jBuffer));
+        if (address == nullptr)
+        {
+            RiveLogE(TAG_CQ, "File bytes must be in a direct ByteBuffer");
+            return 0;
+        }
+
+        const auto capacity = env->GetDirectBufferCapacity(jBuffer);
+        if (position < 0 || length < 0 ||
+            static_cast<jlong>(position) + length > capacity)
+        {
+            auto jIllegalArgumentExceptionClass =
+                FindClass(env, "java/lang/IllegalArgumentException");
+            char messageBuffer[128];
+            snprintf(messageBuffer,
+                     sizeof(messageBuffer),
+                     "File bytes [%d, %d + %d) are outside the buffer's "
+                     "capacity of %lld",
+                     position,
+                     position,
+                     length,
+                     static_cast<long long>(capacity));
+            env->ThrowNew(jIllegalArgumentExceptionClass.get(),
+                          messageBuffer);
+            return 0;
+        }
+
+        auto* begin = address + position;
+        auto* bytes = new std::vector<uint8_t>(begin, begin + length);
+        return reinterpret_cast<jlong>(bytes);
+    }
+
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppMapFileBytes(JNIEnv*,
+                                                             jobject,
+                                                             jint fd,
+                                                             jlong offset,
+                                                             jlong length)
+    {
+        return reinterpret_cast<jlong>(
+            mapFileBytes(fd,
+                         static_cast<off_t>(offset),
+                         static_cast<size_t>(length)));
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppDeleteFileBytes(JNIEnv*,
+                                                                jobject,
+                                                                jlong bytesRef)
+    {
+        delete reinterpret_cast<std::vector<uint8_t>*>(bytesRef);
+    }
+
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppLoadFileBytes(JNIEnv*,
+                                                              jobject,
+                                                              jlong ref,
+                                                              jlong requestID,
+                                                              jlong bytesRef)
+    {
+        auto commandQueue = reinterpret_cast<rive::CommandQueue*>(ref);
+        // Take ownership of the prepared bytes and move them into the queue,
+        // so submitting the load does not copy the file.
+        std::unique_ptr<std::vector<uint8_t>> bytes(
+            reinterpret_cast<std::vector<uint8_t>*>(bytesRef));
+
+        return longFromHandle(
+            commandQueue->loadFile(std::move(*bytes), nullptr, requestID));
     }
 
     JNIEXPORT void JNICALL
@@ -1531,10 +3097,17 @@ extern "C"
         jlong requestID,
         jlong stateMachineHandle)
     {
-        auto commandQueue = reinterpret_cast<rive::CommandQueue*>(ref);
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
         commandQueue->deleteStateMachine(
             handleFromLong<rive::StateMachineHandle>(stateMachineHandle),
             requestID);
+        commandQueue->removeBoundViewModelInstance(
+            static_cast<uint64_t>(stateMachineHandle));
+        commandQueue->runOnce([commandQueue,
+                               stateMachineHandle](rive::CommandServer*) {
+            commandQueue->drawDirtyTracker().removeStateMachine(
+                static_cast<uint64_t>(stateMachineHandle));
+        });
     }
 
     JNIEXPORT void JNICALL
@@ -1551,32 +3124,85 @@ extern "C"
             handleFromLong<rive::StateMachineHandle>(stateMachineHandle);
         auto deltaSeconds = static_cast<float_t>(deltaTimeNs) / 1e9f; // NS to S
 
-        const bool enableTracing = commandQueue->tracingEnabled();
-
-        // When tracing, we want to measure the execution on the command server
-        // thread, but we can't extend that command. So we instead use runOnce
-        // to replicate the implementation.
-        if (enableTracing)
-        {
-            const Tracer* tracerPtr = &defaultTracer();
+        // We can't extend the advance command to trace it or to learn whether
+        // it settled, so we instead use runOnce to replicate the
+        // implementation.
+        auto submit = [&](const auto* tracerPtr) {
             commandQueue->runOnce([tracerPtr,
                                    commandQueue,
                                    requestID,
                                    stateMachine,
                                    deltaSeconds](rive::CommandServer* server) {
-                executeTracedAdvanceWork(tracerPtr,
-                                         commandQueue,
-                                         server,
-                                         requestID,
-                                         stateMachine,
-                                         deltaSeconds);
+                executeAdvanceWork(tracerPtr,
+                                   commandQueue,
+                                   server,
+                                   requestID,
+                                   stateMachine,
+                                   deltaSeconds);
             });
+        };
+        if (commandQueue->tracingEnabled())
+        {
+            submit(&defaultTracer());
         }
         else
         {
-            commandQueue->advanceStateMachine(stateMachine,
-                                              deltaSeconds,
-                                              requestID);
+            submit(&noopTracer());
+        }
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppAdvanceStateMachines(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jlong requestID,
+        jlongArray jPairs,
+        jint count,
+        jlong deltaTimeNs,
+        jboolean parallel)
+    {
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        if (count <= 0)
+        {
+            return;
+        }
+
+        // (artboardHandle, stateMachineHandle) pairs.
+        std::vector<jlong> pairs(static_cast<size_t>(count) * 2);
+        env->GetLongArrayRegion(jPairs, 0, count * 2, pairs.data());
+        if (env->ExceptionCheck())
+        {
+            return; // ArrayIndexOutOfBoundsException propagates to Kotlin.
+        }
+
+        auto batch = groupIndependentAdvances(commandQueue,
+                                              pairs.data(),
+                                              static_cast<uint32_t>(count));
+        auto deltaSeconds = static_cast<float_t>(deltaTimeNs) / 1e9f; // NS to S
+        auto submit = [&](auto* tracer) {
+            commandQueue->runOnce([tracer,
+                                   commandQueue,
+                                   requestID,
+                                   batch = std::move(batch),
+                                   deltaSeconds,
+                                   parallel](rive::CommandServer* server) {
+                executeAdvanceBatch(tracer,
+                                    commandQueue,
+                                    server,
+                                    requestID,
+                                    batch,
+                                    deltaSeconds,
+                                    parallel == JNI_TRUE);
+            });
+        };
+        if (commandQueue->tracingEnabled())
+        {
+            submit(&defaultTracer());
+        }
+        else
+        {
+            submit(&noopTracer());
         }
     }
 
@@ -1808,11 +3434,18 @@ extern "C"
         jlong requestID,
         jlong jViewModelInstanceHandle)
     {
-        auto commandQueue = reinterpret_cast<rive::CommandQueue*>(ref);
-        commandQueue->deleteViewModelInstance(
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        auto viewModelInstanceHandle =
             handleFromLong<rive::ViewModelInstanceHandle>(
-                jViewModelInstanceHandle),
-            requestID);
+                jViewModelInstanceHandle);
+        commandQueue->deleteViewModelInstance(viewModelInstanceHandle,
+                                              requestID);
+        // Queued after the delete, so any set already queued still applies.
+        commandQueue->runOnce(
+            [commandQueue, viewModelInstanceHandle](rive::CommandServer*) {
+                commandQueue->propertyHandles().removeInstance(
+                    viewModelInstanceHandle);
+            });
     }
 
     JNIEXPORT void JNICALL
@@ -1824,7 +3457,7 @@ extern "C"
         jlong jStateMachineHandle,
         jlong jViewModelInstanceHandle)
     {
-        auto commandQueue = reinterpret_cast<rive::CommandQueue*>(ref);
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
         auto stateMachineHandle =
             handleFromLong<rive::StateMachineHandle>(jStateMachineHandle);
         auto viewModelInstanceHandle =
@@ -1834,6 +3467,10 @@ extern "C"
         commandQueue->bindViewModelInstance(stateMachineHandle,
                                             viewModelInstanceHandle,
                                             requestID);
+        commandQueue->setBoundViewModelInstance(
+            static_cast<uint64_t>(jStateMachineHandle),
+            static_cast<uint64_t>(jViewModelInstanceHandle));
+        commandQueue->markScenesChanged();
     }
 
     JNIEXPORT void JNICALL
@@ -1958,74 +3595,303 @@ extern "C"
     }
 
     JNIEXPORT void JNICALL
-    Java_app_rive_core_CommandQueueJNIBridge_cppGetEnumProperty(
+    Java_app_rive_core_CommandQueueJNIBridge_cppGetEnumProperty(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jlong requestID,
+        jlong jViewModelInstanceHandle,
+        jstring jPropertyPath)
+    {
+        getProperty(env,
+                    ref,
+                    requestID,
+                    jViewModelInstanceHandle,
+                    jPropertyPath,
+                    &rive::CommandQueue::requestViewModelInstanceEnum);
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppSetColorProperty(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jlong jViewModelInstanceHandle,
+        jstring jPropertyPath,
+        jint jValue)
+    {
+        // ColorInt is uint32_t in C++
+        auto value = static_cast<uint32_t>(jValue);
+        setProperty(env,
+                    ref,
+                    jViewModelInstanceHandle,
+                    jPropertyPath,
+                    value,
+                    &rive::CommandQueue::setViewModelInstanceColor);
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppGetColorProperty(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jlong requestID,
+        jlong jViewModelInstanceHandle,
+        jstring jPropertyPath)
+    {
+        getProperty(env,
+                    ref,
+                    requestID,
+                    jViewModelInstanceHandle,
+                    jPropertyPath,
+                    &rive::CommandQueue::requestViewModelInstanceColor);
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppFireTriggerProperty(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jlong jViewModelInstanceHandle,
+        jstring jPropertyPath)
+    {
+        auto commandQueue = reinterpret_cast<rive::CommandQueue*>(ref);
+        auto viewModelInstanceHandle =
+            handleFromLong<rive::ViewModelInstanceHandle>(
+                jViewModelInstanceHandle);
+        auto propertyPath = JStringToString(env, jPropertyPath);
+
+        commandQueue->fireViewModelTrigger(viewModelInstanceHandle,
+                                           propertyPath);
+        markScenesChanged(ref);
+    }
+
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppResolveProperty(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jlong jViewModelInstanceHandle,
+        jstring jPropertyPath)
+    {
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        auto viewModelInstanceHandle =
+            handleFromLong<rive::ViewModelInstanceHandle>(
+                jViewModelInstanceHandle);
+        auto propertyPath = JStringToString(env, jPropertyPath);
+        auto id = commandQueue->nextPropertyHandle();
+
+        commandQueue->runOnce(
+            [commandQueue,
+             id,
+             viewModelInstanceHandle,
+             propertyPath = std::move(propertyPath)](rive::CommandServer*) {
+                commandQueue->propertyHandles().add(id,
+                                                    viewModelInstanceHandle,
+                                                    propertyPath);
+            });
+        return static_cast<jlong>(id);
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppReleaseProperty(
+        JNIEnv*,
+        jobject,
+        jlong ref,
+        jlong jPropertyHandle)
+    {
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        auto id = static_cast<uint64_t>(jPropertyHandle);
+
+        commandQueue->runOnce([commandQueue, id](rive::CommandServer*) {
+            commandQueue->propertyHandles().remove(id);
+        });
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppSetNumberPropertyByHandle(
+        JNIEnv*,
+        jobject,
+        jlong ref,
+        jlong jPropertyHandle,
+        jfloat value)
+    {
+        setPropertyByHandle<float>(
+            ref,
+            jPropertyHandle,
+            PropertyKind::number,
+            value,
+            [](rive::ViewModelInstanceRuntime* instance,
+               const std::string& path) {
+                return instance->propertyNumber(path);
+            },
+            [](rive::ViewModelInstanceNumberRuntime* property, float value) {
+                property->value(value);
+            },
+            &rive::CommandQueue::setViewModelInstanceNumber);
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppSetStringPropertyByHandle(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jlong jPropertyHandle,
+        jstring jValue)
+    {
+        setPropertyByHandle<std::string>(
+            ref,
+            jPropertyHandle,
+            PropertyKind::string,
+            JStringToString(env, jValue),
+            [](rive::ViewModelInstanceRuntime* instance,
+               const std::string& path) {
+                return instance->propertyString(path);
+            },
+            [](rive::ViewModelInstanceStringRuntime* property,
+               const std::string& value) { property->value(value); },
+            &rive::CommandQueue::setViewModelInstanceString);
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppSetBooleanPropertyByHandle(
+        JNIEnv*,
+        jobject,
+        jlong ref,
+        jlong jPropertyHandle,
+        jboolean jValue)
+    {
+        setPropertyByHandle<bool>(
+            ref,
+            jPropertyHandle,
+            PropertyKind::boolean,
+            jValue,
+            [](rive::ViewModelInstanceRuntime* instance,
+               const std::string& path) {
+                return instance->propertyBoolean(path);
+            },
+            [](rive::ViewModelInstanceBooleanRuntime* property, bool value) {
+                property->value(value);
+            },
+            &rive::CommandQueue::setViewModelInstanceBool);
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppSetEnumPropertyByHandle(
         JNIEnv* env,
         jobject,
         jlong ref,
-        jlong requestID,
-        jlong jViewModelInstanceHandle,
-        jstring jPropertyPath)
+        jlong jPropertyHandle,
+        jstring jValue)
     {
-        getProperty(env,
-                    ref,
-                    requestID,
-                    jViewModelInstanceHandle,
-                    jPropertyPath,
-                    &rive::CommandQueue::requestViewModelInstanceEnum);
+        setPropertyByHandle<std::string>(
+            ref,
+            jPropertyHandle,
+            PropertyKind::enumeration,
+            JStringToString(env, jValue),
+            [](rive::ViewModelInstanceRuntime* instance,
+               const std::string& path) {
+                return instance->propertyEnum(path);
+            },
+            [](rive::ViewModelInstanceEnumRuntime* property,
+               const std::string& value) { property->value(value); },
+            &rive::CommandQueue::setViewModelInstanceEnum);
     }
 
     JNIEXPORT void JNICALL
-    Java_app_rive_core_CommandQueueJNIBridge_cppSetColorProperty(
-        JNIEnv* env,
+    Java_app_rive_core_CommandQueueJNIBridge_cppSetColorPropertyByHandle(
+        JNIEnv*,
         jobject,
         jlong ref,
-        jlong jViewModelInstanceHandle,
-        jstring jPropertyPath,
+        jlong jPropertyHandle,
         jint jValue)
     {
         // ColorInt is uint32_t in C++
-        auto value = static_cast<uint32_t>(jValue);
-        setProperty(env,
-                    ref,
-                    jViewModelInstanceHandle,
-                    jPropertyPath,
-                    value,
-                    &rive::CommandQueue::setViewModelInstanceColor);
+        setPropertyByHandle<uint32_t>(
+            ref,
+            jPropertyHandle,
+            PropertyKind::color,
+            static_cast<uint32_t>(jValue),
+            [](rive::ViewModelInstanceRuntime* instance,
+               const std::string& path) {
+                return instance->propertyColor(path);
+            },
+            [](rive::ViewModelInstanceColorRuntime* property, uint32_t value) {
+                property->value(static_cast<int>(value));
+            },
+            &rive::CommandQueue::setViewModelInstanceColor);
     }
 
     JNIEXPORT void JNICALL
-    Java_app_rive_core_CommandQueueJNIBridge_cppGetColorProperty(
+    Java_app_rive_core_CommandQueueJNIBridge_cppApplyPropertyBatch(
         JNIEnv* env,
         jobject,
         jlong ref,
-        jlong requestID,
-        jlong jViewModelInstanceHandle,
-        jstring jPropertyPath)
+        jbyteArray jBatch,
+        jint length)
     {
-        getProperty(env,
-                    ref,
-                    requestID,
-                    jViewModelInstanceHandle,
-                    jPropertyPath,
-                    &rive::CommandQueue::requestViewModelInstanceColor);
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        if (length <= 0)
+        {
+            return;
+        }
+
+        std::vector<uint8_t> bytes(static_cast<size_t>(length));
+        env->GetByteArrayRegion(jBatch,
+                                0,
+                                length,
+                                reinterpret_cast<jbyte*>(bytes.data()));
+        if (env->ExceptionCheck())
+        {
+            return; // ArrayIndexOutOfBoundsException propagates to Kotlin.
+        }
+
+        commandQueue->runOnce(
+            [commandQueue,
+             bytes = std::move(bytes)](rive::CommandServer* server) {
+                commandQueue->drawDirtyTracker().touchAll();
+                applyPropertyBatch(commandQueue, server, bytes);
+            });
     }
 
     JNIEXPORT void JNICALL
-    Java_app_rive_core_CommandQueueJNIBridge_cppFireTriggerProperty(
-        JNIEnv* env,
+    Java_app_rive_core_CommandQueueJNIBridge_cppFireTriggerPropertyByHandle(
+        JNIEnv*,
         jobject,
         jlong ref,
-        jlong jViewModelInstanceHandle,
-        jstring jPropertyPath)
+        jlong jPropertyHandle)
     {
-        auto commandQueue = reinterpret_cast<rive::CommandQueue*>(ref);
-        auto viewModelInstanceHandle =
-            handleFromLong<rive::ViewModelInstanceHandle>(
-                jViewModelInstanceHandle);
-        auto propertyPath = JStringToString(env, jPropertyPath);
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        auto id = static_cast<uint64_t>(jPropertyHandle);
 
-        commandQueue->fireViewModelTrigger(viewModelInstanceHandle,
-                                           propertyPath);
+        commandQueue->runOnce([commandQueue, id](rive::CommandServer* server) {
+            commandQueue->drawDirtyTracker().touchAll();
+            auto& handles = commandQueue->propertyHandles();
+            auto* property = handles.find(id);
+            if (property == nullptr)
+            {
+                RiveLogW(TAG_CQ,
+                         "Ignoring trigger of released property handle %llu",
+                         static_cast<unsigned long long>(id));
+                return;
+            }
+            auto* trigger = handles.resolve(
+                server,
+                *property,
+                PropertyKind::trigger,
+                [](rive::ViewModelInstanceRuntime* instance,
+                   const std::string& path) {
+                    return instance->propertyTrigger(path);
+                });
+            if (trigger == nullptr)
+            {
+                // Report the failure through the standard command.
+                commandQueue->fireViewModelTrigger(property->viewModelInstance,
+                                                   property->path);
+                return;
+            }
+            trigger->trigger();
+        });
     }
 
     JNIEXPORT void JNICALL
@@ -2090,6 +3956,7 @@ extern "C"
         commandQueue->setViewModelInstanceImage(viewModelInstanceHandle,
                                                 propertyPath,
                                                 imageHandle);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2112,6 +3979,7 @@ extern "C"
         commandQueue->setViewModelInstanceArtboard(viewModelInstanceHandle,
                                                    propertyPath,
                                                    artboardHandle);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2123,7 +3991,7 @@ extern "C"
         jstring jPropertyPath,
         jlong jValueHandle)
     {
-        auto commandQueue = reinterpret_cast<rive::CommandQueue*>(ref);
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
         auto viewModelInstanceHandle =
             handleFromLong<rive::ViewModelInstanceHandle>(
                 jViewModelInstanceHandle);
@@ -2135,6 +4003,11 @@ extern "C"
             viewModelInstanceHandle,
             propertyPath,
             valueHandle);
+        // Resolved handles may have pathed through the replaced instance.
+        commandQueue->runOnce([commandQueue](rive::CommandServer*) {
+            commandQueue->propertyHandles().invalidateAll();
+            commandQueue->drawDirtyTracker().touchAll();
+        });
     }
 
     JNIEXPORT void JNICALL
@@ -2180,6 +4053,7 @@ extern "C"
             propertyPath,
             itemHandle,
             static_cast<int32_t>(index));
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2203,6 +4077,7 @@ extern "C"
             viewModelInstanceHandle,
             propertyPath,
             itemHandle);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2224,6 +4099,7 @@ extern "C"
             viewModelInstanceHandle,
             propertyPath,
             static_cast<int32_t>(index));
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2247,6 +4123,7 @@ extern "C"
             viewModelInstanceHandle,
             propertyPath,
             itemHandle);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2270,6 +4147,7 @@ extern "C"
             propertyPath,
             static_cast<int32_t>(indexA),
             static_cast<int32_t>(indexB));
+        markScenesChanged(ref);
     }
 
     JNIEXPORT jlong JNICALL
@@ -2313,6 +4191,7 @@ extern "C"
             handleFromLong<rive::RenderImageHandle>(jImageHandle);
 
         commandQueue->addGlobalImageAsset(path, imageHandle);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2325,6 +4204,7 @@ extern "C"
         auto path = JStringToString(env, jPath);
 
         commandQueue->removeGlobalImageAsset(path);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT jlong JNICALL
@@ -2420,6 +4300,7 @@ extern "C"
         auto fontHandle = handleFromLong<rive::FontHandle>(jFontHandle);
 
         commandQueue->addGlobalFontAsset(path, fontHandle);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2432,6 +4313,7 @@ extern "C"
         auto path = JStringToString(env, jPath);
 
         commandQueue->removeGlobalFontAsset(path);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2463,6 +4345,7 @@ extern "C"
         commandQueue->pointerMove(
             handleFromLong<rive::StateMachineHandle>(stateMachineHandle),
             event);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2494,6 +4377,7 @@ extern "C"
         commandQueue->pointerDown(
             handleFromLong<rive::StateMachineHandle>(stateMachineHandle),
             event);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2525,6 +4409,7 @@ extern "C"
         commandQueue->pointerUp(
             handleFromLong<rive::StateMachineHandle>(stateMachineHandle),
             event);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2556,6 +4441,73 @@ extern "C"
         commandQueue->pointerExit(
             handleFromLong<rive::StateMachineHandle>(stateMachineHandle),
             event);
+        markScenesChanged(ref);
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppPointerEvents(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jlong stateMachineHandle,
+        jbyte jFit,
+        jbyte jAlignment,
+        jfloat layoutScale,
+        jfloat surfaceWidth,
+        jfloat surfaceHeight,
+        jfloatArray jSamples,
+        jint count)
+    {
+        constexpr jint kStride = 4; // (pointerID, x, y, action)
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        if (count <= 0)
+        {
+            return;
+        }
+
+        // Copy out with one region read rather than pinning the array, which
+        // the JVM may have to copy anyway.
+        std::vector<jfloat> packed(static_cast<size_t>(count) * kStride);
+        env->GetFloatArrayRegion(jSamples,
+                                 0,
+                                 count * kStride,
+                                 packed.data());
+        if (env->ExceptionCheck())
+        {
+            return; // ArrayIndexOutOfBoundsException propagates to Kotlin.
+        }
+
+        std::vector<PointerSample> samples;
+        samples.reserve(count);
+        for (jint i = 0; i < count; i++)
+        {
+            const auto* event = &packed[static_cast<size_t>(i) * kStride];
+            samples.push_back(
+                {.action = static_cast<PointerAction>(
+                     static_cast<uint8_t>(event[3])),
+                 .pointerID = static_cast<int>(event[0]),
+                 .position = rive::Vec2D(event[1], event[2])});
+        }
+
+        rive::CommandQueue::PointerEvent layout{
+            .fit = GetFit(static_cast<uint8_t>(jFit)),
+            .alignment = GetAlignment(static_cast<uint8_t>(jAlignment)),
+            .screenBounds = rive::Vec2D(static_cast<float_t>(surfaceWidth),
+                                        static_cast<float_t>(surfaceHeight)),
+            .scaleFactor = static_cast<float>(layoutScale)};
+        auto handle =
+            handleFromLong<rive::StateMachineHandle>(stateMachineHandle);
+
+        commandQueue->runOnce(
+            [commandQueue, handle, layout, samples = std::move(samples)](
+                rive::CommandServer* server) {
+                commandQueue->drawDirtyTracker().touchAll();
+                executePointerEvents(commandQueue,
+                                     server,
+                                     handle,
+                                     layout,
+                                     samples);
+            });
     }
 
     JNIEXPORT void JNICALL
@@ -2579,6 +4531,7 @@ extern "C"
                                       width,
                                       height,
                                       scaleFactor);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2593,6 +4546,7 @@ extern "C"
             handleFromLong<rive::ArtboardHandle>(jArtboardHandle);
 
         commandQueue->resetArtboardSize(artboardHandle);
+        markScenesChanged(ref);
     }
 
     JNIEXPORT void JNICALL
@@ -2637,7 +4591,8 @@ extern "C"
         jbyte jFit,
         jbyte jAlignment,
         jfloat jScaleFactor,
-        jint jClearColor)
+        jint jClearColor,
+        jboolean jPipelined)
     {
         auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
         auto* renderContext =
@@ -2651,6 +4606,7 @@ extern "C"
         auto alignment = GetAlignment(static_cast<uint8_t>(jAlignment));
         auto scaleFactor = static_cast<float_t>(jScaleFactor);
         auto clearColor = static_cast<uint32_t>(jClearColor);
+        const bool pipelined = jPipelined;
         const bool enableTracing = commandQueue->tracingEnabled();
 
         auto submitDrawWork = [&](const auto* tracerPtr) {
@@ -2663,8 +4619,11 @@ extern "C"
                              alignment,
                              clearColor,
                              scaleFactor,
-                             tracerPtr](rive::DrawKey drawKey,
-                                        rive::CommandServer* server) {
+                             pipelined,
+                             tracerPtr,
+                             requestedAt = FramePipelineStats::Clock::now()](
+                                rive::DrawKey drawKey,
+                                rive::CommandServer* server) {
                 executeDrawWork(tracerPtr,
                                 commandQueue,
                                 renderContext,
@@ -2675,7 +4634,9 @@ extern "C"
                                 alignment,
                                 clearColor,
                                 scaleFactor,
+                                pipelined,
                                 drawKey,
+                                requestedAt,
                                 server);
             };
             commandQueue->draw(handleFromLong<rive::DrawKey>(drawKey),
@@ -2692,14 +4653,69 @@ extern "C"
         }
     }
 
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppPresentPendingFrame(
+        JNIEnv*,
+        jobject,
+        jlong ref,
+        jlong renderContextRef,
+        jlong surfaceRef)
+    {
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        auto* renderContext =
+            reinterpret_cast<RenderContext*>(renderContextRef);
+        auto* nativeSurface = reinterpret_cast<RenderSurface*>(surfaceRef);
+        const bool enableTracing = commandQueue->tracingEnabled();
+        commandQueue->runOnce([=](rive::CommandServer*) {
+            if (enableTracing)
+            {
+                presentPendingFrame(&defaultTracer(),
+                                    renderContext,
+                                    nativeSurface);
+            }
+            else
+            {
+                presentPendingFrame(&noopTracer(),
+                                    renderContext,
+                                    nativeSurface);
+            }
+        });
+    }
+
     JNIEXPORT void JNICALL
     Java_app_rive_core_CommandQueueJNIBridge_cppCancelDraw(JNIEnv*,
                                                            jobject,
                                                            jlong ref,
                                                            jlong drawKey)
     {
-        auto commandQueue = reinterpret_cast<rive::CommandQueue*>(ref);
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
         commandQueue->cancelDraw(handleFromLong<rive::DrawKey>(drawKey));
+        commandQueue->runOnce([commandQueue, drawKey](rive::CommandServer*) {
+            commandQueue->drawDirtyTracker().removeDrawKey(
+                static_cast<uint64_t>(drawKey));
+        });
+    }
+
+    JNIEXPORT jlongArray JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppFrameTimingStats(JNIEnv* env,
+                                                                 jobject,
+                                                                 jlong ref)
+    {
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        return FrameStatsSummaryToJava(env, commandQueue->frameStats());
+    }
+
+    JNIEXPORT jint JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppCopyFrameRecords(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jlongArray jRecords)
+    {
+        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
+        return CopyFrameRecordsToJava(env,
+                                      commandQueue->frameStats(),
+                                      jRecords);
     }
 
     JNIEXPORT void JNICALL
@@ -2720,14 +4736,6 @@ extern "C"
         jint jClearColor,
         jbyteArray jBuffer)
     {
-        auto* commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref);
-        auto* renderContext =
-            reinterpret_cast<RenderContext*>(renderContextRef);
-        auto* nativeSurface = reinterpret_cast<RenderSurface*>(surfaceRef);
-        auto fit = GetFit(static_cast<uint8_t>(jFit));
-        auto alignment = GetAlignment(static_cast<uint8_t>(jAlignment));
-        auto scaleFactor = static_cast<float_t>(jScaleFactor);
-        auto clearColor = static_cast<uint32_t>(jClearColor);
         auto jExceptionClass =
             FindClass(env, "app/rive/RiveDrawToBufferException");
         if (jWidth <= 0 || jHeight <= 0)
@@ -2737,8 +4745,21 @@ extern "C"
                           "positive");
             return;
         }
-        auto width = static_cast<uint32_t>(jWidth);
-        auto height = static_cast<uint32_t>(jHeight);
+        DrawToBufferRequest request{
+            .commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref),
+            .renderContext = reinterpret_cast<RenderContext*>(renderContextRef),
+            .nativeSurface = reinterpret_cast<RenderSurface*>(surfaceRef),
+            .artboardHandle =
+                handleFromLong<rive::ArtboardHandle>(artboardHandleRef),
+            .stateMachineHandle =
+                handleFromLong<rive::StateMachineHandle>(stateMachineHandleRef),
+            .width = static_cast<uint32_t>(jWidth),
+            .height = static_cast<uint32_t>(jHeight),
+            .fit = GetFit(static_cast<uint8_t>(jFit)),
+            .alignment = GetAlignment(static_cast<uint8_t>(jAlignment)),
+            .scaleFactor = static_cast<float_t>(jScaleFactor),
+            .clearColor = static_cast<uint32_t>(jClearColor),
+        };
         auto* pixels = reinterpret_cast<uint8_t*>(
             env->GetByteArrayElements(jBuffer, nullptr));
         if (pixels == nullptr)
@@ -2750,136 +4771,203 @@ extern "C"
             return;
         }
 
-        // Success case plus any potential errors producing the drawn buffer
-        enum class DrawResult
-        {
-            Success,
-            ArtboardNull,
-            StateMachineNull,
-            RenderTargetUnavailable,
-        };
-
         // Be sure all pathways signal completion with `set_value` before
         // returning to avoid deadlock.
-        auto completionPromise = std::make_shared<std::promise<DrawResult>>();
-        auto drawWork = [commandQueue,
-                         renderContext,
-                         nativeSurface,
-                         artboardHandleRef,
-                         stateMachineHandleRef,
-                         width,
-                         height,
-                         fit,
-                         alignment,
-                         scaleFactor,
-                         clearColor,
-                         pixels,
-                         completionPromise](rive::DrawKey drawKey,
-                                            rive::CommandServer* server) {
-            auto artboard = server->getArtboardInstance(
-                handleFromLong<rive::ArtboardHandle>(artboardHandleRef));
-            if (artboard == nullptr)
+        auto completionPromise =
+            std::make_shared<std::promise<DrawToBufferResult>>();
+        auto drawWork = [request, pixels, completionPromise](
+                            rive::DrawKey drawKey,
+                            rive::CommandServer* server) {
+            auto result = drawForReadback(request, drawKey, server);
+            if (result == DrawToBufferResult::Success &&
+                !request.renderContext->readPixels(request.nativeSurface,
+                                                   request.width,
+                                                   request.height,
+                                                   pixels))
             {
-                if (commandQueue->shouldLogArtboardNull(drawKey))
-                {
-                    RiveLogE(
-                        TAG_CQ,
-                        "Draw failed: Artboard instance is null (only reported once)");
-                }
-                completionPromise->set_value(DrawResult::ArtboardNull);
-                return;
+                result = DrawToBufferResult::RenderTargetUnavailable;
             }
+            completionPromise->set_value(result);
+        };
 
-            auto stateMachine = server->getStateMachineInstance(
-                handleFromLong<rive::StateMachineHandle>(
-                    stateMachineHandleRef));
-            if (stateMachine == nullptr)
-            {
-                if (commandQueue->shouldLogStateMachineNull(drawKey))
-                {
-                    RiveLogE(
-                        TAG_CQ,
-                        "Draw failed: State machine instance is null (only reported once)");
-                }
-                completionPromise->set_value(DrawResult::StateMachineNull);
-                return;
-            }
+        request.commandQueue->draw(handleFromLong<rive::DrawKey>(drawKey),
+                                   drawWork);
+        auto result = completionPromise->get_future().get();
+        env->ReleaseByteArrayElements(jBuffer,
+                                      reinterpret_cast<jbyte*>(pixels),
+                                      0);
+
+        if (auto* error = drawToBufferError(result))
+        {
+            env->ThrowNew(jExceptionClass.get(), error);
+        }
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppDrawToBufferAsync(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jlong renderContextRef,
+        jlong surfaceRef,
+        jlong drawKey,
+        jlong artboardHandleRef,
+        jlong stateMachineHandleRef,
+        jint jWidth,
+        jint jHeight,
+        jbyte jFit,
+        jbyte jAlignment,
+        jfloat jScaleFactor,
+        jint jClearColor,
+        jbyteArray jBuffer,
+        jobject jOnComplete)
+    {
+        auto jExceptionClass =
+            FindClass(env, "app/rive/RiveDrawToBufferException");
+        if (jWidth <= 0 || jHeight <= 0)
+        {
+            env->ThrowNew(jExceptionClass.get(),
+                          "Failed to draw into buffer: dimensions must be "
+                          "positive");
+            return;
+        }
+        const auto byteCount = static_cast<size_t>(jWidth) * jHeight * 4;
+        if (static_cast<size_t>(env->GetArrayLength(jBuffer)) < byteCount)
+        {
+            env->ThrowNew(jExceptionClass.get(),
+                          "Failed to draw into buffer: buffer is smaller "
+                          "than width * height * 4 bytes");
+            return;
+        }
+        DrawToBufferRequest request{
+            .commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref),
+            .renderContext = reinterpret_cast<RenderContext*>(renderContextRef),
+            .nativeSurface = reinterpret_cast<RenderSurface*>(surfaceRef),
+            .artboardHandle =
+                handleFromLong<rive::ArtboardHandle>(artboardHandleRef),
+            .stateMachineHandle =
+                handleFromLong<rive::StateMachineHandle>(stateMachineHandleRef),
+            .width = static_cast<uint32_t>(jWidth),
+            .height = static_cast<uint32_t>(jHeight),
+            .fit = GetFit(static_cast<uint8_t>(jFit)),
+            .alignment = GetAlignment(static_cast<uint8_t>(jAlignment)),
+            .scaleFactor = static_cast<float_t>(jScaleFactor),
+            .clearColor = static_cast<uint32_t>(jClearColor),
+        };
 
-            auto concreteRenderTarget =
-                renderContext->beginFrame(nativeSurface);
-            if (concreteRenderTarget == nullptr ||
-                concreteRenderTarget->width() == 0 ||
-                concreteRenderTarget->height() == 0)
+        // Global references keep the buffer and the Kotlin callback alive
+        // until the readback completes on the command server thread.
+        jobject jGlobalBuffer = env->NewGlobalRef(jBuffer);
+        jobject jGlobalOnComplete = env->NewGlobalRef(jOnComplete);
+        // Copies the pixels, if any, into the buffer, then calls back with
+        // null or the error message.
+        auto complete = [jGlobalBuffer, jGlobalOnComplete, byteCount](
+                            const uint8_t* pixels,
+                            const char* error) {
+            auto* env = GetJNIEnv();
+            if (env == nullptr)
             {
-                completionPromise->set_value(
-                    DrawResult::RenderTargetUnavailable);
+                RiveLogE(TAG_CQ, "Failed to get command server JNIEnv");
                 return;
             }
-            // Retrieve the Rive RenderContext from the CommandServer
-            auto factory =
-                reinterpret_cast<CommandServerFactory*>(server->factory());
-            auto riveContext = factory->getRenderContext()->riveContext.get();
-
-            riveContext->beginFrame(rive::gpu::RenderContext::FrameDescriptor{
-                .renderTargetWidth = concreteRenderTarget->width(),
-                .renderTargetHeight = concreteRenderTarget->height(),
-                .loadAction = rive::gpu::LoadAction::clear,
-                .clearColor = clearColor,
-            });
-
-            auto renderer = rive::RiveRenderer(riveContext);
-
-            renderer.align(
-                fit,
-                alignment,
-                rive::AABB(
-                    0.0f,
-                    0.0f,
-                    static_cast<float_t>(concreteRenderTarget->width()),
-                    static_cast<float_t>(concreteRenderTarget->height())),
-                artboard->bounds(),
-                scaleFactor);
-            artboard->draw(&renderer);
-
-            if (!renderContext->flush(nativeSurface) ||
-                !renderContext->readPixels(nativeSurface,
-                                           width,
-                                           height,
-                                           pixels))
+            if (pixels != nullptr)
             {
-                completionPromise->set_value(
-                    DrawResult::RenderTargetUnavailable);
-                return;
+                env->SetByteArrayRegion(
+                    static_cast<jbyteArray>(jGlobalBuffer),
+                    0,
+                    static_cast<jsize>(byteCount),
+                    reinterpret_cast<const jbyte*>(pixels));
             }
-            completionPromise->set_value(DrawResult::Success);
+            invokeReadbackCallback(env, jGlobalOnComplete, error);
+            env->DeleteGlobalRef(jGlobalBuffer);
+            env->DeleteGlobalRef(jGlobalOnComplete);
         };
 
-        commandQueue->draw(handleFromLong<rive::DrawKey>(drawKey), drawWork);
-        auto result = completionPromise->get_future().get();
-        env->ReleaseByteArrayElements(jBuffer,
-                                      reinterpret_cast<jbyte*>(pixels),
-                                      0);
+        queueReadback(request, drawKey, nullptr, std::move(complete));
+    }
 
-        switch (result)
+    JNIEXPORT void JNICALL
+    Java_app_rive_core_CommandQueueJNIBridge_cppDrawToDirectBufferAsync(
+        JNIEnv* env,
+        jobject,
+        jlong ref,
+        jlong renderContextRef,
+        jlong surfaceRef,
+        jlong drawKey,
+        jlong artboardHandleRef,
+        jlong stateMachineHandleRef,
+        jint jWidth,
+        jint jHeight,
+        jbyte jFit,
+        jbyte jAlignment,
+        jfloat jScaleFactor,
+        jint jClearColor,
+        jobject jBuffer,
+        jobject jOnComplete)
+    {
+        auto jExceptionClass =
+            FindClass(env, "app/rive/RiveDrawToBufferException");
+        if (jWidth <= 0 || jHeight <= 0)
         {
-            case DrawResult::Success:
-                break;
-            case DrawResult::ArtboardNull:
-                env->ThrowNew(
-                    jExceptionClass.get(),
-                    "Failed to draw into buffer: Artboard instance is null");
-                break;
-            case DrawResult::StateMachineNull:
-                env->ThrowNew(
-                    jExceptionClass.get(),
-                    "Failed to draw into buffer: State machine instance is null");
-                break;
-            case DrawResult::RenderTargetUnavailable:
-                env->ThrowNew(
-                    jExceptionClass.get(),
-                    "Failed to draw into buffer: render target is unavailable");
-                break;
+            env->ThrowNew(jExceptionClass.get(),
+                          "Failed to draw into buffer: dimensions must be "
+                          "positive");
+            return;
+        }
+        auto* address =
+            static_cast<uint8_t*>(env->GetDirectBufferAddress(jBuffer));
+        if (address == nullptr)
+        {
+            env->ThrowNew(jExceptionClass.get(),
+                          "Failed to draw into buffer: buffer is not a "
+                          "direct ByteBuffer");
+            return;
+        }
+        const auto byteCount = static_cast<size_t>(jWidth) * jHeight * 4;
+        if (static_cast<size_t>(env->GetDirectBufferCapacity(jBuffer)) <
+            byteCount)
+        {
+            env->ThrowNew(jExceptionClass.get(),
+                          "Failed to draw into buffer: buffer is smaller "
+                          "than width * height * 4 bytes");
+            return;
         }
+        DrawToBufferRequest request{
+            .commandQueue = reinterpret_cast<CommandQueueWithThread*>(ref),
+            .renderContext = reinterpret_cast<RenderContext*>(renderContextRef),
+            .nativeSurface = reinterpret_cast<RenderSurface*>(surfaceRef),
+            .artboardHandle =
+                handleFromLong<rive::ArtboardHandle>(artboardHandleRef),
+            .stateMachineHandle =
+                handleFromLong<rive::StateMachineHandle>(stateMachineHandleRef),
+            .width = static_cast<uint32_t>(jWidth),
+            .height = static_cast<uint32_t>(jHeight),
+            .fit = GetFit(static_cast<uint8_t>(jFit)),
+            .alignment = GetAlignment(static_cast<uint8_t>(jAlignment)),
+            .scaleFactor = static_cast<float_t>(jScaleFactor),
+            .clearColor = static_cast<uint32_t>(jClearColor),
+        };
+
+        // The buffer's memory is outside the Java heap and never moves, so
+        // the render context writes the pixels straight into it on the
+        // command server thread, with no pinning, JNI array copy, or
+        // allocation. The global reference keeps the buffer from being
+        // collected until then.
+        jobject jGlobalBuffer = env->NewGlobalRef(jBuffer);
+        jobject jGlobalOnComplete = env->NewGlobalRef(jOnComplete);
+        auto complete = [jGlobalBuffer, jGlobalOnComplete](const uint8_t*,
+                                                           const char* error) {
+            auto* env = GetJNIEnv();
+            if (env == nullptr)
+            {
+                RiveLogE(TAG_CQ, "Failed to get command server JNIEnv");
+                return;
+            }
+            invokeReadbackCallback(env, jGlobalOnComplete, error);
+            env->DeleteGlobalRef(jGlobalBuffer);
+            env->DeleteGlobalRef(jGlobalOnComplete);
+        };
+        queueReadback(request, drawKey, address, std::move(complete));
     }
 
     JNIEXPORT void JNICALL
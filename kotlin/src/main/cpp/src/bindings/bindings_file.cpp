@@ -7,6 +7,8 @@
 #include "helpers/general.hpp"
 #include "helpers/jni_resource.hpp"
 #include "helpers/jni_string.hpp"
+#include "helpers/mapped_file.hpp"
+#include "jni_refs.hpp"
 #include "rive/artboard.hpp"
 #include "rive/bindable_artboard.hpp"
 #include "rive/file.hpp"
@@ -40,6 +42,34 @@ extern "C"
         return reinterpret_cast<jlong>(file);
     }
 
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_runtime_kotlin_core_File_importFd(JNIEnv*,
+                                                    jobject,
+                                                    jint fd,
+                                                    jlong offset,
+                                                    jlong length,
+                                                    jint type,
+                                                    jlong fileAssetLoader)
+    {
+        auto rendererType = static_cast<RendererType>(type);
+        auto* assetLoader =
+            reinterpret_cast<rive::FileAssetLoader*>(fileAssetLoader);
+
+        // Import straight from the page cache. Nothing in the imported file
+        // refers back to these bytes, so the mapping is released on return.
+        MappedFile mapping(fd,
+                           static_cast<off_t>(offset),
+                           static_cast<size_t>(length));
+        if (!mapping.valid())
+        {
+            return ThrowRiveException("Failed to map Rive file.");
+        }
+        return Import(mapping.data(),
+                      static_cast<jint>(mapping.size()),
+                      rendererType,
+                      assetLoader);
+    }
+
     JNIEXPORT jlong JNICALL
     Java_app_rive_runtime_kotlin_core_File_cppArtboardByName(JNIEnv* env,
                                                              jobject,
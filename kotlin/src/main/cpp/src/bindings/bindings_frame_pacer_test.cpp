@@ -0,0 +1,110 @@
+/**
+ * Testing functions for the renderer's frame pacer.
+ */
+#ifdef DEBUG
+
+#include <jni.h>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "helpers/frame_pacer.hpp"
+
+namespace
+{
+using namespace rive_android;
+
+/**
+ * Runs a FramePacer against a simulated clock, display, and worker. The
+ * display ticks every tickInterval, and the worker runs scheduled frames one
+ * at a time, each taking frameCost, or never finishing if frameCost is 0.
+ *
+ * @return The pacer's stats after the last tick, in the order of
+ *   FramePacer::Stats.
+ */
+std::vector<jlong> Simulate(FramePacer::Duration tickInterval,
+                            FramePacer::Duration frameCost,
+                            int ticks)
+{
+    struct Frame
+    {
+        FramePacer::TimePoint started;
+        FramePacer::TimePoint finished;
+        FramePacer::TimePoint presentDeadline;
+    };
+
+    // Not the zero time point, which the pacer treats as no tick yet.
+    FramePacer::TimePoint now = FramePacer::TimePoint{} + tickInterval;
+    FramePacer pacer([&now] { return now; });
+    std::deque<Frame> inFlight;
+    for (int tick = 0; tick < ticks; tick++)
+    {
+        const auto tickTime = now;
+        while (frameCost.count() > 0 && !inFlight.empty() &&
+               inFlight.front().finished <= tickTime)
+        {
+            now = inFlight.front().finished;
+            pacer.onFrameFinished(inFlight.front().started,
+                                  inFlight.front().presentDeadline);
+            inFlight.pop_front();
+        }
+        now = tickTime;
+
+        auto result = pacer.onTick(static_cast<uint8_t>(inFlight.size()));
+        if (result.decision == FramePacer::Decision::Schedule)
+        {
+            // The worker starts a frame once the one before it finishes.
+            const auto started =
+                inFlight.empty() ? now : inFlight.back().finished;
+            inFlight.push_back(
+                {started, started + frameCost, result.presentDeadline});
+        }
+        now += tickInterval;
+    }
+
+    const auto stats = pacer.stats();
+    return {
+        static_cast<jlong>(stats.scheduledFrames),
+        static_cast<jlong>(stats.coalescedFrames),
+        static_cast<jlong>(stats.droppedFrames),
+        static_cast<jlong>(stats.lateFrames),
+        static_cast<jlong>(stats.predictedFrameCost.count()),
+        static_cast<jlong>(stats.tickInterval.count()),
+        static_cast<jlong>(stats.tickDivisor),
+    };
+}
+} // namespace
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    JNIEXPORT jlongArray JNICALL
+    Java_app_rive_runtime_kotlin_core_NativeFramePacerTestHelper_cppSimulate(
+        JNIEnv* env,
+        jobject,
+        jlong tickIntervalNanos,
+        jlong frameCostNanos,
+        jint ticks)
+    {
+        if (tickIntervalNanos <= 0 || frameCostNanos < 0 || ticks < 0)
+        {
+            return nullptr;
+        }
+        const std::vector<jlong> results =
+            Simulate(FramePacer::Duration(tickIntervalNanos),
+                     FramePacer::Duration(frameCostNanos),
+                     ticks);
+        const auto length = static_cast<jsize>(results.size());
+        jlongArray array = env->NewLongArray(length);
+        env->SetLongArrayRegion(array, 0, length, results.data());
+        return array;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DEBUG
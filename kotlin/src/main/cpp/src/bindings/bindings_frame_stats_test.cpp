@@ -0,0 +1,68 @@
+/**
+ * Testing functions for the per-frame stats ring.
+ */
+#ifdef DEBUG
+
+#include <jni.h>
+
+#include <memory>
+
+#include "helpers/frame_stats.hpp"
+
+namespace
+{
+using namespace rive_android;
+
+/**
+ * Adds each record of a flat array, FrameStats::kRecordFields values each in
+ * FrameRecord's field order, to new stats.
+ */
+std::unique_ptr<FrameStats> MakeStats(JNIEnv* env, jlongArray jRecords)
+{
+    auto stats = std::make_unique<FrameStats>();
+    const jsize length = env->GetArrayLength(jRecords);
+    jlong* values = env->GetLongArrayElements(jRecords, nullptr);
+    for (jsize i = 0; i + FrameStats::kRecordFields <= length;
+         i += FrameStats::kRecordFields)
+    {
+        FrameRecord record;
+        record.advanceNanos = values[i];
+        record.drawNanos = values[i + 1];
+        record.flushNanos = values[i + 2];
+        record.presentNanos = values[i + 3];
+        record.queueWaitNanos = values[i + 4];
+        stats->add(record);
+    }
+    env->ReleaseLongArrayElements(jRecords, values, JNI_ABORT);
+    return stats;
+}
+} // namespace
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    JNIEXPORT jlongArray JNICALL
+    Java_app_rive_runtime_kotlin_core_NativeFrameStatsTestHelper_cppSummarize(
+        JNIEnv* env,
+        jobject,
+        jlongArray jRecords)
+    {
+        return FrameStatsSummaryToJava(env, *MakeStats(env, jRecords));
+    }
+
+    JNIEXPORT jint JNICALL
+    Java_app_rive_runtime_kotlin_core_NativeFrameStatsTestHelper_cppCopyRecords(
+        JNIEnv* env,
+        jobject,
+        jlongArray jRecords,
+        jlongArray jOut)
+    {
+        return CopyFrameRecordsToJava(env, *MakeStats(env, jRecords), jOut);
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DEBUG
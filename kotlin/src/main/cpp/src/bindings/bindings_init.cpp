@@ -4,6 +4,7 @@
 #include "helpers/general.hpp"
 #include "helpers/jni_resource.hpp"
 #include "helpers/rive_log.hpp"
+#include "jni_natives.hpp"
 #include "jni_refs.hpp"
 #include "models/dimensions_helper.hpp"
 
@@ -49,6 +50,22 @@ extern "C"
     {
         // Assign the global JVM
         g_JVM = jvm;
+
+        JNIEnv* env = nullptr;
+        if (jvm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) !=
+            JNI_OK)
+        {
+            return JNI_ERR;
+        }
+        // The registry gates API-specific classes on the SDK version.
+        SetSDKVersion();
+        // Resolve JNI classes and IDs once, while the app's class loader is
+        // still on the stack, instead of on every call.
+        InitJNIRefs(env);
+        // Bind natives up front; the library exports no Java_ symbols for
+        // the runtime to find lazily.
+        RegisterNativeMethods(env);
+
         // Standard JNI version to return on Android
         return JNI_VERSION_1_6;
     }
@@ -66,7 +83,6 @@ extern "C"
         t.detach();
 #endif
         // pretty much considered the entrypoint.
-        SetSDKVersion();
         // Initialize RiveLog helper for logging from C++
         InitializeRiveLog();
 
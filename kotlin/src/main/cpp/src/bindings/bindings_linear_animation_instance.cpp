@@ -45,9 +45,7 @@ extern "C"
                     enumField = GetNoneLoopField();
                     break;
             }
-            jclass jClass = GetLoopClass();
-            loopValue = env->GetStaticObjectField(jClass, enumField);
-            env->DeleteLocalRef(jClass);
+            loopValue = env->GetStaticObjectField(GetLoopClass(), enumField);
         }
 
         return loopValue;
@@ -100,13 +98,8 @@ extern "C"
             resultFieldId = GetAdvanceResultNoneField();
         }
 
-        jclass jAdvanceResultClass = GetAdvanceResultClass();
-
-        jobject advanceResultValue =
-            env->GetStaticObjectField(jAdvanceResultClass, resultFieldId);
-        env->DeleteLocalRef(jAdvanceResultClass);
-
-        return advanceResultValue;
+        return env->GetStaticObjectField(GetAdvanceResultClass(),
+                                         resultFieldId);
     }
 
     JNIEXPORT void JNICALL
@@ -0,0 +1,209 @@
+/**
+ * Testing functions for the image ingestion pixel kernels.
+ */
+#ifdef DEBUG
+
+#include <jni.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "helpers/pixel_kernels.hpp"
+
+namespace
+{
+using namespace rive_android;
+
+/**
+ * Pixels covering every (channel, alpha) pair in each of the three color
+ * channels, followed by random pixels. The count is not a multiple of any
+ * vector width, so the scalar tails are covered too.
+ */
+std::vector<uint32_t> MakeTestPixels()
+{
+    std::vector<uint32_t> pixels;
+    for (uint32_t a = 0; a < 256; a++)
+    {
+        for (uint32_t c = 0; c < 256; c++)
+        {
+            pixels.push_back(a << 24 | c << 16 | (255 - c) << 8 |
+                             ((c * 7) & 0xFF));
+        }
+    }
+    std::mt19937 random(1);
+    for (int i = 0; i < 1001; i++)
+    {
+        pixels.push_back(static_cast<uint32_t>(random()));
+    }
+    return pixels;
+}
+
+/**
+ * Runs each kernel and its scalar reference over the test pixels, at offsets
+ * that misalign them.
+ *
+ * @return The number of kernel runs whose output differed.
+ */
+jint CountMismatches()
+{
+    const auto pixels = MakeTestPixels();
+    // The same bytes, read as RGBA.
+    const auto* bytes = reinterpret_cast<const uint8_t*>(pixels.data());
+    jint mismatches = 0;
+    for (size_t offset : {0, 1, 3})
+    {
+        const size_t count = pixels.size() - offset;
+        std::vector<uint8_t> bytesOut(count * 4);
+        std::vector<uint8_t> bytesExpected(count * 4);
+        std::vector<uint32_t> intsOut(count);
+        std::vector<uint32_t> intsExpected(count);
+
+        premultiplyRGBA(bytes + offset * 4, bytesOut.data(), count);
+        scalar::premultiplyRGBA(bytes + offset * 4,
+                                bytesExpected.data(),
+                                count);
+        mismatches += bytesOut != bytesExpected;
+
+        for (bool alpha : {false, true})
+        {
+            argbToRGBA(pixels.data() + offset, bytesOut.data(), count, alpha);
+            scalar::argbToRGBA(pixels.data() + offset,
+                               bytesExpected.data(),
+                               count,
+                               alpha);
+            mismatches += bytesOut != bytesExpected;
+
+            rgbaToARGB(bytes + offset * 4, intsOut.data(), count, alpha);
+            scalar::rgbaToARGB(bytes + offset * 4,
+                               intsExpected.data(),
+                               count,
+                               alpha);
+            mismatches += intsOut != intsExpected;
+        }
+
+        unpremultiplyARGB(pixels.data() + offset, intsOut.data(), count);
+        scalar::unpremultiplyARGB(pixels.data() + offset,
+                                  intsExpected.data(),
+                                  count);
+        mismatches += intsOut != intsExpected;
+    }
+
+    // In place.
+    auto inPlace = pixels;
+    std::vector<uint8_t> expected(pixels.size() * 4);
+    argbToRGBA(inPlace.data(),
+               reinterpret_cast<uint8_t*>(inPlace.data()),
+               inPlace.size(),
+               true);
+    scalar::argbToRGBA(pixels.data(), expected.data(), pixels.size(), true);
+    mismatches +=
+        memcmp(inPlace.data(), expected.data(), expected.size()) != 0;
+    return mismatches;
+}
+
+template <typename Fn> jlong TimeNanos(int iterations, Fn&& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        fn();
+    }
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+} // namespace
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    JNIEXPORT jint JNICALL
+    Java_app_rive_runtime_kotlin_core_NativePixelKernelsTestHelper_cppCountMismatches(
+        JNIEnv*,
+        jobject)
+    {
+        return CountMismatches();
+    }
+
+    JNIEXPORT jlongArray JNICALL
+    Java_app_rive_runtime_kotlin_core_NativePixelKernelsTestHelper_cppTimeKernels(
+        JNIEnv* env,
+        jobject,
+        jint pixelCount,
+        jint iterations,
+        jboolean vector)
+    {
+        if (pixelCount <= 0 || iterations <= 0)
+        {
+            return nullptr;
+        }
+        const auto count = static_cast<size_t>(pixelCount);
+        std::vector<uint32_t> ints(count);
+        std::mt19937 random(1);
+        for (auto& pixel : ints)
+        {
+            pixel = static_cast<uint32_t>(random());
+        }
+        const auto* bytes = reinterpret_cast<const uint8_t*>(ints.data());
+        std::vector<uint8_t> bytesOut(count * 4);
+        std::vector<uint32_t> intsOut(count);
+
+        // In the order of the kernels in pixel_kernels.hpp.
+        const jlong results[] = {
+            TimeNanos(iterations,
+                      [&] {
+                          vector ? premultiplyRGBA(bytes,
+                                                   bytesOut.data(),
+                                                   count)
+                                 : scalar::premultiplyRGBA(bytes,
+                                                           bytesOut.data(),
+                                                           count);
+                      }),
+            TimeNanos(iterations,
+                      [&] {
+                          vector ? argbToRGBA(ints.data(),
+                                              bytesOut.data(),
+                                              count,
+                                              true)
+                                 : scalar::argbToRGBA(ints.data(),
+                                                      bytesOut.data(),
+                                                      count,
+                                                      true);
+                      }),
+            TimeNanos(iterations,
+                      [&] {
+                          vector ? rgbaToARGB(bytes,
+                                              intsOut.data(),
+                                              count,
+                                              true)
+                                 : scalar::rgbaToARGB(bytes,
+                                                      intsOut.data(),
+                                                      count,
+                                                      true);
+                      }),
+            TimeNanos(iterations,
+                      [&] {
+                          vector ? unpremultiplyARGB(ints.data(),
+                                                     intsOut.data(),
+                                                     count)
+                                 : scalar::unpremultiplyARGB(ints.data(),
+                                                             intsOut.data(),
+                                                             count);
+                      }),
+        };
+        constexpr auto length = static_cast<jsize>(std::size(results));
+        jlongArray array = env->NewLongArray(length);
+        env->SetLongArrayRegion(array, 0, length, results);
+        return array;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DEBUG
@@ -2,6 +2,8 @@
 #include <android/native_window_jni.h>
 #include <jni.h>
 
+#include <iterator>
+
 #include "models/render_context.hpp"
 #include "models/render_surface.hpp"
 #include "models/render_surface_gl.hpp"
@@ -83,6 +85,30 @@ extern "C"
                         static_cast<uint32_t>(height));
     }
 
+    JNIEXPORT jlongArray JNICALL
+    Java_app_rive_core_RiveSurface_cppFramePipelineStats(JNIEnv* env,
+                                                         jclass,
+                                                         jlong surfaceRef)
+    {
+        auto surface = reinterpret_cast<RenderSurface*>(surfaceRef);
+        const auto& stats = surface->pipelineStats();
+        const jlong values[] = {
+            static_cast<jlong>(stats.directFrames.load()),
+            static_cast<jlong>(stats.directDrawNanos.load()),
+            static_cast<jlong>(stats.pipelinedFrames.load()),
+            static_cast<jlong>(stats.pipelinedDrawNanos.load()),
+            static_cast<jlong>(stats.presents.load()),
+            static_cast<jlong>(stats.presentNanos.load()),
+            static_cast<jlong>(stats.deferredPresents.load()),
+            static_cast<jlong>(stats.addedLatencyNanos.load()),
+            static_cast<jlong>(stats.skippedFrames.load()),
+        };
+        constexpr auto length = static_cast<jsize>(std::size(values));
+        jlongArray array = env->NewLongArray(length);
+        env->SetLongArrayRegion(array, 0, length, values);
+        return array;
+    }
+
 #ifdef RIVE_VULKAN
     JNIEXPORT jlong JNICALL
     Java_app_rive_core_RenderContextVulkan_cppConstructor(JNIEnv*, jobject)
@@ -1,6 +1,9 @@
 #include <android/native_window_jni.h>
 #include <jni.h>
 
+#include <chrono>
+#include <iterator>
+
 #include "helpers/general.hpp"
 #include "helpers/jni_resource.hpp"
 #include "helpers/worker_thread.hpp"
@@ -194,4 +197,77 @@ extern "C"
     {
         return reinterpret_cast<JNIRenderer*>(rendererRef)->averageFps();
     }
+
+    JNIEXPORT jlongArray JNICALL
+    Java_app_rive_runtime_kotlin_renderers_Renderer_cppWorkerLaneStats(
+        JNIEnv* env,
+        jobject,
+        jlong rendererRef,
+        jint lane)
+    {
+        auto stats = reinterpret_cast<JNIRenderer*>(rendererRef)
+                         ->workerLaneStats(static_cast<WorkLane>(lane));
+        const jlong values[] = {
+            static_cast<jlong>(stats.queueDepth),
+            static_cast<jlong>(stats.peakQueueDepth),
+            static_cast<jlong>(stats.ranCount),
+            static_cast<jlong>(stats.droppedCount),
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                stats.totalWait)
+                .count(),
+            std::chrono::duration_cast<std::chrono::nanoseconds>(stats.maxWait)
+                .count(),
+        };
+        constexpr auto length = static_cast<jsize>(std::size(values));
+        jlongArray array = env->NewLongArray(length);
+        env->SetLongArrayRegion(array, 0, length, values);
+        return array;
+    }
+
+    JNIEXPORT jlongArray JNICALL
+    Java_app_rive_runtime_kotlin_renderers_Renderer_cppFramePacingStats(
+        JNIEnv* env,
+        jobject,
+        jlong rendererRef)
+    {
+        auto stats =
+            reinterpret_cast<JNIRenderer*>(rendererRef)->framePacingStats();
+        const jlong values[] = {
+            static_cast<jlong>(stats.scheduledFrames),
+            static_cast<jlong>(stats.coalescedFrames),
+            static_cast<jlong>(stats.droppedFrames),
+            static_cast<jlong>(stats.lateFrames),
+            stats.predictedFrameCost.count(),
+            stats.tickInterval.count(),
+            static_cast<jlong>(stats.tickDivisor),
+        };
+        constexpr auto length = static_cast<jsize>(std::size(values));
+        jlongArray array = env->NewLongArray(length);
+        env->SetLongArrayRegion(array, 0, length, values);
+        return array;
+    }
+
+    JNIEXPORT jlongArray JNICALL
+    Java_app_rive_runtime_kotlin_renderers_Renderer_cppFrameTimingStats(
+        JNIEnv* env,
+        jobject,
+        jlong rendererRef)
+    {
+        return FrameStatsSummaryToJava(
+            env,
+            reinterpret_cast<JNIRenderer*>(rendererRef)->frameStats());
+    }
+
+    JNIEXPORT jint JNICALL
+    Java_app_rive_runtime_kotlin_renderers_Renderer_cppCopyFrameRecords(
+        JNIEnv* env,
+        jobject,
+        jlong rendererRef,
+        jlongArray jRecords)
+    {
+        return CopyFrameRecordsToJava(
+            env,
+            reinterpret_cast<JNIRenderer*>(rendererRef)->frameStats(),
+            jRecords);
+    }
 }
@@ -4,10 +4,13 @@
 
 #include <jni.h>
 
+#include "helpers/conversions.hpp"
+#include "helpers/event_report_buffer.hpp"
 #include "helpers/general.hpp"
 #include "helpers/jni_exception_handler.hpp"
 #include "helpers/jni_string.hpp"
 #include "jni_refs.hpp"
+#include "rive/animation/state_machine_instance.hpp"
 #include "rive/custom_property_boolean.hpp"
 #include "rive/custom_property_number.hpp"
 #include "rive/custom_property_string.hpp"
@@ -39,10 +42,7 @@ extern "C"
 
     jobject GetProperties(JNIEnv* env, rive::Event* event)
     {
-        jmethodID putMethod = env->GetMethodID(
-            GetHashMapClass(),
-            "put",
-            "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+        jmethodID putMethod = GetHashMapPutMethodId();
 
         jobject propertiesObject =
             env->NewObject(GetHashMapClass(), GetHashMapConstructorId());
@@ -188,10 +188,7 @@ extern "C"
     {
         jclass hashMapClass = GetHashMapClass();
         jmethodID hashMapConstructor = GetHashMapConstructorId();
-        jmethodID putMethod = env->GetMethodID(
-            hashMapClass,
-            "put",
-            "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+        jmethodID putMethod = GetHashMapPutMethodId();
         jobject eventObject = env->NewObject(hashMapClass, hashMapConstructor);
 
         auto* event = reinterpret_cast<rive::Event*>(ref);
@@ -247,6 +244,45 @@ extern "C"
         return eventObject;
     }
 
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_runtime_kotlin_core_ReportedEvents_constructor(JNIEnv*,
+                                                                 jobject)
+    {
+        return reinterpret_cast<jlong>(new EventReportBuffer());
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_runtime_kotlin_core_ReportedEvents_cppDelete(JNIEnv*,
+                                                               jobject,
+                                                               jlong ref)
+    {
+        delete reinterpret_cast<EventReportBuffer*>(ref);
+    }
+
+    JNIEXPORT jint JNICALL
+    Java_app_rive_runtime_kotlin_core_ReportedEvents_cppWrite(
+        JNIEnv*,
+        jobject,
+        jlong ref,
+        jlong stateMachineRef)
+    {
+        auto* buffer = reinterpret_cast<EventReportBuffer*>(ref);
+        buffer->write(
+            reinterpret_cast<rive::StateMachineInstance*>(stateMachineRef));
+        return SizeTToInt(buffer->size());
+    }
+
+    JNIEXPORT jobject JNICALL
+    Java_app_rive_runtime_kotlin_core_ReportedEvents_cppView(JNIEnv* env,
+                                                             jobject,
+                                                             jlong ref)
+    {
+        auto* buffer = reinterpret_cast<EventReportBuffer*>(ref);
+        return env->NewDirectByteBuffer(
+            buffer->data(),
+            static_cast<jlong>(buffer->capacity()));
+    }
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,27 @@
+#include <jni.h>
+
+#include "helpers/rive_log.hpp"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    using namespace rive_android;
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_RiveLog_cppSetNativeLogLevel(JNIEnv*,
+                                               jobject,
+                                               jint priority)
+    {
+        SetRiveLogMinPriority(priority);
+    }
+
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_RiveLog_cppDroppedMessageCount(JNIEnv*, jobject)
+    {
+        return static_cast<jlong>(RiveLogDroppedMessages());
+    }
+
+#ifdef __cplusplus
+}
+#endif
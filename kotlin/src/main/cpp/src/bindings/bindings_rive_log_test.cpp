@@ -0,0 +1,54 @@
+/**
+ * Testing functions for native logging.
+ */
+#ifdef DEBUG
+
+#include <android/log.h>
+#include <jni.h>
+#include <string>
+
+#include "helpers/jni_string.hpp"
+#include "helpers/rive_log.hpp"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    using namespace rive_android;
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_runtime_kotlin_core_NativeRiveLogTestHelper_cppLog(
+        JNIEnv* env,
+        jobject,
+        jint priority,
+        jstring tag,
+        jstring message)
+    {
+        const std::string nativeTag = JStringToString(env, tag);
+        const std::string nativeMessage = JStringToString(env, message);
+        switch (priority)
+        {
+            case ANDROID_LOG_VERBOSE:
+                RiveLogV(nativeTag.c_str(), "%s", nativeMessage.c_str());
+                break;
+            case ANDROID_LOG_DEBUG:
+                RiveLogD(nativeTag.c_str(), "%s", nativeMessage.c_str());
+                break;
+            case ANDROID_LOG_INFO:
+                RiveLogI(nativeTag.c_str(), "%s", nativeMessage.c_str());
+                break;
+            case ANDROID_LOG_WARN:
+                RiveLogW(nativeTag.c_str(), "%s", nativeMessage.c_str());
+                break;
+            case ANDROID_LOG_ERROR:
+            default:
+                RiveLogE(nativeTag.c_str(), "%s", nativeMessage.c_str());
+                break;
+        }
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DEBUG
@@ -1,7 +1,5 @@
 #include <jni.h>
-#include <string>
 
-#include "helpers/jni_string.hpp"
 #include "models/jni_renderer.hpp"
 
 using namespace rive_android;
@@ -19,46 +17,6 @@ extern "C"
         return reinterpret_cast<JNIRenderer*>(rendererAddr)->averageFps();
     }
 
-/** TODO: explore these helpers, might be useful for a few metrics
-
-    std::string to_string(jstring jstr, JNIEnv* env)
-    {
-        return JStringToString(env, jstr);
-    }
-
-    JNIEXPORT void JNICALL
-    Java_app_rive_runtime_kotlin_RiveTextureView_cppSetPreference(JNIEnv* env,
-                                                                  jobject,
-                                                                  jstring key,
-                                                                  jstring value)
-    {
-        Settings::getInstance()->setPreference(to_string(key, env),
-                                               to_string(value, env));
-    }
-
-    JNIEXPORT float JNICALL
-    Java_app_rive_runtime_kotlin_RiveTextureView_cppGetPipelineFrameTimeNS(
-        JNIEnv*, jobject)
-    {
-        return Renderer::getInstance()->frameTimeStats().mean();
-    }
-
-    JNIEXPORT float JNICALL
-    Java_app_rive_runtime_kotlin_RiveTextureView_cppGetPipelineFrameTimeStdDevNS(
-        JNIEnv*, jobject)
-    {
-        return sqrt(Renderer::getInstance()->frameTimeStats().var());
-    }
-
-    JNIEXPORT void JNICALL
-    Java_app_rive_runtime_kotlin_RiveTextureView_cppSetWorkload(JNIEnv*,
-                                                                jobject,
-                                                                jint load)
-    {
-        // It's an interesting heuristic for segmenting based on workload
-        // Renderer::getInstance()->setWorkload(load);
-    }
-*/
 #ifdef __cplusplus
 }
 #endif
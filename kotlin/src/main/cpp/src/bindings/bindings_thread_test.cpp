@@ -0,0 +1,36 @@
+/**
+ * Testing functions for thread placement.
+ */
+#ifdef DEBUG
+
+#include <jni.h>
+#include <vector>
+
+#include "helpers/jni_string.hpp"
+#include "helpers/thread.hpp"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    using namespace rive_android;
+
+    JNIEXPORT jintArray JNICALL
+    Java_app_rive_runtime_kotlin_core_NativeThreadTestHelper_cppSelectPerformanceCpus(
+        JNIEnv* env,
+        jobject,
+        jstring sysfsRoot)
+    {
+        const std::vector<int32_t> cpus = selectPerformanceCpus(
+            readCpuTopology(JStringToString(env, sysfsRoot)));
+        const auto length = static_cast<jsize>(cpus.size());
+        jintArray array = env->NewIntArray(length);
+        env->SetIntArrayRegion(array, 0, length, cpus.data());
+        return array;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DEBUG
@@ -0,0 +1,198 @@
+/**
+ * Testing functions for the worker thread's work queue.
+ */
+#ifdef DEBUG
+
+#include <jni.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "helpers/inline_task.hpp"
+#include "helpers/work_queue.hpp"
+
+namespace
+{
+using namespace rive_android;
+
+using BenchmarkTask = InlineTask<void()>;
+
+/**
+ * The mutex and condition variable queue that WorkerThread used before
+ * WorkQueue, as a baseline.
+ */
+class MutexWorkQueue
+{
+public:
+    void push(std::function<void()>&& task)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_tasks.push(std::move(task));
+        }
+        m_pushed.notify_one();
+    }
+
+    std::function<void()> pop()
+    {
+        std::unique_lock lock(m_mutex);
+        m_pushed.wait(lock, [this] { return !m_tasks.empty(); });
+        auto task = std::move(m_tasks.front());
+        m_tasks.pop();
+        return task;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_pushed;
+    std::queue<std::function<void()>> m_tasks;
+};
+
+/** Per-producer sequence tracking, only touched by the consumer. */
+struct ConsumerState
+{
+    std::vector<int> nextSequence;
+    int64_t tasksRun = 0;
+    int64_t orderViolations = 0;
+
+    void run(int producer, int sequence)
+    {
+        if (nextSequence[producer] != sequence)
+        {
+            orderViolations++;
+        }
+        nextSequence[producer] = sequence + 1;
+        tasksRun++;
+    }
+};
+
+int64_t ContextSwitches()
+{
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_nvcsw + usage.ru_nivcsw;
+}
+
+/**
+ * Pushes tasksPerProducer tasks from each of producers threads into a queue
+ * drained by one consumer thread.
+ *
+ * @return elapsed ns, mean and max enqueue ns, context switches of the whole
+ * process, tasks run, and tasks run out of their producer's order.
+ */
+template <typename Queue, typename MakeTask>
+std::vector<jlong> RunContention(int producers,
+                                 int tasksPerProducer,
+                                 MakeTask&& makeTask)
+{
+    using Clock = std::chrono::steady_clock;
+    Queue queue;
+    ConsumerState state;
+    state.nextSequence.resize(producers);
+    const int64_t total = static_cast<int64_t>(producers) * tasksPerProducer;
+
+    std::vector<int64_t> enqueueNs(producers);
+    std::vector<int64_t> maxEnqueueNs(producers);
+    const int64_t switchesBefore = ContextSwitches();
+    const auto start = Clock::now();
+
+    std::thread consumer([&] {
+        while (state.tasksRun < total)
+        {
+            queue.pop()();
+        }
+    });
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; producer++)
+    {
+        threads.emplace_back([&, producer] {
+            for (int sequence = 0; sequence < tasksPerProducer; sequence++)
+            {
+                const auto before = Clock::now();
+                queue.push(makeTask(&state, producer, sequence));
+                const int64_t ns =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        Clock::now() - before)
+                        .count();
+                enqueueNs[producer] += ns;
+                maxEnqueueNs[producer] = std::max(maxEnqueueNs[producer], ns);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    consumer.join();
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now() - start);
+    int64_t sumEnqueueNs = 0;
+    for (int64_t ns : enqueueNs)
+    {
+        sumEnqueueNs += ns;
+    }
+    return {
+        elapsed.count(),
+        total == 0 ? 0 : sumEnqueueNs / total,
+        *std::max_element(maxEnqueueNs.begin(), maxEnqueueNs.end()),
+        ContextSwitches() - switchesBefore,
+        state.tasksRun,
+        state.orderViolations,
+    };
+}
+} // namespace
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    JNIEXPORT jlongArray JNICALL
+    Java_app_rive_runtime_kotlin_core_NativeWorkQueueTestHelper_cppRunContentionBenchmark(
+        JNIEnv* env,
+        jobject,
+        jint producers,
+        jint tasksPerProducer,
+        jboolean lockFree)
+    {
+        if (producers <= 0 || tasksPerProducer < 0)
+        {
+            return nullptr;
+        }
+        auto makeTask = [](ConsumerState* state, int producer, int sequence) {
+            return [state, producer, sequence] {
+                state->run(producer, sequence);
+            };
+        };
+        auto makeInlineTask = [&](ConsumerState* state, int p, int s) {
+            return BenchmarkTask(makeTask(state, p, s));
+        };
+        auto makeFunction = [&](ConsumerState* state, int p, int s) {
+            return std::function<void()>(makeTask(state, p, s));
+        };
+        const std::vector<jlong> results =
+            lockFree ? RunContention<WorkQueue<BenchmarkTask, 256>>(
+                           producers,
+                           tasksPerProducer,
+                           makeInlineTask)
+                     : RunContention<MutexWorkQueue>(producers,
+                                                     tasksPerProducer,
+                                                     makeFunction);
+        const auto length = static_cast<jsize>(results.size());
+        jlongArray array = env->NewLongArray(length);
+        env->SetLongArrayRegion(array, 0, length, results.data());
+        return array;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DEBUG
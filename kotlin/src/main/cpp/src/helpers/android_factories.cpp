@@ -97,12 +97,14 @@ public:
             // for deletion.
             auto bufferToDelete = detachBuffer();
             rcp<GLState> glState = ref_rcp(state());
-            m_glWorker->run([bufferToDelete, glState](DrawableThreadState*) {
-                if (bufferToDelete != 0)
-                {
-                    glState->deleteBuffer(bufferToDelete);
-                }
-            });
+            m_glWorker->run(
+                [bufferToDelete, glState](DrawableThreadState*) {
+                    if (bufferToDelete != 0)
+                    {
+                        glState->deleteBuffer(bufferToDelete);
+                    }
+                },
+                WorkLane::Background);
         }
     }
 
@@ -203,7 +205,8 @@ AndroidImage::~AndroidImage()
     {
         // Delete the texture on the worker thread where the GL context is
         // current.
-        m_glWorker->run([texture](DrawableThreadState*) { texture->unref(); });
+        m_glWorker->run([texture](DrawableThreadState*) { texture->unref(); },
+                        WorkLane::Background);
     }
 }
 
@@ -20,7 +20,6 @@ namespace rive_android
     jobject ktPath =
         env->NewGlobalRef(env->NewObject(pathClass, pathConstructor));
 
-    env->DeleteLocalRef(pathClass);
     return ktPath;
 }
 
@@ -147,7 +146,6 @@ void CanvasRenderPath::addRenderPath(const rive::RenderPath* path,
         static_cast<const CanvasRenderPath*>(path)->m_ktPath,
         matrix);
 
-    env->DeleteLocalRef(matrixClass);
     env->DeleteLocalRef(matrix);
     env->DeleteLocalRef(matrixArray);
 }
@@ -202,7 +200,6 @@ void CanvasRenderPath::fillRule(rive::FillRule value)
                                         GetSetFillTypeMethodId(),
                                         fillId);
 
-    env->DeleteLocalRef(fillTypeClass);
     env->DeleteLocalRef(fillId);
 }
 
@@ -242,8 +239,6 @@ LinearGradientCanvasShader::LinearGradientCanvasShader(
 
     env->DeleteLocalRef(jcolors);
     env->DeleteLocalRef(jstops);
-    env->DeleteLocalRef(linearGradientClass);
-    env->DeleteLocalRef(tileModeClass);
     env->DeleteLocalRef(clampObject);
 }
 
@@ -281,8 +276,6 @@ RadialGradientCanvasShader::RadialGradientCanvasShader(
 
     env->DeleteLocalRef(jcolors);
     env->DeleteLocalRef(jstops);
-    env->DeleteLocalRef(radialGradientClass);
-    env->DeleteLocalRef(tileModeClass);
     env->DeleteLocalRef(clampObject);
 }
 
@@ -356,7 +349,6 @@ void CanvasRenderPaint::blendMode(rive::BlendMode blendMode)
                                         paint,
                                         GetSetStyleMethodId(),
                                         staticObject);
-    env->DeleteLocalRef(styleClass);
     env->DeleteLocalRef(staticObject);
 }
 
@@ -389,8 +381,6 @@ void CanvasRenderPaint::blendMode(rive::BlendMode blendMode)
                                         paint,
                                         GetSetStrokeJoinMethodId(),
                                         staticObject);
-
-    env->DeleteLocalRef(joinClass);
     env->DeleteLocalRef(staticObject);
 }
 
@@ -426,8 +416,6 @@ void CanvasRenderPaint::blendMode(rive::BlendMode blendMode)
                                         paint,
                                         GetSetStrokeCapMethodId(),
                                         staticObject);
-
-    env->DeleteLocalRef(capClass);
     env->DeleteLocalRef(staticObject);
 }
 
@@ -441,7 +429,6 @@ void CanvasRenderPaint::blendMode(rive::BlendMode blendMode)
     auto env = GetJNIEnv();
     jclass paintClass = GetPaintClass();
     jobject paint = env->NewObject(paintClass, GetPaintInitMethod());
-    env->DeleteLocalRef(paintClass);
     return paint;
 }
 
@@ -501,9 +488,7 @@ void CanvasRenderPaint::blendMode(rive::BlendMode blendMode)
 
     env->DeleteLocalRef(extraXferModeObject);
     env->DeleteLocalRef(xferModeObject);
-    env->DeleteLocalRef(porterDuffXferModeClass);
     env->DeleteLocalRef(porterDuffMode);
-    env->DeleteLocalRef(porterDuffClass);
 }
 
 /* static */ void CanvasRenderPaint::SetBlendMode(jobject paint,
@@ -578,8 +563,6 @@ void CanvasRenderPaint::blendMode(rive::BlendMode blendMode)
                                         paint,
                                         GetSetBlendModeMethodId(),
                                         blendModeStaticObject);
-
-    env->DeleteLocalRef(blendModeClass);
     env->DeleteLocalRef(blendModeStaticObject);
 }
 
@@ -621,7 +604,6 @@ constexpr auto* TAG_RENDER_IMAGE = "RiveLN/CanvasRenderImage";
         0,
         SizeTToInt(encodedBytes.size()));
     env->DeleteLocalRef(jByteArray);
-    env->DeleteLocalRef(jBitmapFactoryClass);
     if (jBitmap == nullptr)
     {
         RiveLogE(TAG_RENDER_IMAGE,
@@ -0,0 +1,91 @@
+#include "helpers/decode_pool.hpp"
+
+#include <jni.h>
+#include <pthread.h>
+
+#include "helpers/general.hpp"
+#include "helpers/rive_log.hpp"
+
+namespace rive_android
+{
+constexpr static auto* TAG = "RiveN/DecodePool";
+
+DecodePool::DecodePool(size_t threadCount, const char* name)
+{
+    m_threads.reserve(threadCount);
+    for (size_t i = 1; i <= threadCount; i++)
+    {
+        m_threads.emplace_back(&DecodePool::threadMain,
+                               this,
+                               std::string(name) + " " + std::to_string(i));
+    }
+}
+
+DecodePool::~DecodePool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+        m_tasks.clear();
+    }
+    m_taskQueued.notify_all();
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+void DecodePool::run(Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    m_taskQueued.notify_one();
+}
+
+void DecodePool::threadMain(std::string name)
+{
+    // Thread names are limited to 16 bytes, including the terminator.
+    if (name.size() > 15)
+    {
+        name.resize(15);
+    }
+    pthread_setname_np(pthread_self(), name.c_str());
+
+    JNIEnv* env = nullptr;
+    JavaVMAttachArgs args{.version = JNI_VERSION_1_6,
+                          .name = name.c_str(),
+                          .group = nullptr};
+    if (g_JVM->AttachCurrentThread(&env, &args) != JNI_OK)
+    {
+        // Without the JVM no task can decode, so leave them to the other
+        // threads, or to be dropped.
+        RiveLogE(TAG, "Failed to attach %s to JVM", name.c_str());
+        return;
+    }
+
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_taskQueued.wait(lock, [this] {
+                return m_isStopping || !m_tasks.empty();
+            });
+            if (m_isStopping)
+            {
+                break;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+    }
+
+    if (g_JVM->DetachCurrentThread() != JNI_OK)
+    {
+        RiveLogE(TAG, "Failed to detach %s from JVM", name.c_str());
+    }
+}
+} // namespace rive_android
@@ -0,0 +1,55 @@
+#include "helpers/draw_dirty_tracker.hpp"
+
+namespace rive_android
+{
+bool DrawDirtyTracker::DrawInputs::operator==(const DrawInputs& other) const
+{
+    return artboard == other.artboard && stateMachine == other.stateMachine &&
+           surface == other.surface &&
+           targetGeneration == other.targetGeneration && fit == other.fit &&
+           alignmentX == other.alignmentX && alignmentY == other.alignmentY &&
+           scaleFactor == other.scaleFactor && clearColor == other.clearColor;
+}
+
+void DrawDirtyTracker::advanced(uint64_t stateMachine, bool changed)
+{
+    auto& state = m_stateMachines[stateMachine];
+    if (changed || !state.settled || state.epoch != m_epoch)
+    {
+        state.generation++;
+    }
+    state.settled = !changed;
+    state.epoch = m_epoch;
+}
+
+void DrawDirtyTracker::removeStateMachine(uint64_t stateMachine)
+{
+    m_stateMachines.erase(stateMachine);
+}
+
+uint64_t DrawDirtyTracker::generationOf(uint64_t stateMachine) const
+{
+    auto it = m_stateMachines.find(stateMachine);
+    return it != m_stateMachines.end() ? it->second.generation : 0;
+}
+
+bool DrawDirtyTracker::isDirty(uint64_t drawKey,
+                               const DrawInputs& inputs) const
+{
+    auto it = m_drawn.find(drawKey);
+    if (it == m_drawn.end())
+    {
+        return true;
+    }
+    const auto& frame = it->second;
+    return frame.epoch != m_epoch || frame.inputs != inputs ||
+           frame.generation != generationOf(inputs.stateMachine);
+}
+
+void DrawDirtyTracker::drawn(uint64_t drawKey, const DrawInputs& inputs)
+{
+    m_drawn[drawKey] = {.inputs = inputs,
+                        .generation = generationOf(inputs.stateMachine),
+                        .epoch = m_epoch};
+}
+} // namespace rive_android
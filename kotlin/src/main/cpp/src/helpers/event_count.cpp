@@ -0,0 +1,36 @@
+#include "helpers/event_count.hpp"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace rive_android
+{
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "futex words must be plain 32-bit integers");
+
+void EventCount::wait(Key key)
+{
+    // Returns immediately if the epoch already moved past key, so a
+    // notification between prepareWait() and here is not lost.
+    syscall(SYS_futex,
+            reinterpret_cast<uint32_t*>(&m_epoch),
+            FUTEX_WAIT_PRIVATE,
+            key,
+            nullptr,
+            nullptr,
+            0);
+    m_waiters.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+void EventCount::wake(int count)
+{
+    syscall(SYS_futex,
+            reinterpret_cast<uint32_t*>(&m_epoch),
+            FUTEX_WAKE_PRIVATE,
+            count,
+            nullptr,
+            nullptr,
+            0);
+}
+} // namespace rive_android
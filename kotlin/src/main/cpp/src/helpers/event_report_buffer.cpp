@@ -0,0 +1,117 @@
+#include "helpers/event_report_buffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/custom_property_boolean.hpp"
+#include "rive/custom_property_number.hpp"
+#include "rive/custom_property_string.hpp"
+#include "rive/event.hpp"
+#include "rive/event_report.hpp"
+#include "rive/open_url_event.hpp"
+
+namespace rive_android
+{
+uint8_t* EventReportBuffer::reserve(size_t length)
+{
+    if (m_size + length > m_bytes.size())
+    {
+        m_bytes.resize(std::max(m_bytes.size() * 2, m_size + length));
+    }
+    uint8_t* out = m_bytes.data() + m_size;
+    m_size += length;
+    return out;
+}
+
+template <typename T> void EventReportBuffer::put(const T& value)
+{
+    std::memcpy(reserve(sizeof(T)), &value, sizeof(T));
+}
+
+void EventReportBuffer::putString(const std::string& value)
+{
+    put(static_cast<int32_t>(value.size()));
+    std::memcpy(reserve(value.size()), value.data(), value.size());
+}
+
+void EventReportBuffer::write(const rive::StateMachineInstance* stateMachine)
+{
+    m_size = 0;
+    const auto count =
+        static_cast<uint32_t>(stateMachine->reportedEventCount());
+    put(count);
+    // The offset table is filled in as each record is written. Offsets are
+    // stored rather than pointers because reserve() may move the storage.
+    const size_t offsetTable = m_size;
+    reserve(count * sizeof(uint32_t));
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const auto offset = static_cast<uint32_t>(m_size);
+        std::memcpy(m_bytes.data() + offsetTable + i * sizeof(uint32_t),
+                    &offset,
+                    sizeof(offset));
+        const rive::EventReport report = stateMachine->reportedEventAt(i);
+        writeEvent(report.event(), report.secondsDelay());
+    }
+}
+
+void EventReportBuffer::writeEvent(const rive::Event* event, float delay)
+{
+    put(static_cast<int16_t>(event->coreType()));
+    put(delay);
+    putString(event->name());
+    if (event->is<rive::OpenUrlEvent>())
+    {
+        auto* urlEvent = event->as<rive::OpenUrlEvent>();
+        put(static_cast<uint8_t>(urlEvent->targetValue()));
+        putString(urlEvent->url());
+    }
+    else
+    {
+        put(static_cast<uint8_t>(0));
+        putString("");
+    }
+
+    // Patched once the properties are counted, matching GetProperties in
+    // bindings_rive_event.cpp, which skips unnamed properties.
+    const size_t propertyCountOffset = m_size;
+    reserve(sizeof(uint32_t));
+    uint32_t propertyCount = 0;
+    for (auto* child : event->children())
+    {
+        if (!child->is<rive::CustomProperty>() || child->name().empty())
+        {
+            continue;
+        }
+        switch (child->coreType())
+        {
+            case rive::CustomPropertyBoolean::typeKey:
+                put(PropertyTag::boolean);
+                putString(child->name());
+                put(static_cast<uint8_t>(
+                    child->as<rive::CustomPropertyBoolean>()->propertyValue()
+                        ? 1
+                        : 0));
+                break;
+            case rive::CustomPropertyNumber::typeKey:
+                put(PropertyTag::number);
+                putString(child->name());
+                put(child->as<rive::CustomPropertyNumber>()->propertyValue());
+                break;
+            case rive::CustomPropertyString::typeKey:
+                put(PropertyTag::string);
+                putString(child->name());
+                putString(
+                    child->as<rive::CustomPropertyString>()->propertyValue());
+                break;
+            default:
+                continue;
+        }
+        propertyCount++;
+    }
+    std::memcpy(m_bytes.data() + propertyCountOffset,
+                &propertyCount,
+                sizeof(propertyCount));
+}
+} // namespace rive_android
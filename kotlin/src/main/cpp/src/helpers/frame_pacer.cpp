@@ -0,0 +1,107 @@
+#include "helpers/frame_pacer.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+namespace rive_android
+{
+FramePacer::FramePacer(Clock clock) : m_clock(std::move(clock))
+{
+    if (m_clock == nullptr)
+    {
+        m_clock = [] { return std::chrono::steady_clock::now(); };
+    }
+}
+
+FramePacer::Tick FramePacer::onTick(uint8_t framesInFlight)
+{
+    const auto now = m_clock();
+    int64_t interval = m_tickIntervalNanos.load(std::memory_order_relaxed);
+    if (m_lastTick != TimePoint{})
+    {
+        const int64_t elapsed = Duration(now - m_lastTick).count();
+        if (elapsed > 0 && elapsed <= kMaxTickInterval.count())
+        {
+            interval += (elapsed - interval) / 8;
+            m_tickIntervalNanos.store(interval, std::memory_order_relaxed);
+        }
+    }
+    m_lastTick = now;
+
+    // Pick the fastest rate the predicted cost fits, slowing down at once but
+    // speeding up one step at a time.
+    const int64_t predicted =
+        m_predictedCostNanos.load(std::memory_order_relaxed);
+    uint32_t divisor = m_tickDivisor.load(std::memory_order_relaxed);
+    if (predicted > interval * divisor)
+    {
+        divisor = static_cast<uint32_t>(
+            std::min<int64_t>(kMaxTickDivisor,
+                              (predicted + interval - 1) / interval));
+    }
+    else if (divisor > 1 &&
+             predicted < interval * (divisor - 1) * kSpeedUpHeadroom)
+    {
+        divisor--;
+    }
+    m_tickDivisor.store(divisor, std::memory_order_relaxed);
+
+    const TimePoint presentDeadline = now + Duration(interval * divisor);
+    m_ticksSinceFrame = std::min(m_ticksSinceFrame + 1, kMaxTickDivisor);
+    if (m_ticksSinceFrame < divisor)
+    {
+        m_coalescedFrames.fetch_add(1, std::memory_order_relaxed);
+        return {Decision::Coalesce, presentDeadline};
+    }
+    if (framesInFlight >= kMaxFramesInFlight)
+    {
+        // Leave m_ticksSinceFrame as is so the next tick tries again.
+        m_droppedFrames.fetch_add(1, std::memory_order_relaxed);
+        return {Decision::Drop, presentDeadline};
+    }
+    m_ticksSinceFrame = 0;
+    m_scheduledFrames.fetch_add(1, std::memory_order_relaxed);
+    return {Decision::Schedule, presentDeadline};
+}
+
+void FramePacer::onFrameFinished(TimePoint started, TimePoint presentDeadline)
+{
+    const auto finished = m_clock();
+    const int64_t cost =
+        std::max<int64_t>(0, Duration(finished - started).count());
+    if (!m_hasCostSample)
+    {
+        m_smoothedCostNanos = cost;
+        m_costDeviationNanos = cost / 4;
+        m_hasCostSample = true;
+    }
+    else
+    {
+        const int64_t error = cost - m_smoothedCostNanos;
+        m_smoothedCostNanos += error / 8;
+        m_costDeviationNanos += (std::abs(error) - m_costDeviationNanos) / 4;
+    }
+    m_predictedCostNanos.store(m_smoothedCostNanos + 2 * m_costDeviationNanos,
+                               std::memory_order_relaxed);
+    if (finished > presentDeadline)
+    {
+        m_lateFrames.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+FramePacer::Stats FramePacer::stats() const
+{
+    Stats stats;
+    stats.scheduledFrames = m_scheduledFrames.load(std::memory_order_relaxed);
+    stats.coalescedFrames = m_coalescedFrames.load(std::memory_order_relaxed);
+    stats.droppedFrames = m_droppedFrames.load(std::memory_order_relaxed);
+    stats.lateFrames = m_lateFrames.load(std::memory_order_relaxed);
+    stats.predictedFrameCost =
+        Duration(m_predictedCostNanos.load(std::memory_order_relaxed));
+    stats.tickInterval =
+        Duration(m_tickIntervalNanos.load(std::memory_order_relaxed));
+    stats.tickDivisor = m_tickDivisor.load(std::memory_order_relaxed);
+    return stats;
+}
+} // namespace rive_android
@@ -0,0 +1,131 @@
+#include "helpers/frame_stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rive_android
+{
+static std::array<int64_t, FrameStats::kRecordFields> Fields(
+    const FrameRecord& record)
+{
+    return {record.advanceNanos,
+            record.drawNanos,
+            record.flushNanos,
+            record.presentNanos,
+            record.queueWaitNanos};
+}
+
+void FrameStats::add(const FrameRecord& record)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records[m_next] = record;
+    m_next = (m_next + 1) % kCapacity;
+    m_frames++;
+    m_totalTimes.add(static_cast<double>(record.totalNanos()));
+}
+
+FrameStats::Summary FrameStats::summary() const
+{
+    Summary summary;
+    std::array<FrameRecord, kCapacity> records;
+    size_t count;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        count = static_cast<size_t>(std::min<uint64_t>(m_frames, kCapacity));
+        std::copy(m_records.begin(),
+                  m_records.begin() + count,
+                  records.begin());
+        summary.frames = m_frames;
+        summary.meanTotalNanos = static_cast<int64_t>(m_totalTimes.mean());
+        summary.stdDevTotalNanos =
+            static_cast<int64_t>(std::sqrt(m_totalTimes.var()));
+    }
+    summary.windowFrames = static_cast<uint32_t>(count);
+    if (count == 0)
+    {
+        return summary;
+    }
+
+    // Nearest rank: the smallest value at least p% of the window is at or
+    // below.
+    constexpr std::array<size_t, kPercentileCount> percents = {50, 90, 99, 100};
+    std::array<int64_t, kCapacity> column;
+    for (size_t row = 0; row < kSummaryRows; row++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            column[i] = row < kRecordFields ? Fields(records[i])[row]
+                                            : records[i].totalNanos();
+        }
+        for (size_t p = 0; p < kPercentileCount; p++)
+        {
+            const size_t rank = (percents[p] * count + 99) / 100;
+            auto nth = column.begin() + (rank - 1);
+            std::nth_element(column.begin(), nth, column.begin() + count);
+            summary.percentiles[row][p] = *nth;
+        }
+    }
+    return summary;
+}
+
+size_t FrameStats::copyRecords(int64_t* out, size_t maxRecords) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const size_t stored =
+        static_cast<size_t>(std::min<uint64_t>(m_frames, kCapacity));
+    const size_t count = std::min(stored, maxRecords);
+    // The oldest of the newest count records.
+    size_t index = (m_next + kCapacity - count) % kCapacity;
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto fields = Fields(m_records[index]);
+        std::copy(fields.begin(), fields.end(), out + i * kRecordFields);
+        index = (index + 1) % kCapacity;
+    }
+    return count;
+}
+
+jlongArray FrameStatsSummaryToJava(JNIEnv* env, const FrameStats& stats)
+{
+    const auto summary = stats.summary();
+    std::array<jlong,
+               2 + FrameStats::kSummaryRows * FrameStats::kPercentileCount + 2>
+        values;
+    size_t i = 0;
+    values[i++] = static_cast<jlong>(summary.frames);
+    values[i++] = static_cast<jlong>(summary.windowFrames);
+    for (const auto& row : summary.percentiles)
+    {
+        for (int64_t value : row)
+        {
+            values[i++] = value;
+        }
+    }
+    values[i++] = summary.meanTotalNanos;
+    values[i++] = summary.stdDevTotalNanos;
+
+    const auto length = static_cast<jsize>(values.size());
+    jlongArray array = env->NewLongArray(length);
+    env->SetLongArrayRegion(array, 0, length, values.data());
+    return array;
+}
+
+jint CopyFrameRecordsToJava(JNIEnv* env,
+                            const FrameStats& stats,
+                            jlongArray array)
+{
+    std::array<jlong, FrameStats::kCapacity * FrameStats::kRecordFields>
+        values;
+    const size_t maxRecords = std::min<size_t>(
+        FrameStats::kCapacity,
+        static_cast<size_t>(env->GetArrayLength(array)) /
+            FrameStats::kRecordFields);
+    const size_t count = stats.copyRecords(values.data(), maxRecords);
+    env->SetLongArrayRegion(
+        array,
+        0,
+        static_cast<jsize>(count * FrameStats::kRecordFields),
+        values.data());
+    return static_cast<jint>(count);
+}
+} // namespace rive_android
@@ -215,7 +215,7 @@ rive::Factory* GetFactory(RendererType rendererType)
     return static_cast<rive::Factory*>(&g_CanvasFactory);
 }
 
-jlong Import(uint8_t* bytes,
+jlong Import(const uint8_t* bytes,
              jint length,
              RendererType rendererType,
              rive::FileAssetLoader* assetLoader)
@@ -1,5 +1,7 @@
 #include "helpers/image_decode.hpp"
 
+#include <cstring>
+
 #include "helpers/android_factories.hpp"
 #include "helpers/canvas_render_objects.hpp"
 #include "helpers/conversions.hpp"
@@ -13,12 +15,11 @@ using namespace rive;
 namespace rive_android
 {
 constexpr auto* TAG = "RiveLN/ImageDecode";
-const uint32_t LSB_MASK = 0xFFu;
 
-rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
-    Span<const uint8_t> encodedBytes,
-    bool isPremultiplied,
-    RenderContext* renderContext)
+std::unique_ptr<uint8_t[]> decodeToRGBA(Span<const uint8_t> encodedBytes,
+                                        bool isPremultiplied,
+                                        uint32_t* width,
+                                        uint32_t* height)
 {
     auto env = GetJNIEnv();
 
@@ -55,7 +56,7 @@ rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
     }
 
     // At this point, we have the decoded results. Now convert into premul RGBA
-    // bytes and wrap in an AndroidImage.
+    // bytes.
 
     jsize arrayCount = env->GetArrayLength(jPixels);
     if (arrayCount < 2)
@@ -86,42 +87,188 @@ rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
     }
 
     std::unique_ptr<uint8_t[]> out(new uint8_t[pixelCount * 4]);
-    auto* bytes = out.get();
-    for (size_t i = 0; i < pixelCount; ++i)
-    {
-        auto p = static_cast<uint32_t>(rawPixels[2 + i]);
-        uint32_t a = (p >> 24) & LSB_MASK;
-        uint32_t r = (p >> 16) & LSB_MASK;
-        uint32_t g = (p >> 8) & LSB_MASK;
-        uint32_t b = (p >> 0) & LSB_MASK;
-        if (!isPremultiplied)
-        {
-            r = premultiply(r, a);
-            g = premultiply(g, a);
-            b = premultiply(b, a);
-        }
-        bytes[0] = static_cast<uint8_t>(r);
-        bytes[1] = static_cast<uint8_t>(g);
-        bytes[2] = static_cast<uint8_t>(b);
-        bytes[3] = static_cast<uint8_t>(a);
-        bytes += 4;
-    }
+    argbToRGBA(reinterpret_cast<const uint32_t*>(rawPixels + 2),
+               out.get(),
+               pixelCount,
+               !isPremultiplied);
     env->ReleaseIntArrayElements(jPixels, rawPixels, JNI_ABORT);
     env->DeleteLocalRef(jPixels);
 
+    *width = rawWidth;
+    *height = rawHeight;
+    return out;
+}
+
+rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
+    Span<const uint8_t> encodedBytes,
+    bool isPremultiplied,
+    RenderContext* renderContext)
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    auto pixels = decodeToRGBA(encodedBytes, isPremultiplied, &width, &height);
+    if (pixels == nullptr)
+    {
+        return nullptr;
+    }
+
     // New runtime: create backend-specific render images through the active
     // render context.
     // Legacy falls through to AndroidImage below.
     if (renderContext != nullptr)
     {
-        return renderContext->createRenderImage(rawWidth,
-                                                rawHeight,
-                                                std::move(out));
+        return renderContext->createRenderImage(width,
+                                                height,
+                                                std::move(pixels));
     }
 
-    return make_rcp<AndroidImage>(static_cast<int>(rawWidth),
-                                  static_cast<int>(rawHeight),
-                                  std::move(out));
+    return make_rcp<AndroidImage>(static_cast<int>(width),
+                                  static_cast<int>(height),
+                                  std::move(pixels));
+}
+
+namespace
+{
+uint32_t readBigEndian16(const uint8_t* bytes)
+{
+    return static_cast<uint32_t>(bytes[0]) << 8 | bytes[1];
+}
+
+uint32_t readBigEndian32(const uint8_t* bytes)
+{
+    return readBigEndian16(bytes) << 16 | readBigEndian16(bytes + 2);
+}
+
+uint32_t readLittleEndian16(const uint8_t* bytes)
+{
+    return static_cast<uint32_t>(bytes[1]) << 8 | bytes[0];
+}
+
+uint32_t readLittleEndian24(const uint8_t* bytes)
+{
+    return static_cast<uint32_t>(bytes[2]) << 16 | readLittleEndian16(bytes);
+}
+
+bool readJPEGSize(Span<const uint8_t> bytes, uint32_t* width, uint32_t* height)
+{
+    // Walk the marker segments after SOI until a start of frame.
+    size_t i = 2;
+    while (i + 4 <= bytes.size())
+    {
+        if (bytes[i] != 0xFF)
+        {
+            return false;
+        }
+        const uint8_t marker = bytes[i + 1];
+        if (marker == 0xFF)
+        {
+            // Fill byte.
+            i++;
+            continue;
+        }
+        // Markers without a length: TEM, RSTn, SOI and EOI.
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD9))
+        {
+            i += 2;
+            continue;
+        }
+        const size_t length = readBigEndian16(&bytes[i + 2]);
+        // SOFn, except DHT, JPG and DAC which share the range.
+        const bool isStartOfFrame = marker >= 0xC0 && marker <= 0xCF &&
+                                    marker != 0xC4 && marker != 0xC8 &&
+                                    marker != 0xCC;
+        if (isStartOfFrame)
+        {
+            // Length, precision, height, width.
+            if (i + 9 > bytes.size())
+            {
+                return false;
+            }
+            *height = readBigEndian16(&bytes[i + 5]);
+            *width = readBigEndian16(&bytes[i + 7]);
+            return true;
+        }
+        i += 2 + length;
+    }
+    return false;
+}
+
+bool readWebPSize(Span<const uint8_t> bytes, uint32_t* width, uint32_t* height)
+{
+    if (bytes.size() < 30)
+    {
+        return false;
+    }
+    const uint8_t* chunk = &bytes[12];
+    if (memcmp(chunk, "VP8 ", 4) == 0)
+    {
+        // Lossy: a frame tag, then a start code, then 14 bit dimensions.
+        if (bytes[23] != 0x9D || bytes[24] != 0x01 || bytes[25] != 0x2A)
+        {
+            return false;
+        }
+        *width = readLittleEndian16(&bytes[26]) & 0x3FFF;
+        *height = readLittleEndian16(&bytes[28]) & 0x3FFF;
+        return true;
+    }
+    if (memcmp(chunk, "VP8L", 4) == 0)
+    {
+        // Lossless: a signature, then 14 bit dimensions minus one.
+        if (bytes[20] != 0x2F)
+        {
+            return false;
+        }
+        const uint32_t bits = readLittleEndian16(&bytes[21]) |
+                              readLittleEndian16(&bytes[23]) << 16;
+        *width = (bits & 0x3FFF) + 1;
+        *height = ((bits >> 14) & 0x3FFF) + 1;
+        return true;
+    }
+    if (memcmp(chunk, "VP8X", 4) == 0)
+    {
+        // Extended: flags, then 24 bit canvas dimensions minus one.
+        *width = readLittleEndian24(&bytes[24]) + 1;
+        *height = readLittleEndian24(&bytes[27]) + 1;
+        return true;
+    }
+    return false;
+}
+} // namespace
+
+bool readEncodedImageSize(Span<const uint8_t> encodedBytes,
+                          uint32_t* width,
+                          uint32_t* height)
+{
+    static constexpr uint8_t kPNGSignature[] =
+        {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+    const auto size = encodedBytes.size();
+    const auto* bytes = encodedBytes.data();
+    bool recognized = false;
+    if (size >= 24 && memcmp(bytes, kPNGSignature, 8) == 0 &&
+        memcmp(bytes + 12, "IHDR", 4) == 0)
+    {
+        *width = readBigEndian32(bytes + 16);
+        *height = readBigEndian32(bytes + 20);
+        recognized = true;
+    }
+    else if (size >= 4 && bytes[0] == 0xFF && bytes[1] == 0xD8)
+    {
+        recognized = readJPEGSize(encodedBytes, width, height);
+    }
+    else if (size >= 12 && memcmp(bytes, "RIFF", 4) == 0 &&
+             memcmp(bytes + 8, "WEBP", 4) == 0)
+    {
+        recognized = readWebPSize(encodedBytes, width, height);
+    }
+    else if (size >= 10 && (memcmp(bytes, "GIF87a", 6) == 0 ||
+                            memcmp(bytes, "GIF89a", 6) == 0))
+    {
+        *width = readLittleEndian16(bytes + 6);
+        *height = readLittleEndian16(bytes + 8);
+        recognized = true;
+    }
+    return recognized && *width > 0 && *height > 0;
 }
 
 rive::rcp<rive::RenderImage> renderImageFromRGBABytesRive(
@@ -138,26 +285,13 @@ rive::rcp<rive::RenderImage> renderImageFromRGBABytesRive(
 
     const auto pixelCount = static_cast<size_t>(width) * height;
     std::unique_ptr<uint8_t[]> out(new uint8_t[pixelCount * 4]);
-    const auto* src = pixelBytes;
-    auto* dst = out.get();
-    for (auto i = 0; i < pixelCount; ++i)
-    {
-        uint32_t r = src[0];
-        uint32_t g = src[1];
-        uint32_t b = src[2];
-        uint32_t a = src[3];
-        if (!isPremultiplied)
-        {
-            r = premultiply(r, a);
-            g = premultiply(g, a);
-            b = premultiply(b, a);
-        }
-        dst[0] = static_cast<uint8_t>(r);
-        dst[1] = static_cast<uint8_t>(g);
-        dst[2] = static_cast<uint8_t>(b);
-        dst[3] = static_cast<uint8_t>(a);
-        src += 4;
-        dst += 4;
+    if (isPremultiplied)
+    {
+        memcpy(out.get(), pixelBytes, pixelCount * 4);
+    }
+    else
+    {
+        premultiplyRGBA(pixelBytes, out.get(), pixelCount);
     }
     return make_rcp<AndroidImage>(static_cast<int>(width),
                                   static_cast<int>(height),
@@ -202,22 +336,10 @@ rive::rcp<rive::RenderImage> renderImageFromRGBABytesCanvas(
         return nullptr;
     }
     auto* out = env->GetIntArrayElements(pixels, nullptr);
-    const auto* src = pixelBytes;
-    for (size_t i = 0; i < pixelCount; ++i)
-    {
-        uint32_t r = src[0];
-        uint32_t g = src[1];
-        uint32_t b = src[2];
-        uint32_t a = src[3];
-        if (isPremultiplied && a != 255)
-        {
-            r = unpremultiply(r, a);
-            g = unpremultiply(g, a);
-            b = unpremultiply(b, a);
-        }
-        out[i] = static_cast<jint>((a << 24) | (r << 16) | (g << 8) | (b));
-        src += 4;
-    }
+    rgbaToARGB(pixelBytes,
+               reinterpret_cast<uint32_t*>(out),
+               pixelCount,
+               isPremultiplied);
     env->ReleaseIntArrayElements(pixels, out, 0);
     JNIExceptionHandler::CallVoidMethod(env,
                                         jBitmap,
@@ -247,24 +369,7 @@ rive::rcp<rive::RenderImage> renderImageFromARGBIntsRive(uint32_t width,
     }
     const auto pixelCount = static_cast<size_t>(width) * height;
     std::unique_ptr<uint8_t[]> out(new uint8_t[pixelCount * 4]);
-    for (size_t i = 0; i < pixelCount; ++i)
-    {
-        uint32_t c = pixels[i];
-        uint32_t a = (c >> 24) & LSB_MASK;
-        uint32_t r = (c >> 16) & LSB_MASK;
-        uint32_t g = (c >> 8) & LSB_MASK;
-        uint32_t b = (c >> 0) & LSB_MASK;
-        if (!isPremultiplied)
-        {
-            r = premultiply(r, a);
-            g = premultiply(g, a);
-            b = premultiply(b, a);
-        }
-        out[i * 4 + 0] = static_cast<uint8_t>(r);
-        out[i * 4 + 1] = static_cast<uint8_t>(g);
-        out[i * 4 + 2] = static_cast<uint8_t>(b);
-        out[i * 4 + 3] = static_cast<uint8_t>(a);
-    }
+    argbToRGBA(pixels, out.get(), pixelCount, !isPremultiplied);
     return make_rcp<AndroidImage>(static_cast<int>(width),
                                   static_cast<int>(height),
                                   std::move(out));
@@ -316,23 +421,12 @@ rive::rcp<rive::RenderImage> renderImageFromARGBIntsCanvas(
     }
     else
     {
-        std::unique_ptr<jint[]> tmp(new jint[pixelCount]);
-        for (size_t i = 0; i < pixelCount; ++i)
-        {
-            uint32_t c = pixels[i];
-            uint32_t a = (c >> 24) & LSB_MASK;
-            uint32_t r = (c >> 16) & LSB_MASK;
-            uint32_t g = (c >> 8) & LSB_MASK;
-            uint32_t b = (c >> 0) & LSB_MASK;
-            if (a != 255)
-            {
-                r = unpremultiply(r, a);
-                g = unpremultiply(g, a);
-                b = unpremultiply(b, a);
-            }
-            tmp[i] = static_cast<jint>((a << 24) | (r << 16) | (g << 8) | (b));
-        }
-        env->SetIntArrayRegion(dstPixels, 0, count, tmp.get());
+        std::unique_ptr<uint32_t[]> tmp(new uint32_t[pixelCount]);
+        unpremultiplyARGB(pixels, tmp.get(), pixelCount);
+        env->SetIntArrayRegion(dstPixels,
+                               0,
+                               count,
+                               reinterpret_cast<const jint*>(tmp.get()));
     }
     JNIExceptionHandler::CallVoidMethod(env,
                                         jBitmap,
@@ -371,7 +465,8 @@ rive::rcp<rive::RenderImage> renderImageFromBitmapRive(jobject jBitmap,
     const auto width = info.width;
     const auto height = info.height;
 
-    // Pack bitmap data in RGBA8888 format into a contiguous RGBA buffer
+    // Pack bitmap data in RGBA8888 format into a contiguous RGBA buffer,
+    // premultiplying on the way for straight alpha.
     const size_t byteCount = static_cast<size_t>(width) * height * 4;
     std::unique_ptr<uint8_t[]> dstBytes(new uint8_t[byteCount]);
 
@@ -381,32 +476,31 @@ rive::rcp<rive::RenderImage> renderImageFromBitmapRive(jobject jBitmap,
     // Reinterpret RGBA ints as bytes
     const auto* srcBytes = reinterpret_cast<const uint8_t*>(srcPixels);
 
-    // Contiguous case: direct memcpy
-    if (srcStrideBytes == rowBytes)
+    if (isPremultiplied)
     {
-        memcpy(dstBytes.get(), srcBytes, rowBytes * height);
+        copyRows(srcBytes,
+                 srcStrideBytes,
+                 dstBytes.get(),
+                 rowBytes,
+                 rowBytes,
+                 height);
     }
-    // Strided case: copy row by row
     else
     {
         for (uint32_t y = 0; y < height; ++y)
         {
-            const uint8_t* srcRow = srcBytes + y * srcStrideBytes;
-            uint8_t* dstRow =
-                dstBytes.get() + static_cast<size_t>(y) * rowBytes;
-            memcpy(dstRow, srcRow, rowBytes);
+            premultiplyRGBA(srcBytes + y * srcStrideBytes,
+                            dstBytes.get() + static_cast<size_t>(y) * rowBytes,
+                            width);
         }
     }
 
     // Always unlock srcPixels
     AndroidBitmap_unlockPixels(env, jBitmap);
 
-    // The packed buffer is RGBA. Route through the RGBA path that handles
-    // isPremultiplied/straight alpha
-    return renderImageFromRGBABytesRive(width,
-                                        height,
-                                        dstBytes.get(),
-                                        isPremultiplied);
+    return make_rcp<AndroidImage>(static_cast<int>(width),
+                                  static_cast<int>(height),
+                                  std::move(dstBytes));
 }
 
 rive::rcp<rive::RenderImage> renderImageFromBitmapCanvas(jobject jBitmap)
@@ -419,28 +513,6 @@ rive::rcp<rive::RenderImage> renderImageFromBitmapCanvas(jobject jBitmap)
     return make_rcp<CanvasRenderImage>(jBitmap);
 }
 
-uint32_t premultiply(uint8_t c, uint8_t a)
-{
-    switch (a)
-    {
-        case 0:
-            return 0;
-        case 255:
-            return c;
-        default:
-            // Slightly faster than (c * a + 127) / 255
-            return (c * a + 128) * 257 >> 16;
-    }
-}
-
-uint32_t unpremultiply(uint8_t c, uint8_t a)
-{
-    if (a == 0)
-        return 0;
-    auto out = (c * 255u + (a / 2u)) / a;
-    return out > 255u ? 255u : out;
-}
-
 bool lockBitmapRGBA8888(JNIEnv* env,
                         jobject jBitmap,
                         AndroidBitmapInfo* info,
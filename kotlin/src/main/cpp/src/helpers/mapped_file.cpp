@@ -0,0 +1,77 @@
+#include "helpers/mapped_file.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "helpers/rive_log.hpp"
+
+namespace rive_android
+{
+constexpr auto* TAG = "RiveN/MappedFile";
+
+MappedFile::MappedFile(int fd, off_t offset, size_t length)
+{
+    // Reading a mapped page past the end of the file raises SIGBUS rather than
+    // failing, so the region must be checked up front.
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0)
+    {
+        RiveLogE(TAG,
+                 "Failed to stat file descriptor %d: %s",
+                 fd,
+                 strerror(errno));
+        return;
+    }
+    if (offset < 0 || length == 0 ||
+        static_cast<uint64_t>(offset) + length >
+            static_cast<uint64_t>(fileStat.st_size))
+    {
+        RiveLogE(TAG,
+                 "Region of %zu bytes at offset %lld is outside file "
+                 "descriptor %d of %lld bytes",
+                 length,
+                 static_cast<long long>(offset),
+                 fd,
+                 static_cast<long long>(fileStat.st_size));
+        return;
+    }
+
+    // mmap requires a page aligned offset, so map from the start of the page
+    // containing the region and skip the leading bytes.
+    auto pageSize = static_cast<off_t>(sysconf(_SC_PAGESIZE));
+    auto alignedOffset = offset - (offset % pageSize);
+    auto leading = static_cast<size_t>(offset - alignedOffset);
+    auto mappedLength = length + leading;
+
+    auto* mapping =
+        mmap(nullptr, mappedLength, PROT_READ, MAP_PRIVATE, fd, alignedOffset);
+    if (mapping == MAP_FAILED)
+    {
+        RiveLogE(TAG,
+                 "Failed to map %zu bytes of file descriptor %d: %s",
+                 length,
+                 fd,
+                 strerror(errno));
+        return;
+    }
+    // Files are parsed front to back, so favor readahead over caching pages
+    // behind the read position.
+    madvise(mapping, mappedLength, MADV_SEQUENTIAL);
+
+    m_mapping = mapping;
+    m_mappedLength = mappedLength;
+    m_data = static_cast<const uint8_t*>(mapping) + leading;
+    m_size = length;
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_mapping != nullptr)
+    {
+        munmap(m_mapping, m_mappedLength);
+    }
+}
+} // namespace rive_android
@@ -0,0 +1,470 @@
+#include "helpers/pixel_kernels.hpp"
+
+#include <cstring>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define RIVE_PIXEL_KERNELS_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define RIVE_PIXEL_KERNELS_SSE2
+#endif
+
+namespace rive_android
+{
+uint32_t premultiply(uint8_t c, uint8_t a)
+{
+    switch (a)
+    {
+        case 0:
+            return 0;
+        case 255:
+            return c;
+        default:
+            // Slightly faster than (c * a + 127) / 255
+            return (c * a + 128) * 257 >> 16;
+    }
+}
+
+uint32_t unpremultiply(uint8_t c, uint8_t a)
+{
+    if (a == 0)
+        return 0;
+    auto out = (c * 255u + (a / 2u)) / a;
+    return out > 255u ? 255u : out;
+}
+
+namespace scalar
+{
+void premultiplyRGBA(const uint8_t* src, uint8_t* dst, size_t pixelCount)
+{
+    for (size_t i = 0; i < pixelCount; ++i)
+    {
+        const uint8_t a = src[3];
+        dst[0] = static_cast<uint8_t>(premultiply(src[0], a));
+        dst[1] = static_cast<uint8_t>(premultiply(src[1], a));
+        dst[2] = static_cast<uint8_t>(premultiply(src[2], a));
+        dst[3] = a;
+        src += 4;
+        dst += 4;
+    }
+}
+
+void argbToRGBA(const uint32_t* src,
+                uint8_t* dst,
+                size_t pixelCount,
+                bool premultiplyAlpha)
+{
+    for (size_t i = 0; i < pixelCount; ++i)
+    {
+        const uint32_t c = src[i];
+        const auto a = static_cast<uint8_t>(c >> 24);
+        auto r = static_cast<uint8_t>(c >> 16);
+        auto g = static_cast<uint8_t>(c >> 8);
+        auto b = static_cast<uint8_t>(c);
+        if (premultiplyAlpha)
+        {
+            r = static_cast<uint8_t>(premultiply(r, a));
+            g = static_cast<uint8_t>(premultiply(g, a));
+            b = static_cast<uint8_t>(premultiply(b, a));
+        }
+        dst[i * 4 + 0] = r;
+        dst[i * 4 + 1] = g;
+        dst[i * 4 + 2] = b;
+        dst[i * 4 + 3] = a;
+    }
+}
+
+void rgbaToARGB(const uint8_t* src,
+                uint32_t* dst,
+                size_t pixelCount,
+                bool unpremultiplyAlpha)
+{
+    for (size_t i = 0; i < pixelCount; ++i)
+    {
+        uint32_t r = src[i * 4 + 0];
+        uint32_t g = src[i * 4 + 1];
+        uint32_t b = src[i * 4 + 2];
+        const uint32_t a = src[i * 4 + 3];
+        if (unpremultiplyAlpha && a != 255)
+        {
+            r = unpremultiply(r, a);
+            g = unpremultiply(g, a);
+            b = unpremultiply(b, a);
+        }
+        dst[i] = (a << 24) | (r << 16) | (g << 8) | b;
+    }
+}
+
+void unpremultiplyARGB(const uint32_t* src, uint32_t* dst, size_t pixelCount)
+{
+    for (size_t i = 0; i < pixelCount; ++i)
+    {
+        const uint32_t c = src[i];
+        const uint32_t a = c >> 24;
+        if (a == 255)
+        {
+            dst[i] = c;
+            continue;
+        }
+        const uint32_t r = unpremultiply(c >> 16, a);
+        const uint32_t g = unpremultiply(c >> 8, a);
+        const uint32_t b = unpremultiply(c, a);
+        dst[i] = (a << 24) | (r << 16) | (g << 8) | b;
+    }
+}
+} // namespace scalar
+
+// Both vector paths compute the scalar formulas exactly:
+//
+// - Premultiplying, (c * a + 128) * 257 >> 16 equals (t + (t >> 8)) >> 8 for
+//   t = c * a + 128, which fits in 16 bits. It also gives 0 and c for the
+//   alpha values the scalar function special cases.
+// - Unpremultiplying, (c * 255 + a / 2) / a is computed in float and
+//   truncated. The numerator is exact, and a quotient that isn't an integer is
+//   at least 1 / a below the next one, far more than float's rounding error
+//   for quotients under 2^16, so truncating gives the integer quotient. Alpha
+//   255 needs no special case, since unpremultiplying by it is the identity.
+
+#if defined(RIVE_PIXEL_KERNELS_NEON)
+
+static constexpr size_t kVectorPixels = 16;
+
+/** c * a / 255, rounded, for 16 channels. */
+static inline uint8x16_t premultiply16(uint8x16_t c, uint8x16_t a)
+{
+    const uint16x8_t lo = vmull_u8(vget_low_u8(c), vget_low_u8(a));
+    const uint16x8_t hi = vmull_high_u8(c, a);
+    // vraddhn(t, (t + 128) >> 8) is (t + 128 + ((t + 128) >> 8)) >> 8.
+    const uint8x8_t resultLo = vraddhn_u16(lo, vrshrq_n_u16(lo, 8));
+    return vraddhn_high_u16(resultLo, hi, vrshrq_n_u16(hi, 8));
+}
+
+/** (c * 255 + half) / a for 4 channels, clamped to 255. */
+static inline uint32x4_t unpremultiply4(uint32x4_t c,
+                                        float32x4_t a,
+                                        float32x4_t half)
+{
+    const float32x4_t numerator =
+        vaddq_f32(vmulq_n_f32(vcvtq_f32_u32(c), 255.0f), half);
+    return vcvtq_u32_f32(vminq_f32(vdivq_f32(numerator, a), vdupq_n_f32(255)));
+}
+
+/** Unpremultiplies 16 channels by their alphas. */
+static inline uint8x16_t unpremultiply16(uint8x16_t c, uint8x16_t a)
+{
+    const uint16x8_t c16[2] = {vmovl_u8(vget_low_u8(c)), vmovl_high_u8(c)};
+    const uint16x8_t a16[2] = {vmovl_u8(vget_low_u8(a)), vmovl_high_u8(a)};
+    uint16x4_t result[4];
+    for (int i = 0; i < 4; i++)
+    {
+        const uint16x4_t cPart =
+            i % 2 == 0 ? vget_low_u16(c16[i / 2]) : vget_high_u16(c16[i / 2]);
+        const uint16x4_t aPart =
+            i % 2 == 0 ? vget_low_u16(a16[i / 2]) : vget_high_u16(a16[i / 2]);
+        const uint32x4_t a32 = vmovl_u16(aPart);
+        const float32x4_t half = vcvtq_f32_u32(vshrq_n_u32(a32, 1));
+        result[i] = vmovn_u32(
+            unpremultiply4(vmovl_u16(cPart), vcvtq_f32_u32(a32), half));
+    }
+    const uint8x16_t unpremultiplied =
+        vcombine_u8(vmovn_u16(vcombine_u16(result[0], result[1])),
+                    vmovn_u16(vcombine_u16(result[2], result[3])));
+    // Alpha 0 divides by zero; the scalar result is 0.
+    return vbicq_u8(unpremultiplied, vceqq_u8(a, vdupq_n_u8(0)));
+}
+
+static size_t premultiplyRGBAVector(const uint8_t* src,
+                                    uint8_t* dst,
+                                    size_t pixelCount)
+{
+    size_t i = 0;
+    for (; i + kVectorPixels <= pixelCount; i += kVectorPixels)
+    {
+        uint8x16x4_t px = vld4q_u8(src + i * 4);
+        px.val[0] = premultiply16(px.val[0], px.val[3]);
+        px.val[1] = premultiply16(px.val[1], px.val[3]);
+        px.val[2] = premultiply16(px.val[2], px.val[3]);
+        vst4q_u8(dst + i * 4, px);
+    }
+    return i;
+}
+
+static size_t argbToRGBAVector(const uint32_t* src,
+                               uint8_t* dst,
+                               size_t pixelCount,
+                               bool premultiplyAlpha)
+{
+    size_t i = 0;
+    for (; i + kVectorPixels <= pixelCount; i += kVectorPixels)
+    {
+        // In memory, ARGB values are B, G, R, A.
+        const uint8x16x4_t bgra =
+            vld4q_u8(reinterpret_cast<const uint8_t*>(src + i));
+        uint8x16x4_t rgba = {
+            {bgra.val[2], bgra.val[1], bgra.val[0], bgra.val[3]}};
+        if (premultiplyAlpha)
+        {
+            rgba.val[0] = premultiply16(rgba.val[0], rgba.val[3]);
+            rgba.val[1] = premultiply16(rgba.val[1], rgba.val[3]);
+            rgba.val[2] = premultiply16(rgba.val[2], rgba.val[3]);
+        }
+        vst4q_u8(dst + i * 4, rgba);
+    }
+    return i;
+}
+
+static size_t rgbaToARGBVector(const uint8_t* src,
+                               uint32_t* dst,
+                               size_t pixelCount,
+                               bool unpremultiplyAlpha)
+{
+    size_t i = 0;
+    for (; i + kVectorPixels <= pixelCount; i += kVectorPixels)
+    {
+        const uint8x16x4_t rgba = vld4q_u8(src + i * 4);
+        uint8x16x4_t bgra = {
+            {rgba.val[2], rgba.val[1], rgba.val[0], rgba.val[3]}};
+        if (unpremultiplyAlpha)
+        {
+            bgra.val[0] = unpremultiply16(bgra.val[0], bgra.val[3]);
+            bgra.val[1] = unpremultiply16(bgra.val[1], bgra.val[3]);
+            bgra.val[2] = unpremultiply16(bgra.val[2], bgra.val[3]);
+        }
+        vst4q_u8(reinterpret_cast<uint8_t*>(dst + i), bgra);
+    }
+    return i;
+}
+
+static size_t unpremultiplyARGBVector(const uint32_t* src,
+                                      uint32_t* dst,
+                                      size_t pixelCount)
+{
+    size_t i = 0;
+    for (; i + kVectorPixels <= pixelCount; i += kVectorPixels)
+    {
+        uint8x16x4_t bgra = vld4q_u8(reinterpret_cast<const uint8_t*>(src + i));
+        bgra.val[0] = unpremultiply16(bgra.val[0], bgra.val[3]);
+        bgra.val[1] = unpremultiply16(bgra.val[1], bgra.val[3]);
+        bgra.val[2] = unpremultiply16(bgra.val[2], bgra.val[3]);
+        vst4q_u8(reinterpret_cast<uint8_t*>(dst + i), bgra);
+    }
+    return i;
+}
+
+#elif defined(RIVE_PIXEL_KERNELS_SSE2)
+
+static constexpr size_t kVectorPixels = 4;
+
+/** Premultiplies 4 RGBA pixels, leaving alpha as is. */
+static inline __m128i premultiply4(__m128i px)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16(128);
+    auto premultiplyHalf = [&](__m128i c) {
+        // Broadcast each pixel's alpha, its fourth 16 bit lane, to all four.
+        const __m128i a = _mm_shufflehi_epi16(
+            _mm_shufflelo_epi16(c, _MM_SHUFFLE(3, 3, 3, 3)),
+            _MM_SHUFFLE(3, 3, 3, 3));
+        const __m128i t = _mm_add_epi16(_mm_mullo_epi16(c, a), bias);
+        return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+    };
+    const __m128i premultiplied =
+        _mm_packus_epi16(premultiplyHalf(_mm_unpacklo_epi8(px, zero)),
+                         premultiplyHalf(_mm_unpackhi_epi8(px, zero)));
+    const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    return _mm_or_si128(_mm_andnot_si128(alphaMask, premultiplied),
+                        _mm_and_si128(alphaMask, px));
+}
+
+/** Swaps the first and third bytes of each 32 bit lane: RGBA <-> BGRA. */
+static inline __m128i swapRedBlue4(__m128i px)
+{
+    const __m128i keep = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+    const __m128i low = _mm_set1_epi32(0xFF);
+    return _mm_or_si128(
+        _mm_and_si128(px, keep),
+        _mm_or_si128(_mm_and_si128(_mm_srli_epi32(px, 16), low),
+                     _mm_slli_epi32(_mm_and_si128(px, low), 16)));
+}
+
+/**
+ * Unpremultiplies 4 pixels whose alpha is the top byte of each 32 bit lane,
+ * leaving the byte order as is.
+ */
+static inline __m128i unpremultiply4(__m128i px)
+{
+    const __m128i low = _mm_set1_epi32(0xFF);
+    const __m128i a = _mm_srli_epi32(px, 24);
+    const __m128 alpha = _mm_cvtepi32_ps(a);
+    const __m128 half = _mm_cvtepi32_ps(_mm_srli_epi32(a, 1));
+    const __m128 scale = _mm_set1_ps(255.0f);
+    auto unpremultiplyChannel = [&](int shift) {
+        const __m128i c = _mm_and_si128(_mm_srli_epi32(px, shift), low);
+        const __m128 numerator =
+            _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(c), scale), half);
+        const __m128 quotient =
+            _mm_min_ps(_mm_div_ps(numerator, alpha), scale);
+        return _mm_slli_epi32(_mm_cvttps_epi32(quotient), shift);
+    };
+    const __m128i channels =
+        _mm_or_si128(unpremultiplyChannel(0),
+                     _mm_or_si128(unpremultiplyChannel(8),
+                                  unpremultiplyChannel(16)));
+    // Alpha 0 divides by zero; the scalar result is 0.
+    const __m128i transparent = _mm_cmpeq_epi32(a, _mm_setzero_si128());
+    return _mm_or_si128(_mm_andnot_si128(transparent, channels),
+                        _mm_slli_epi32(a, 24));
+}
+
+static inline __m128i load4(const void* src)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+static inline void store4(void* dst, __m128i px)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), px);
+}
+
+static size_t premultiplyRGBAVector(const uint8_t* src,
+                                    uint8_t* dst,
+                                    size_t pixelCount)
+{
+    size_t i = 0;
+    for (; i + kVectorPixels <= pixelCount; i += kVectorPixels)
+    {
+        store4(dst + i * 4, premultiply4(load4(src + i * 4)));
+    }
+    return i;
+}
+
+static size_t argbToRGBAVector(const uint32_t* src,
+                               uint8_t* dst,
+                               size_t pixelCount,
+                               bool premultiplyAlpha)
+{
+    size_t i = 0;
+    for (; i + kVectorPixels <= pixelCount; i += kVectorPixels)
+    {
+        __m128i px = swapRedBlue4(load4(src + i));
+        if (premultiplyAlpha)
+        {
+            px = premultiply4(px);
+        }
+        store4(dst + i * 4, px);
+    }
+    return i;
+}
+
+static size_t rgbaToARGBVector(const uint8_t* src,
+                               uint32_t* dst,
+                               size_t pixelCount,
+                               bool unpremultiplyAlpha)
+{
+    size_t i = 0;
+    for (; i + kVectorPixels <= pixelCount; i += kVectorPixels)
+    {
+        __m128i px = swapRedBlue4(load4(src + i * 4));
+        if (unpremultiplyAlpha)
+        {
+            px = unpremultiply4(px);
+        }
+        store4(dst + i, px);
+    }
+    return i;
+}
+
+static size_t unpremultiplyARGBVector(const uint32_t* src,
+                                      uint32_t* dst,
+                                      size_t pixelCount)
+{
+    size_t i = 0;
+    for (; i + kVectorPixels <= pixelCount; i += kVectorPixels)
+    {
+        store4(dst + i, unpremultiply4(load4(src + i)));
+    }
+    return i;
+}
+
+#else
+
+static size_t premultiplyRGBAVector(const uint8_t*, uint8_t*, size_t)
+{
+    return 0;
+}
+
+static size_t argbToRGBAVector(const uint32_t*, uint8_t*, size_t, bool)
+{
+    return 0;
+}
+
+static size_t rgbaToARGBVector(const uint8_t*, uint32_t*, size_t, bool)
+{
+    return 0;
+}
+
+static size_t unpremultiplyARGBVector(const uint32_t*, uint32_t*, size_t)
+{
+    return 0;
+}
+
+#endif
+
+void premultiplyRGBA(const uint8_t* src, uint8_t* dst, size_t pixelCount)
+{
+    const size_t done = premultiplyRGBAVector(src, dst, pixelCount);
+    scalar::premultiplyRGBA(src + done * 4, dst + done * 4, pixelCount - done);
+}
+
+void argbToRGBA(const uint32_t* src,
+                uint8_t* dst,
+                size_t pixelCount,
+                bool premultiplyAlpha)
+{
+    const size_t done =
+        argbToRGBAVector(src, dst, pixelCount, premultiplyAlpha);
+    scalar::argbToRGBA(src + done,
+                       dst + done * 4,
+                       pixelCount - done,
+                       premultiplyAlpha);
+}
+
+void rgbaToARGB(const uint8_t* src,
+                uint32_t* dst,
+                size_t pixelCount,
+                bool unpremultiplyAlpha)
+{
+    const size_t done =
+        rgbaToARGBVector(src, dst, pixelCount, unpremultiplyAlpha);
+    scalar::rgbaToARGB(src + done * 4,
+                       dst + done,
+                       pixelCount - done,
+                       unpremultiplyAlpha);
+}
+
+void unpremultiplyARGB(const uint32_t* src, uint32_t* dst, size_t pixelCount)
+{
+    const size_t done = unpremultiplyARGBVector(src, dst, pixelCount);
+    scalar::unpremultiplyARGB(src + done, dst + done, pixelCount - done);
+}
+
+void copyRows(const uint8_t* src,
+              size_t srcStride,
+              uint8_t* dst,
+              size_t dstStride,
+              size_t rowBytes,
+              size_t rows)
+{
+    if (srcStride == rowBytes && dstStride == rowBytes)
+    {
+        memcpy(dst, src, rowBytes * rows);
+        return;
+    }
+    // memcpy is already vectorized; copying row by row only skips padding.
+    for (size_t y = 0; y < rows; ++y)
+    {
+        memcpy(dst + y * dstStride, src + y * srcStride, rowBytes);
+    }
+}
+} // namespace rive_android
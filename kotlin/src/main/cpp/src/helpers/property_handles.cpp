@@ -0,0 +1,47 @@
+#include "helpers/property_handles.hpp"
+
+#include <utility>
+
+namespace rive_android
+{
+void PropertyHandleTable::add(uint64_t id,
+                              rive::ViewModelInstanceHandle viewModelInstance,
+                              std::string path)
+{
+    m_properties[id] = {.viewModelInstance = viewModelInstance,
+                        .path = std::move(path)};
+}
+
+void PropertyHandleTable::remove(uint64_t id) { m_properties.erase(id); }
+
+void PropertyHandleTable::removeInstance(
+    rive::ViewModelInstanceHandle viewModelInstance)
+{
+    for (auto it = m_properties.begin(); it != m_properties.end();)
+    {
+        if (it->second.viewModelInstance == viewModelInstance)
+        {
+            it = m_properties.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void PropertyHandleTable::invalidateAll()
+{
+    for (auto& [id, property] : m_properties)
+    {
+        property.resolvedKind = PropertyKind::none;
+        property.resolved = nullptr;
+    }
+}
+
+PropertyHandleTable::Property* PropertyHandleTable::find(uint64_t id)
+{
+    auto it = m_properties.find(id);
+    return it == m_properties.end() ? nullptr : &it->second;
+}
+} // namespace rive_android
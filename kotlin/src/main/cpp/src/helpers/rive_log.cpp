@@ -1,15 +1,39 @@
 #include "helpers/rive_log.hpp"
 
 #include <android/log.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include <atomic>
 #include <cstdio>
 #include <cstring>
+#include <thread>
 
 #include "helpers/general.hpp"
 #include "helpers/jni_resource.hpp"
 #include "helpers/jni_string.hpp"
+#include "helpers/work_queue.hpp"
 
 namespace rive_android
 {
+namespace
+{
+/** A formatted message waiting in the ring to be passed to Kotlin. */
+struct LogEntry
+{
+    int priority = ANDROID_LOG_DEBUG;
+    char tag[32] = {};
+    char message[512] = {};
+};
+
+// Enough for a burst of messages, such as a file failing to load, while the
+// log thread is descheduled.
+constexpr size_t kLogRingCapacity = 128;
+using LogRing = WorkQueue<LogEntry, kLogRingCapacity>;
+
+constexpr const char* kLogThreadName = "Rive Log";
+// Below normal (0), like Android's THREAD_PRIORITY_BACKGROUND.
+constexpr int kLogThreadNice = 10;
+} // namespace
 
 // Cached class and method IDs for RiveLog
 static jclass g_riveLogClass = nullptr;
@@ -19,7 +43,22 @@ static jmethodID g_riveLogIMethod = nullptr;
 static jmethodID g_riveLogWMethod = nullptr;
 static jmethodID g_riveLogEMethod = nullptr;
 static std::mutex g_riveLogMutex;
-static bool g_riveLogInitialized = false;
+static std::atomic<bool> g_riveLogInitialized{false};
+// Messages below this priority are discarded. Until Kotlin sets it, keep
+// everything, since the logger it would follow is unknown.
+static std::atomic<int> g_riveLogMinPriority{ANDROID_LOG_VERBOSE};
+static std::atomic<uint64_t> g_riveLogDropped{0};
+// Created by InitializeRiveLog() and never destroyed, like the thread that
+// drains it.
+static LogRing* g_riveLogRing = nullptr;
+
+static bool IsLogEnabled(int androidLogLevel)
+{
+    return androidLogLevel >=
+           g_riveLogMinPriority.load(std::memory_order_relaxed);
+}
+
+static void DrainLogRing();
 
 static void FallbackToNativeLog(int androidLogLevel,
                                 const char* tag,
@@ -111,66 +150,56 @@ void InitializeRiveLog()
         // Method IDs will be nullptr, and we'll fallback to android log
     }
 
-    g_riveLogInitialized = true;
-}
-
-// Internal helper to format and log a message
-static void LogMessage(jmethodID methodID,
-                       const char* tag,
-                       const char* format,
-                       va_list args,
-                       int androidLogLevel)
-{
-    // Format the message using vsnprintf
-    char buffer[512];
-    va_list argsCopy;
-    va_copy(argsCopy, args);
-    int result = vsnprintf(buffer, sizeof(buffer), format, argsCopy);
-    va_end(argsCopy);
-
-    if (result < 0)
+    // The level may have been set before the library was loaded. Have Kotlin
+    // push it, rather than reading it here, so the push is serialized with
+    // Kotlin's own updates and can't overwrite a newer level.
+    auto updateNativeLevelMethod =
+        env->GetStaticMethodID(g_riveLogClass, "updateNativeLevel", "()V");
+    if (updateNativeLevelMethod != nullptr)
     {
-        LOGE("Logging error: vsnprintf failed");
-        return;
+        env->CallStaticVoidMethod(g_riveLogClass, updateNativeLevelMethod);
     }
-
-    // Ensure null termination
-    if (static_cast<size_t>(result) >= sizeof(buffer))
+    if (env->ExceptionCheck())
     {
-        buffer[sizeof(buffer) - 1] = '\0';
+        LOGE("RiveLog initialization failed: Error reading the log level");
+        env->ExceptionDescribe();
+        env->ExceptionClear();
     }
 
-    // If the logging isn't ready, fallback to native logging
-    if (methodID == nullptr || !g_riveLogInitialized)
-    {
-        FallbackToNativeLog(androidLogLevel, tag, buffer);
-        return;
-    }
+    g_riveLogRing = new LogRing();
+    std::thread(DrainLogRing).detach();
+    g_riveLogInitialized.store(true, std::memory_order_release);
+}
 
-    JNIEnv* env = nullptr;
-    auto getEnvStat = g_JVM->GetEnv((void**)&env, JNI_VERSION_1_6);
-    // Happens on native-created threads that were never attached to the
-    // JVM (e.g. short-lived cleanup std::thread paths). In that case,
-    // skip RiveLog and fall back to native logging.
-    if (getEnvStat == JNI_EDETACHED)
-    {
-        FallbackToNativeLog(androidLogLevel, tag, buffer);
-        return;
-    }
-    else if (getEnvStat != JNI_OK)
+static jmethodID MethodForLevel(int androidLogLevel)
+{
+    switch (androidLogLevel)
     {
-        LOGE(
-            "Logging error: Unable to get JNIEnv for RiveLog. JNI Error Code: %d",
-            getEnvStat);
-        FallbackToNativeLog(androidLogLevel, tag, buffer);
-        return;
+        case ANDROID_LOG_VERBOSE:
+            return g_riveLogVMethod;
+        case ANDROID_LOG_DEBUG:
+            return g_riveLogDMethod;
+        case ANDROID_LOG_INFO:
+            return g_riveLogIMethod;
+        case ANDROID_LOG_WARN:
+            return g_riveLogWMethod;
+        case ANDROID_LOG_ERROR:
+        default:
+            return g_riveLogEMethod;
     }
+}
 
-    // Most JNI operations are invalid while an exception is pending. Preserve
-    // the caller's exception and use the JNI-free logging path instead.
-    if (env->ExceptionCheck())
+// Passes a message to Kotlin on the log thread, or to the Android log if that
+// fails.
+static void DeliverMessage(JNIEnv* env, const LogEntry& entry)
+{
+    const auto androidLogLevel = entry.priority;
+    const char* tag = entry.tag;
+    const char* message = entry.message;
+    auto methodID = MethodForLevel(androidLogLevel);
+    if (env == nullptr || methodID == nullptr)
     {
-        FallbackToNativeLog(androidLogLevel, tag, buffer);
+        FallbackToNativeLog(androidLogLevel, tag, message);
         return;
     }
 
@@ -178,27 +207,24 @@ static void LogMessage(jmethodID methodID,
     auto jTag = MakeJString(env, tag);
     if (jTag.get() == nullptr)
     {
-        // A failed NewString may leave an allocation exception pending. This
-        // exception belongs to the logging attempt, so consume it before
-        // falling back rather than letting logging alter the caller's state.
+        // A failed NewString may leave an allocation exception pending. Only
+        // this thread's logging raises exceptions, so consume it.
         if (env->ExceptionCheck())
         {
             env->ExceptionClear();
         }
-        FallbackToNativeLog(androidLogLevel, tag, buffer);
+        FallbackToNativeLog(androidLogLevel, tag, message);
         return;
     }
 
-    auto jMessage = MakeJString(env, buffer);
+    auto jMessage = MakeJString(env, message);
     if (jMessage.get() == nullptr)
     {
-        // No exception was pending before this allocation, so any exception
-        // here belongs to the logging attempt and can be consumed safely.
         if (env->ExceptionCheck())
         {
             env->ExceptionClear();
         }
-        FallbackToNativeLog(androidLogLevel, tag, buffer);
+        FallbackToNativeLog(androidLogLevel, tag, message);
         return;
     }
 
@@ -215,48 +241,162 @@ static void LogMessage(jmethodID methodID,
         env->ExceptionDescribe(); // Log the exception details
         env->ExceptionClear();
         // Fall through to Android logging fallback
-        FallbackToNativeLog(androidLogLevel, tag, buffer);
+        FallbackToNativeLog(androidLogLevel, tag, message);
+    }
+}
+
+// The log thread: passes messages from the ring to Kotlin, in the order they
+// were pushed, and reports any dropped since the last message.
+static void DrainLogRing()
+{
+    pthread_setname_np(pthread_self(), kLogThreadName);
+    // With who = 0, this sets the calling thread's nice value on Linux.
+    setpriority(PRIO_PROCESS, 0, kLogThreadNice);
+
+    // A daemon, so that a thread that never exits does not hold up the VM's.
+    JNIEnv* env = nullptr;
+    JavaVMAttachArgs args{.version = JNI_VERSION_1_6,
+                          .name = kLogThreadName,
+                          .group = nullptr};
+    if (g_JVM->AttachCurrentThreadAsDaemon(&env, &args) != JNI_OK)
+    {
+        LOGE("RiveLog: Failed to attach the log thread to the JVM");
+        env = nullptr;
+    }
+
+    uint64_t reportedDropped = 0;
+    while (true)
+    {
+        const LogEntry entry = g_riveLogRing->pop();
+        if (IsLogEnabled(entry.priority))
+        {
+            DeliverMessage(env, entry);
+        }
+
+        const auto dropped = g_riveLogDropped.load(std::memory_order_relaxed);
+        if (dropped != reportedDropped && IsLogEnabled(ANDROID_LOG_WARN))
+        {
+            LogEntry report;
+            report.priority = ANDROID_LOG_WARN;
+            snprintf(report.tag, sizeof(report.tag), "RiveN/Log");
+            snprintf(report.message,
+                     sizeof(report.message),
+                     "Dropped %llu log messages because they were logged "
+                     "faster than they could be delivered",
+                     static_cast<unsigned long long>(dropped -
+                                                     reportedDropped));
+            DeliverMessage(env, report);
+            reportedDropped = dropped;
+        }
+    }
+}
+
+// Formats a message on the calling thread and queues it for the log thread.
+// Callers have already checked the message's level.
+static void LogMessage(const char* tag,
+                       const char* format,
+                       va_list args,
+                       int androidLogLevel)
+{
+    LogEntry entry;
+    entry.priority = androidLogLevel;
+    // Truncates, and always terminates.
+    snprintf(entry.tag, sizeof(entry.tag), "%s", tag);
+
+    // Format the message using vsnprintf
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    int result =
+        vsnprintf(entry.message, sizeof(entry.message), format, argsCopy);
+    va_end(argsCopy);
+
+    if (result < 0)
+    {
+        LOGE("Logging error: vsnprintf failed");
+        return;
+    }
+
+    // If the logging isn't ready, fallback to native logging
+    if (!g_riveLogInitialized.load(std::memory_order_acquire))
+    {
+        FallbackToNativeLog(androidLogLevel, tag, entry.message);
+        return;
+    }
+
+    if (!g_riveLogRing->tryPush(std::move(entry)))
+    {
+        g_riveLogDropped.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
 void RiveLogV(const char* tag, const char* format, ...)
 {
+    if (!IsLogEnabled(ANDROID_LOG_VERBOSE))
+    {
+        return;
+    }
     va_list args;
     va_start(args, format);
-    LogMessage(g_riveLogVMethod, tag, format, args, ANDROID_LOG_VERBOSE);
+    LogMessage(tag, format, args, ANDROID_LOG_VERBOSE);
     va_end(args);
 }
 
 void RiveLogD(const char* tag, const char* format, ...)
 {
+    if (!IsLogEnabled(ANDROID_LOG_DEBUG))
+    {
+        return;
+    }
     va_list args;
     va_start(args, format);
-    LogMessage(g_riveLogDMethod, tag, format, args, ANDROID_LOG_DEBUG);
+    LogMessage(tag, format, args, ANDROID_LOG_DEBUG);
     va_end(args);
 }
 
 void RiveLogI(const char* tag, const char* format, ...)
 {
+    if (!IsLogEnabled(ANDROID_LOG_INFO))
+    {
+        return;
+    }
     va_list args;
     va_start(args, format);
-    LogMessage(g_riveLogIMethod, tag, format, args, ANDROID_LOG_INFO);
+    LogMessage(tag, format, args, ANDROID_LOG_INFO);
     va_end(args);
 }
 
 void RiveLogW(const char* tag, const char* format, ...)
 {
+    if (!IsLogEnabled(ANDROID_LOG_WARN))
+    {
+        return;
+    }
     va_list args;
     va_start(args, format);
-    LogMessage(g_riveLogWMethod, tag, format, args, ANDROID_LOG_WARN);
+    LogMessage(tag, format, args, ANDROID_LOG_WARN);
     va_end(args);
 }
 
 void RiveLogE(const char* tag, const char* format, ...)
 {
+    if (!IsLogEnabled(ANDROID_LOG_ERROR))
+    {
+        return;
+    }
     va_list args;
     va_start(args, format);
-    LogMessage(g_riveLogEMethod, tag, format, args, ANDROID_LOG_ERROR);
+    LogMessage(tag, format, args, ANDROID_LOG_ERROR);
     va_end(args);
 }
 
+void SetRiveLogMinPriority(int priority)
+{
+    g_riveLogMinPriority.store(priority, std::memory_order_relaxed);
+}
+
+uint64_t RiveLogDroppedMessages()
+{
+    return g_riveLogDropped.load(std::memory_order_relaxed);
+}
+
 } // namespace rive_android
@@ -19,24 +19,133 @@
 #include <sched.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
 namespace rive_android
 {
+namespace
+{
+// Reads a file holding a single unsigned integer, or 0 if it can't.
+uint32_t readUInt(const std::string& path)
+{
+    std::ifstream file(path);
+    uint32_t value = 0;
+    if (!(file >> value))
+    {
+        return 0;
+    }
+    return value;
+}
 
-int32_t getNumCpus()
+// Parses a sysfs CPU list, such as "0-3,6,8-9".
+std::vector<int32_t> parseCpuList(const std::string& list)
 {
-    static int32_t sNumCpus = []() {
-        pid_t pid = gettid();
-        cpu_set_t cpuSet;
-        CPU_ZERO(&cpuSet);
-        sched_getaffinity(pid, sizeof(cpuSet), &cpuSet);
+    std::vector<int32_t> cpus;
+    std::stringstream ranges(list);
+    std::string range;
+    while (std::getline(ranges, range, ','))
+    {
+        int32_t first = 0;
+        int32_t last = 0;
+        const int fields = sscanf(range.c_str(), "%d-%d", &first, &last);
+        if (fields < 1 || first < 0)
+        {
+            continue;
+        }
+        if (fields == 1)
+        {
+            last = first;
+        }
+        for (int32_t cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+cpu_set_t allowedCpus()
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    sched_getaffinity(gettid(), sizeof(cpuSet), &cpuSet);
+    return cpuSet;
+}
+
+const std::vector<int32_t>& performanceCpus()
+{
+    static const std::vector<int32_t> sPerformanceCpus =
+        selectPerformanceCpus(readCpuTopology(kSysfsCpuRoot));
+    return sPerformanceCpus;
+}
+} // namespace
+
+std::vector<CpuCore> readCpuTopology(const std::string& sysfsRoot)
+{
+    std::ifstream onlineFile(sysfsRoot + "/online");
+    std::string online;
+    if (!std::getline(onlineFile, online))
+    {
+        return {};
+    }
+
+    std::vector<CpuCore> cores;
+    for (int32_t cpu : parseCpuList(online))
+    {
+        const auto cpuDir = sysfsRoot + "/cpu" + std::to_string(cpu);
+        cores.push_back(
+            {cpu,
+             readUInt(cpuDir + "/cpu_capacity"),
+             readUInt(cpuDir + "/cpufreq/cpuinfo_max_freq")});
+    }
+    return cores;
+}
+
+std::vector<int32_t> selectPerformanceCpus(const std::vector<CpuCore>& cores)
+{
+    const bool allHaveCapacity =
+        std::all_of(cores.begin(), cores.end(), [](const CpuCore& core) {
+            return core.capacity > 0;
+        });
+    auto speed = [allHaveCapacity](const CpuCore& core) {
+        return allHaveCapacity ? core.capacity : core.maxFrequencyKHz;
+    };
 
-        int32_t numCpus = 0;
-        while (CPU_ISSET(numCpus, &cpuSet))
+    // Unknown speeds read as 0 and are left out, so that they don't make
+    // every known core look fast.
+    uint32_t slowest = UINT32_MAX;
+    for (const auto& core : cores)
+    {
+        if (speed(core) > 0)
         {
-            ++numCpus;
+            slowest = std::min(slowest, speed(core));
         }
+    }
+
+    std::vector<int32_t> selected;
+    std::vector<int32_t> all;
+    for (const auto& core : cores)
+    {
+        all.push_back(core.cpu);
+        // Cores of unknown speed are only selected with all cores.
+        if (speed(core) > slowest)
+        {
+            selected.push_back(core.cpu);
+        }
+    }
+    return selected.empty() ? all : selected;
+}
 
-        return numCpus;
+int32_t getNumCpus()
+{
+    static int32_t sNumCpus = []() {
+        // Count every allowed core: offline or isolated cores leave gaps in
+        // the mask, so the allowed cores are not always 0 to n - 1.
+        cpu_set_t cpuSet = allowedCpus();
+        return static_cast<int32_t>(CPU_COUNT(&cpuSet));
     }();
 
     return sNumCpus;
@@ -52,26 +161,53 @@ void setAffinity(int32_t cpu)
 
 void setAffinity(Affinity affinity)
 {
-    const int32_t numCpus = getNumCpus();
+    const cpu_set_t allowed = allowedCpus();
 
     cpu_set_t cpuSet;
     CPU_ZERO(&cpuSet);
-    for (int32_t cpu = 0; cpu < numCpus; ++cpu)
+    if (affinity == Affinity::Performance)
+    {
+        for (int32_t cpu : performanceCpus())
+        {
+            if (CPU_ISSET(cpu, &allowed))
+            {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+        if (CPU_COUNT(&cpuSet) == 0)
+        {
+            // None of the performance cores are allowed; leave it be.
+            return;
+        }
+        sched_setaffinity(gettid(), sizeof(cpuSet), &cpuSet);
+        return;
+    }
+
+    // Even and Odd alternate over the allowed cores, not the CPU numbers,
+    // so that gaps in the mask don't unbalance them.
+    int32_t index = 0;
+    for (int32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
     {
+        if (!CPU_ISSET(cpu, &allowed))
+        {
+            continue;
+        }
         switch (affinity)
         {
             case Affinity::None:
+            case Affinity::Performance:
                 CPU_SET(cpu, &cpuSet);
                 break;
             case Affinity::Even:
-                if (cpu % 2 == 0)
+                if (index % 2 == 0)
                     CPU_SET(cpu, &cpuSet);
                 break;
             case Affinity::Odd:
-                if (cpu % 2 == 1)
+                if (index % 2 == 1)
                     CPU_SET(cpu, &cpuSet);
                 break;
         }
+        ++index;
     }
 
     sched_setaffinity(gettid(), sizeof(cpuSet), &cpuSet);
@@ -0,0 +1,160 @@
+#include "helpers/work_stealing_pool.hpp"
+
+#include <pthread.h>
+
+#include <cassert>
+#include <limits>
+
+namespace rive_android
+{
+WorkStealingPool::WorkStealingPool(size_t threadCount, const char* name) :
+    m_ranges(new Range[threadCount + 1])
+{
+    m_threads.reserve(threadCount);
+    for (size_t i = 1; i <= threadCount; i++)
+    {
+        m_threads.emplace_back(&WorkStealingPool::threadMain,
+                               this,
+                               i,
+                               std::string(name) + " " + std::to_string(i));
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    m_isStopping.store(true, std::memory_order_relaxed);
+    m_generation.fetch_add(1, std::memory_order_release);
+    m_batchStarted.notifyAll();
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::run(size_t count, TaskFn fn, void* context)
+{
+    assert(count <= std::numeric_limits<uint32_t>::max());
+    if (count == 0)
+    {
+        return;
+    }
+
+    m_fn = fn;
+    m_context = context;
+    m_remaining.store(count, std::memory_order_relaxed);
+    const size_t participants = concurrency();
+    for (size_t i = 0; i < participants; i++)
+    {
+        auto begin = static_cast<uint32_t>(count * i / participants);
+        auto end = static_cast<uint32_t>(count * (i + 1) / participants);
+        m_ranges[i].bounds.store(Pack(begin, end), std::memory_order_release);
+    }
+    // Every pool thread joins every batch, and the batch only ends once they
+    // have all left it. Otherwise a thread still stealing from this batch
+    // could write its range while the next batch is setting them up.
+    m_participating.store(m_threads.size(), std::memory_order_relaxed);
+    if (!m_threads.empty())
+    {
+        m_generation.fetch_add(1, std::memory_order_release);
+        m_batchStarted.notifyAll();
+    }
+
+    runTasks(0);
+    m_batchFinished.await([this] {
+        return m_remaining.load(std::memory_order_acquire) == 0 &&
+               m_participating.load(std::memory_order_acquire) == 0;
+    });
+}
+
+void WorkStealingPool::threadMain(size_t participant, std::string name)
+{
+    // Thread names are limited to 16 bytes, including the terminator.
+    if (name.size() > 15)
+    {
+        name.resize(15);
+    }
+    pthread_setname_np(pthread_self(), name.c_str());
+
+    uint64_t generation = 0;
+    while (true)
+    {
+        m_batchStarted.await([&] {
+            return m_generation.load(std::memory_order_acquire) != generation;
+        });
+        generation = m_generation.load(std::memory_order_acquire);
+        if (m_isStopping.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        runTasks(participant);
+        if (m_participating.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            m_batchFinished.notifyAll();
+        }
+    }
+}
+
+void WorkStealingPool::runTasks(size_t participant)
+{
+    uint32_t index;
+    while (claim(participant, &index) || steal(participant, &index))
+    {
+        m_fn(m_context, index);
+        if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            m_batchFinished.notifyAll();
+        }
+    }
+}
+
+bool WorkStealingPool::claim(size_t participant, uint32_t* index)
+{
+    auto& bounds = m_ranges[participant].bounds;
+    uint64_t current = bounds.load(std::memory_order_acquire);
+    while (Begin(current) < End(current))
+    {
+        if (bounds.compare_exchange_weak(
+                current,
+                Pack(Begin(current) + 1, End(current)),
+                std::memory_order_acq_rel,
+                std::memory_order_acquire))
+        {
+            *index = Begin(current);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkStealingPool::steal(size_t participant, uint32_t* index)
+{
+    const size_t participants = concurrency();
+    for (size_t i = 1; i < participants; i++)
+    {
+        auto& victim = m_ranges[(participant + i) % participants].bounds;
+        uint64_t current = victim.load(std::memory_order_acquire);
+        while (Begin(current) < End(current))
+        {
+            // Take the back half, leaving the victim the front it is working
+            // through.
+            const uint32_t begin = Begin(current);
+            const uint32_t end = End(current);
+            const uint32_t middle = begin + (end - begin) / 2;
+            if (victim.compare_exchange_weak(current,
+                                             Pack(begin, middle),
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire))
+            {
+                // Run the first stolen task now, and make the rest our own
+                // range, where others can steal from it in turn. Our range is
+                // empty, so nobody else writes it until this store.
+                *index = middle;
+                m_ranges[participant].bounds.store(Pack(middle + 1, end),
+                                                   std::memory_order_release);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+} // namespace rive_android
@@ -165,25 +165,27 @@ void RefWorker::externalRefCountDidReachZero()
             RiveLogD(
                 REF_TAG,
                 "Main thread: Rive Renderer ref count reached 0. Releasing resources.");
-            run([](rive_android::DrawableThreadState* threadState) {
-                RiveLogD(
-                    REF_TAG,
-                    "Worker thread: Rive Renderer ref count reached 0. Releasing resources.");
-                auto* plsThreadState =
-                    static_cast<PLSThreadState*>(threadState);
-                rive::gpu::RenderContext* renderContext =
-                    plsThreadState->renderContext();
-                if (renderContext != nullptr)
-                {
-                    renderContext->releaseResources();
-                }
-                else
-                {
-                    RiveLogW(
+            run(
+                [](rive_android::DrawableThreadState* threadState) {
+                    RiveLogD(
                         REF_TAG,
-                        "Failed to release resources on the Rive renderer - rive::RenderContext is null.");
-                }
-            });
+                        "Worker thread: Rive Renderer ref count reached 0. Releasing resources.");
+                    auto* plsThreadState =
+                        static_cast<PLSThreadState*>(threadState);
+                    rive::gpu::RenderContext* renderContext =
+                        plsThreadState->renderContext();
+                    if (renderContext != nullptr)
+                    {
+                        renderContext->releaseResources();
+                    }
+                    else
+                    {
+                        RiveLogW(
+                            REF_TAG,
+                            "Failed to release resources on the Rive renderer - rive::RenderContext is null.");
+                    }
+                },
+                WorkLane::Background);
             break;
         }
         case RendererType::Canvas:
@@ -0,0 +1,1738 @@
+// Generated by tools/jni/generate_native_table.py. Do not edit by hand.
+//
+// Every native method of the library, registered by RegisterNativeMethods()
+// from JNI_OnLoad. Regenerate after adding, removing or changing a binding.
+
+#include <iterator>
+#include <jni.h>
+
+#include "jni_natives.hpp"
+
+extern "C"
+{
+    JNIEXPORT jlong JNICALL Java_app_rive_RiveLog_cppDroppedMessageCount(JNIEnv*, jobject);
+    JNIEXPORT void JNICALL Java_app_rive_RiveLog_cppSetNativeLogLevel(JNIEnv*, jobject, jint);
+    JNIEXPORT void JNICALL Java_app_rive_core_AudioEngine_acquire(JNIEnv*, jobject);
+    JNIEXPORT void JNICALL Java_app_rive_core_AudioEngine_release(JNIEnv*, jobject);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppAdvanceStateMachine(JNIEnv*, jobject, jlong, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppAdvanceStateMachines(JNIEnv*, jobject, jlong, jlong, jlongArray, jint, jlong, jboolean);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppAppendToList(JNIEnv*, jobject, jlong, jlong, jstring, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppApplyPropertyBatch(JNIEnv*, jobject, jlong, jbyteArray, jint);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppBindViewModelInstance(JNIEnv*, jobject, jlong, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppCancelDraw(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppConstructor(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppConstructorAsync(JNIEnv*, jobject, jlong, jobject);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppCopyFileBytes(JNIEnv*, jobject, jobject, jint, jint);
+    JNIEXPORT jint JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppCopyFrameRecords(JNIEnv*, jobject, jlong, jlongArray);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppCreateArtboardByName(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppCreateDefaultArtboard(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppCreateDefaultStateMachine(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppCreateDrawKey(JNIEnv*, jobject, jlong);
+    JNIEXPORT jobject JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppCreateListeners(JNIEnv*, jobject, jlong, jobject);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppCreateStateMachineByName(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDecodeAudio(JNIEnv*, jobject, jlong, jlong, jbyteArray);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDecodeFont(JNIEnv*, jobject, jlong, jlong, jbyteArray);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDecodeImage(JNIEnv*, jobject, jlong, jlong, jbyteArray);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDefaultVMCreateBlankVMI(JNIEnv*, jobject, jlong, jlong, jlong, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDefaultVMCreateDefaultVMI(JNIEnv*, jobject, jlong, jlong, jlong, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDefaultVMCreateNamedVMI(JNIEnv*, jobject, jlong, jlong, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDeleteArtboard(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDeleteAudio(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDeleteFile(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDeleteFileBytes(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDeleteFont(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDeleteImage(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDeleteStateMachine(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDeleteViewModelInstance(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDraw(JNIEnv*, jobject, jlong, jlong, jlong, jlong, jlong, jlong, jint, jint, jbyte, jbyte, jfloat, jint, jboolean);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDrawToBuffer(JNIEnv*, jobject, jlong, jlong, jlong, jlong, jlong, jlong, jint, jint, jbyte, jbyte, jfloat, jint, jbyteArray);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDrawToBufferAsync(JNIEnv*, jobject, jlong, jlong, jlong, jlong, jlong, jlong, jint, jint, jbyte, jbyte, jfloat, jint, jbyteArray, jobject);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppDrawToDirectBufferAsync(JNIEnv*, jobject, jlong, jlong, jlong, jlong, jlong, jlong, jint, jint, jbyte, jbyte, jfloat, jint, jobject, jobject);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppFireTriggerProperty(JNIEnv*, jobject, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppFireTriggerPropertyByHandle(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT jlongArray JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppFrameTimingStats(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetArtboardNames(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetArtboardVolume(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetBooleanProperty(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetColorProperty(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetDefaultViewModelInfo(JNIEnv*, jobject, jlong, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetEnumProperty(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetEnums(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetFileAssets(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetListSize(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetNumberProperty(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetStateMachineNames(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetStringProperty(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetViewModelInstanceName(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetViewModelInstanceNames(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetViewModelInstanceViewModelName(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetViewModelNames(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppGetViewModelProperties(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppInsertToListAtIndex(JNIEnv*, jobject, jlong, jlong, jstring, jint, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppLoadFile(JNIEnv*, jobject, jlong, jlong, jbyteArray);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppLoadFileBytes(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppMapFileBytes(JNIEnv*, jobject, jint, jlong, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppNamedVMCreateBlankVMI(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppNamedVMCreateDefaultVMI(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppNamedVMCreateNamedVMI(JNIEnv*, jobject, jlong, jlong, jlong, jstring, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppPointerDown(JNIEnv*, jobject, jlong, jlong, jbyte, jbyte, jfloat, jfloat, jfloat, jint, jfloat, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppPointerEvents(JNIEnv*, jobject, jlong, jlong, jbyte, jbyte, jfloat, jfloat, jfloat, jfloatArray, jint);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppPointerExit(JNIEnv*, jobject, jlong, jlong, jbyte, jbyte, jfloat, jfloat, jfloat, jint, jfloat, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppPointerMove(JNIEnv*, jobject, jlong, jlong, jbyte, jbyte, jfloat, jfloat, jfloat, jint, jfloat, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppPointerUp(JNIEnv*, jobject, jlong, jlong, jbyte, jbyte, jfloat, jfloat, jfloat, jint, jfloat, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppPollMessages(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppPresentPendingFrame(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppReferenceListItemVMI(JNIEnv*, jobject, jlong, jlong, jlong, jstring, jint);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppReferenceNestedVMI(JNIEnv*, jobject, jlong, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppRegisterAudio(JNIEnv*, jobject, jlong, jstring, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppRegisterFont(JNIEnv*, jobject, jlong, jstring, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppRegisterImage(JNIEnv*, jobject, jlong, jstring, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppReleaseProperty(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppRemoveFromList(JNIEnv*, jobject, jlong, jlong, jstring, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppRemoveFromListAtIndex(JNIEnv*, jobject, jlong, jlong, jstring, jint);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppResetArtboardSize(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppResizeArtboard(JNIEnv*, jobject, jlong, jlong, jint, jint, jfloat);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppResolveProperty(JNIEnv*, jobject, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppRunOnCommandServer(JNIEnv*, jobject, jlong, jobject);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetArtboardProperty(JNIEnv*, jobject, jlong, jlong, jstring, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetArtboardVolume(JNIEnv*, jobject, jlong, jlong, jlong, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetBooleanProperty(JNIEnv*, jobject, jlong, jlong, jstring, jboolean);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetBooleanPropertyByHandle(JNIEnv*, jobject, jlong, jlong, jboolean);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetColorProperty(JNIEnv*, jobject, jlong, jlong, jstring, jint);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetColorPropertyByHandle(JNIEnv*, jobject, jlong, jlong, jint);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetEnumProperty(JNIEnv*, jobject, jlong, jlong, jstring, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetEnumPropertyByHandle(JNIEnv*, jobject, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetImageProperty(JNIEnv*, jobject, jlong, jlong, jstring, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetMessageBuffer(JNIEnv*, jobject, jlong, jobject);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetNumberProperty(JNIEnv*, jobject, jlong, jlong, jstring, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetNumberPropertyByHandle(JNIEnv*, jobject, jlong, jlong, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetStringProperty(JNIEnv*, jobject, jlong, jlong, jstring, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetStringPropertyByHandle(JNIEnv*, jobject, jlong, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetTracingEnabled(JNIEnv*, jobject, jlong, jboolean);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSetViewModelInstanceProperty(JNIEnv*, jobject, jlong, jlong, jstring, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSubscribeToProperty(JNIEnv*, jobject, jlong, jlong, jstring, jint);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppSwapListItems(JNIEnv*, jobject, jlong, jlong, jstring, jint, jint);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppUnregisterAudio(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppUnregisterFont(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_core_CommandQueueJNIBridge_cppUnregisterImage(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jboolean JNICALL Java_app_rive_core_CommandQueueJNIBridge_isCurrentThreadCommandServer(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_Listeners_cppDelete(JNIEnv*, jobject, jlong, jlong, jlong, jlong, jlong, jlong, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_RenderContextGL_cppConstructor(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_RenderContextGL_cppCreateSurface(JNIEnv*, jobject, jlong, jint, jint);
+    JNIEXPORT void JNICALL Java_app_rive_core_RenderContextGL_cppDelete(JNIEnv*, jobject, jlong);
+#if defined(RIVE_VULKAN)
+    JNIEXPORT jlong JNICALL Java_app_rive_core_RenderContextVulkan_cppConstructor(JNIEnv*, jobject);
+    JNIEXPORT void JNICALL Java_app_rive_core_RenderContextVulkan_cppDelete(JNIEnv*, jobject, jlong);
+#endif
+    JNIEXPORT void JNICALL Java_app_rive_core_RiveSurface_cppDeleteSurfaceNative(JNIEnv*, jclass, jlong);
+    JNIEXPORT jlongArray JNICALL Java_app_rive_core_RiveSurface_cppFramePipelineStats(JNIEnv*, jclass, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_core_RiveSurface_cppResizeSurface(JNIEnv*, jclass, jlong, jint, jint);
+#if defined(RIVE_VULKAN)
+    JNIEXPORT jlong JNICALL Java_app_rive_core_RiveSurfaceVulkan_cppCreateSurface(JNIEnv*, jclass, jlong, jobject, jint, jint);
+    JNIEXPORT jlong JNICALL Java_app_rive_core_RiveSurfaceVulkanImage_cppCreateImageSurface(JNIEnv*, jclass, jlong, jint, jint);
+#endif
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_AnimationState_cppName(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppAdvance(JNIEnv*, jobject, jlong, jfloat);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppAnimationByIndex(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppAnimationByName(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppAnimationCount(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppAnimationNameByIndex(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jobject JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppBounds(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppDraw(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppDrawAligned(JNIEnv*, jobject, jlong, jlong, jobject, jobject, jfloat);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppFindTextValueRun(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppFindTextValueRunAtPath(JNIEnv*, jobject, jlong, jstring, jstring);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppFindValueOfTextValueRun(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppFindValueOfTextValueRunAtPath(JNIEnv*, jobject, jlong, jstring, jstring);
+    JNIEXPORT jfloat JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppGetArtboardHeight(JNIEnv*, jobject, jlong);
+    JNIEXPORT jfloat JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppGetArtboardWidth(JNIEnv*, jobject, jlong);
+    JNIEXPORT jfloat JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppGetVolume(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppInputByNameAtPath(JNIEnv*, jobject, jlong, jstring, jstring);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppName(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppResetArtboardSize(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppSetArtboardHeight(JNIEnv*, jobject, jlong, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppSetArtboardWidth(JNIEnv*, jobject, jlong, jfloat);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppSetValueOfTextValueRun(JNIEnv*, jobject, jlong, jstring, jstring);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppSetValueOfTextValueRunAtPath(JNIEnv*, jobject, jlong, jstring, jstring, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppSetViewModelInstance(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppSetVolume(JNIEnv*, jobject, jlong, jfloat);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppStateMachineByIndex(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppStateMachineByName(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppStateMachineCount(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_Artboard_cppStateMachineNameByIndex(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_AudioAsset_cppGetAudio(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_AudioAsset_cppSetAudio(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_BindableArtboard_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_BindableArtboard_cppName(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_File_cppArtboardByIndex(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_File_cppArtboardByName(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_File_cppArtboardCount(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_File_cppArtboardNameByIndex(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_File_cppCreateBindableArtboardByName(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_File_cppCreateDefaultBindableArtboard(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_File_cppDefaultViewModelForArtboard(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_File_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT jobject JNICALL Java_app_rive_runtime_kotlin_core_File_cppEnums(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_File_cppViewModelByIndex(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_File_cppViewModelByName(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_File_cppViewModelCount(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_File_import(JNIEnv*, jobject, jbyteArray, jint, jint, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_File_importFd(JNIEnv*, jobject, jint, jlong, jlong, jint, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_FileAsset_cppCDNUrl(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_FileAsset_cppDecode(JNIEnv*, jobject, jlong, jbyteArray, jint);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_FileAsset_cppName(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_FileAsset_cppUniqueFilename(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_FileAssetLoader_constructor(JNIEnv*, jobject);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_FileAssetLoader_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_FileAssetLoader_cppRef(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_FileAssetLoader_cppSetRendererType(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_FontAsset_cppGetFont(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_FontAsset_cppSetFont(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT jobject JNICALL Java_app_rive_runtime_kotlin_core_Helpers_cppConvertToArtboardSpace(JNIEnv*, jobject, jobject, jobject, jobject, jobject, jobject, jfloat);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ImageAsset_cppGetRenderImage(JNIEnv*, jobject, jlong);
+    JNIEXPORT jfloat JNICALL Java_app_rive_runtime_kotlin_core_ImageAsset_cppImageAssetHeight(JNIEnv*, jobject, jlong);
+    JNIEXPORT jfloat JNICALL Java_app_rive_runtime_kotlin_core_ImageAsset_cppImageAssetWidth(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ImageAsset_cppSetRenderImage(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_LayerState_cppIsAnimationState(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_LayerState_cppIsAnyState(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_LayerState_cppIsBlendState(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_LayerState_cppIsBlendState1D(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_LayerState_cppIsBlendStateDirect(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_LayerState_cppIsEntryState(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_LayerState_cppIsExitState(JNIEnv*, jobject, jlong);
+    JNIEXPORT jobject JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppAdvance(JNIEnv*, jobject, jlong, jfloat);
+    JNIEXPORT jobject JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppAdvanceAndGetResult(JNIEnv*, jobject, jlong, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppApply(JNIEnv*, jobject, jlong, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppDuration(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppFps(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppGetDirection(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppGetLoop(JNIEnv*, jobject, jlong);
+    JNIEXPORT jfloat JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppGetTime(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppName(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppSetDirection(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppSetLoop(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppSetTime(JNIEnv*, jobject, jlong, jfloat);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppWorkEnd(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppWorkStart(JNIEnv*, jobject, jlong);
+#if defined(DEBUG)
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_NativeFontTestHelper_cppCleanupFallbacks(JNIEnv*, jobject);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_NativeFontTestHelper_cppFindFontFallback(JNIEnv*, jobject, jint, jbyteArray);
+    JNIEXPORT jbyteArray JNICALL Java_app_rive_runtime_kotlin_core_NativeFontTestHelper_cppGetSystemFontBytes(JNIEnv*, jobject);
+    JNIEXPORT jlongArray JNICALL Java_app_rive_runtime_kotlin_core_NativeFramePacerTestHelper_cppSimulate(JNIEnv*, jobject, jlong, jlong, jint);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_NativeFrameStatsTestHelper_cppCopyRecords(JNIEnv*, jobject, jlongArray, jlongArray);
+    JNIEXPORT jlongArray JNICALL Java_app_rive_runtime_kotlin_core_NativeFrameStatsTestHelper_cppSummarize(JNIEnv*, jobject, jlongArray);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_NativePixelKernelsTestHelper_cppCountMismatches(JNIEnv*, jobject);
+    JNIEXPORT jlongArray JNICALL Java_app_rive_runtime_kotlin_core_NativePixelKernelsTestHelper_cppTimeKernels(JNIEnv*, jobject, jint, jint, jboolean);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_NativeRiveLogTestHelper_cppLog(JNIEnv*, jobject, jint, jstring, jstring);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_NativeStringTestHelper_cppMakeEmbeddedNullString(JNIEnv*, jobject);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_NativeStringTestHelper_cppMakeEmojiString(JNIEnv*, jobject);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_NativeStringTestHelper_cppRoundTripString(JNIEnv*, jobject, jstring);
+    JNIEXPORT jintArray JNICALL Java_app_rive_runtime_kotlin_core_NativeThreadTestHelper_cppSelectPerformanceCpus(JNIEnv*, jobject, jstring);
+    JNIEXPORT jlongArray JNICALL Java_app_rive_runtime_kotlin_core_NativeWorkQueueTestHelper_cppRunContentionBenchmark(JNIEnv*, jobject, jint, jint, jboolean);
+#endif
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ReportedEvents_constructor(JNIEnv*, jobject);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ReportedEvents_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT jobject JNICALL Java_app_rive_runtime_kotlin_core_ReportedEvents_cppView(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_ReportedEvents_cppWrite(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_Rive_cppCalculateRequiredBounds(JNIEnv*, jobject, jobject, jobject, jobject, jobject, jobject, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_Rive_cppInitialize(JNIEnv*, jobject);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_RiveAudio_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_RiveAudio_00024Companion_cppMakeAudio(JNIEnv*, jobject, jbyteArray, jint);
+    JNIEXPORT jobject JNICALL Java_app_rive_runtime_kotlin_core_RiveEvent_cppData(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_RiveEvent_cppName(JNIEnv*, jobject, jlong);
+    JNIEXPORT jobject JNICALL Java_app_rive_runtime_kotlin_core_RiveEvent_cppProperties(JNIEnv*, jobject, jlong);
+    JNIEXPORT jshort JNICALL Java_app_rive_runtime_kotlin_core_RiveEvent_cppType(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_RiveFont_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_RiveFont_00024Companion_cppMakeFont(JNIEnv*, jobject, jbyteArray, jint);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_RiveOpenURLEvent_cppTarget(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_RiveOpenURLEvent_cppURL(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_RiveRenderImage_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_RiveRenderImage_00024Companion_cppFromARGBInts(JNIEnv*, jobject, jintArray, jint, jint, jint, jboolean);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_RiveRenderImage_00024Companion_cppFromBitmapCanvas(JNIEnv*, jobject, jobject);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_RiveRenderImage_00024Companion_cppFromBitmapRive(JNIEnv*, jobject, jobject, jboolean);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_RiveRenderImage_00024Companion_cppFromRGBABytes(JNIEnv*, jobject, jbyteArray, jint, jint, jint, jboolean);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_RiveTextValueRun_cppSetText(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_RiveTextValueRun_cppText(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_SMIBoolean_cppSetValue(JNIEnv*, jobject, jlong, jboolean);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_SMIBoolean_cppValue(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_SMIInput_cppIsBoolean(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_SMIInput_cppIsNumber(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_SMIInput_cppIsTrigger(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_SMIInput_cppName(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_SMINumber_cppSetValue(JNIEnv*, jobject, jlong, jfloat);
+    JNIEXPORT jfloat JNICALL Java_app_rive_runtime_kotlin_core_SMINumber_cppValue(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_SMITrigger_cppFire(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppAdvance(JNIEnv*, jobject, jlong, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppInputCount(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppLayerCount(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppName(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppPointerDown(JNIEnv*, jobject, jlong, jint, jfloat, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppPointerExit(JNIEnv*, jobject, jlong, jint, jfloat, jfloat);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppPointerMove(JNIEnv*, jobject, jlong, jint, jfloat, jfloat);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppPointerUp(JNIEnv*, jobject, jlong, jint, jfloat, jfloat);
+    JNIEXPORT jobject JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppReportedEventAt(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppReportedEventCount(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppSMIInputByIndex(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppSetViewModelInstance(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppStateChangedByIndex(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppStateChangedCount(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModel_cppCreateBlankInstance(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModel_cppCreateDefaultInstance(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModel_cppCreateInstanceFromIndex(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModel_cppCreateInstanceFromName(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jobject JNICALL Java_app_rive_runtime_kotlin_core_ViewModel_cppGetProperties(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_ViewModel_cppInstanceCount(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_ViewModel_cppName(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_ViewModel_cppPropertyCount(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelArtboardProperty_cppSetArtboard(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelArtboardProperty_cppSetBindableArtboard(JNIEnv*, jobject, jlong, jlong, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_ViewModelBooleanProperty_cppGetValue(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelBooleanProperty_cppSetValue(JNIEnv*, jobject, jlong, jboolean);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_ViewModelColorProperty_cppGetValue(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelColorProperty_cppSetValue(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_ViewModelEnumProperty_cppGetValue(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelEnumProperty_cppSetValue(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelImageProperty_cppSetValue(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppDerefInstance(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppName(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyArtboard(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyBoolean(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyColor(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyEnum(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyImage(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyInstance(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyList(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyNumber(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyString(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyTrigger(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppRefInstance(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppSetInstanceProperty(JNIEnv*, jobject, jlong, jstring, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppAdd(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppAddAt(JNIEnv*, jobject, jlong, jint, jlong);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppElementAt(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppRemove(JNIEnv*, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppRemoveAt(JNIEnv*, jobject, jlong, jint);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppSize(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppSwap(JNIEnv*, jobject, jlong, jint, jint);
+    JNIEXPORT jfloat JNICALL Java_app_rive_runtime_kotlin_core_ViewModelNumberProperty_cppGetValue(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelNumberProperty_cppSetValue(JNIEnv*, jobject, jlong, jfloat);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_ViewModelProperty_cppFlushChanges(JNIEnv*, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_core_ViewModelProperty_cppHasChanged(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_ViewModelProperty_cppName(JNIEnv*, jobject, jlong);
+    JNIEXPORT jstring JNICALL Java_app_rive_runtime_kotlin_core_ViewModelStringProperty_cppGetValue(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelStringProperty_cppSetValue(JNIEnv*, jobject, jlong, jstring);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_core_ViewModelTriggerProperty_cppTrigger(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_fonts_FontFallbackStrategy_00024Companion_cppResetFontCache(JNIEnv*, jobject);
+    JNIEXPORT jboolean JNICALL Java_app_rive_runtime_kotlin_fonts_NativeFontHelper_cppRegisterFallbackFont(JNIEnv*, jobject, jbyteArray);
+    JNIEXPORT jlong JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_constructor(JNIEnv*, jobject, jboolean, jint);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppAlign(JNIEnv*, jobject, jlong, jobject, jobject, jobject, jobject, jfloat);
+    JNIEXPORT jfloat JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppAvgFps(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppCopyFrameRecords(JNIEnv*, jobject, jlong, jlongArray);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppDelete(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppDestroySurface(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppDoFrame(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlongArray JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppFramePacingStats(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlongArray JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppFrameTimingStats(JNIEnv*, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppHeight(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppRestore(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppSave(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppSetSurface(JNIEnv*, jobject, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppStart(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppStop(JNIEnv*, jobject, jlong);
+    JNIEXPORT void JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppTransform(JNIEnv*, jobject, jlong, jfloat, jfloat, jfloat, jfloat, jfloat, jfloat);
+    JNIEXPORT jint JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppWidth(JNIEnv*, jobject, jlong);
+    JNIEXPORT jlongArray JNICALL Java_app_rive_runtime_kotlin_renderers_Renderer_cppWorkerLaneStats(JNIEnv*, jobject, jlong, jint);
+}
+
+namespace rive_android
+{
+namespace
+{
+const JNINativeMethod kRiveLogMethods[] = {
+    {"cppDroppedMessageCount",
+     "()J",
+     reinterpret_cast<void*>(&Java_app_rive_RiveLog_cppDroppedMessageCount)},
+    {"cppSetNativeLogLevel",
+     "(I)V",
+     reinterpret_cast<void*>(&Java_app_rive_RiveLog_cppSetNativeLogLevel)},
+};
+
+const JNINativeMethod kCoreAudioEngineMethods[] = {
+    {"acquire",
+     "()V",
+     reinterpret_cast<void*>(&Java_app_rive_core_AudioEngine_acquire)},
+    {"release",
+     "()V",
+     reinterpret_cast<void*>(&Java_app_rive_core_AudioEngine_release)},
+};
+
+const JNINativeMethod kCoreCommandQueueJNIBridgeMethods[] = {
+    {"cppAdvanceStateMachine",
+     "(JJJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppAdvanceStateMachine)},
+    {"cppAdvanceStateMachines",
+     "(JJ[JIJZ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppAdvanceStateMachines)},
+    {"cppAppendToList",
+     "(JJLjava/lang/String;J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppAppendToList)},
+    {"cppApplyPropertyBatch",
+     "(J[BI)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppApplyPropertyBatch)},
+    {"cppBindViewModelInstance",
+     "(JJJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppBindViewModelInstance)},
+    {"cppCancelDraw",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppCancelDraw)},
+    {"cppConstructor",
+     "(J)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppConstructor)},
+    {"cppConstructorAsync",
+     "(JLapp/rive/core/CommandQueueStartup;)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppConstructorAsync)},
+    {"cppCopyFileBytes",
+     "(Ljava/nio/ByteBuffer;II)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppCopyFileBytes)},
+    {"cppCopyFrameRecords",
+     "(J[J)I",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppCopyFrameRecords)},
+    {"cppCreateArtboardByName",
+     "(JJJLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppCreateArtboardByName)},
+    {"cppCreateDefaultArtboard",
+     "(JJJ)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppCreateDefaultArtboard)},
+    {"cppCreateDefaultStateMachine",
+     "(JJJ)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppCreateDefaultStateMachine)},
+    {"cppCreateDrawKey",
+     "(J)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppCreateDrawKey)},
+    {"cppCreateListeners",
+     "(JLapp/rive/core/CommandQueue;)Lapp/rive/core/Listeners;",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppCreateListeners)},
+    {"cppCreateStateMachineByName",
+     "(JJJLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppCreateStateMachineByName)},
+    {"cppDecodeAudio",
+     "(JJ[B)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDecodeAudio)},
+    {"cppDecodeFont",
+     "(JJ[B)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDecodeFont)},
+    {"cppDecodeImage",
+     "(JJ[B)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDecodeImage)},
+    {"cppDefaultVMCreateBlankVMI",
+     "(JJJJ)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDefaultVMCreateBlankVMI)},
+    {"cppDefaultVMCreateDefaultVMI",
+     "(JJJJ)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDefaultVMCreateDefaultVMI)},
+    {"cppDefaultVMCreateNamedVMI",
+     "(JJJJLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDefaultVMCreateNamedVMI)},
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDelete)},
+    {"cppDeleteArtboard",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDeleteArtboard)},
+    {"cppDeleteAudio",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDeleteAudio)},
+    {"cppDeleteFile",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDeleteFile)},
+    {"cppDeleteFileBytes",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDeleteFileBytes)},
+    {"cppDeleteFont",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDeleteFont)},
+    {"cppDeleteImage",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDeleteImage)},
+    {"cppDeleteStateMachine",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDeleteStateMachine)},
+    {"cppDeleteViewModelInstance",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDeleteViewModelInstance)},
+    {"cppDraw",
+     "(JJJJJJIIBBFIZ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDraw)},
+    {"cppDrawToBuffer",
+     "(JJJJJJIIBBFI[B)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDrawToBuffer)},
+    {"cppDrawToBufferAsync",
+     "(JJJJJJIIBBFI[BLkotlin/jvm/functions/Function1;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDrawToBufferAsync)},
+    {"cppDrawToDirectBufferAsync",
+     "(JJJJJJIIBBFILjava/nio/ByteBuffer;Lkotlin/jvm/functions/Function1;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppDrawToDirectBufferAsync)},
+    {"cppFireTriggerProperty",
+     "(JJLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppFireTriggerProperty)},
+    {"cppFireTriggerPropertyByHandle",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppFireTriggerPropertyByHandle)},
+    {"cppFrameTimingStats",
+     "(J)[J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppFrameTimingStats)},
+    {"cppGetArtboardNames",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetArtboardNames)},
+    {"cppGetArtboardVolume",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetArtboardVolume)},
+    {"cppGetBooleanProperty",
+     "(JJJLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetBooleanProperty)},
+    {"cppGetColorProperty",
+     "(JJJLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetColorProperty)},
+    {"cppGetDefaultViewModelInfo",
+     "(JJJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetDefaultViewModelInfo)},
+    {"cppGetEnumProperty",
+     "(JJJLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetEnumProperty)},
+    {"cppGetEnums",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetEnums)},
+    {"cppGetFileAssets",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetFileAssets)},
+    {"cppGetListSize",
+     "(JJJLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetListSize)},
+    {"cppGetNumberProperty",
+     "(JJJLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetNumberProperty)},
+    {"cppGetStateMachineNames",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetStateMachineNames)},
+    {"cppGetStringProperty",
+     "(JJJLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetStringProperty)},
+    {"cppGetViewModelInstanceName",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetViewModelInstanceName)},
+    {"cppGetViewModelInstanceNames",
+     "(JJJLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetViewModelInstanceNames)},
+    {"cppGetViewModelInstanceViewModelName",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetViewModelInstanceViewModelName)},
+    {"cppGetViewModelNames",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetViewModelNames)},
+    {"cppGetViewModelProperties",
+     "(JJJLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppGetViewModelProperties)},
+    {"cppInsertToListAtIndex",
+     "(JJLjava/lang/String;IJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppInsertToListAtIndex)},
+    {"cppLoadFile",
+     "(JJ[B)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppLoadFile)},
+    {"cppLoadFileBytes",
+     "(JJJ)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppLoadFileBytes)},
+    {"cppMapFileBytes",
+     "(IJJ)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppMapFileBytes)},
+    {"cppNamedVMCreateBlankVMI",
+     "(JJJLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppNamedVMCreateBlankVMI)},
+    {"cppNamedVMCreateDefaultVMI",
+     "(JJJLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppNamedVMCreateDefaultVMI)},
+    {"cppNamedVMCreateNamedVMI",
+     "(JJJLjava/lang/String;Ljava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppNamedVMCreateNamedVMI)},
+    {"cppPointerDown",
+     "(JJBBFFFIFF)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppPointerDown)},
+    {"cppPointerEvents",
+     "(JJBBFFF[FI)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppPointerEvents)},
+    {"cppPointerExit",
+     "(JJBBFFFIFF)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppPointerExit)},
+    {"cppPointerMove",
+     "(JJBBFFFIFF)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppPointerMove)},
+    {"cppPointerUp",
+     "(JJBBFFFIFF)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppPointerUp)},
+    {"cppPollMessages",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppPollMessages)},
+    {"cppPresentPendingFrame",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppPresentPendingFrame)},
+    {"cppReferenceListItemVMI",
+     "(JJJLjava/lang/String;I)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppReferenceListItemVMI)},
+    {"cppReferenceNestedVMI",
+     "(JJJLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppReferenceNestedVMI)},
+    {"cppRegisterAudio",
+     "(JLjava/lang/String;J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppRegisterAudio)},
+    {"cppRegisterFont",
+     "(JLjava/lang/String;J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppRegisterFont)},
+    {"cppRegisterImage",
+     "(JLjava/lang/String;J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppRegisterImage)},
+    {"cppReleaseProperty",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppReleaseProperty)},
+    {"cppRemoveFromList",
+     "(JJLjava/lang/String;J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppRemoveFromList)},
+    {"cppRemoveFromListAtIndex",
+     "(JJLjava/lang/String;I)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppRemoveFromListAtIndex)},
+    {"cppResetArtboardSize",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppResetArtboardSize)},
+    {"cppResizeArtboard",
+     "(JJIIF)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppResizeArtboard)},
+    {"cppResolveProperty",
+     "(JJLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppResolveProperty)},
+    {"cppRunOnCommandServer",
+     "(JLkotlin/jvm/functions/Function0;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppRunOnCommandServer)},
+    {"cppSetArtboardProperty",
+     "(JJLjava/lang/String;J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetArtboardProperty)},
+    {"cppSetArtboardVolume",
+     "(JJJF)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetArtboardVolume)},
+    {"cppSetBooleanProperty",
+     "(JJLjava/lang/String;Z)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetBooleanProperty)},
+    {"cppSetBooleanPropertyByHandle",
+     "(JJZ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetBooleanPropertyByHandle)},
+    {"cppSetColorProperty",
+     "(JJLjava/lang/String;I)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetColorProperty)},
+    {"cppSetColorPropertyByHandle",
+     "(JJI)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetColorPropertyByHandle)},
+    {"cppSetEnumProperty",
+     "(JJLjava/lang/String;Ljava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetEnumProperty)},
+    {"cppSetEnumPropertyByHandle",
+     "(JJLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetEnumPropertyByHandle)},
+    {"cppSetImageProperty",
+     "(JJLjava/lang/String;J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetImageProperty)},
+    {"cppSetMessageBuffer",
+     "(JLjava/nio/ByteBuffer;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetMessageBuffer)},
+    {"cppSetNumberProperty",
+     "(JJLjava/lang/String;F)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetNumberProperty)},
+    {"cppSetNumberPropertyByHandle",
+     "(JJF)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetNumberPropertyByHandle)},
+    {"cppSetStringProperty",
+     "(JJLjava/lang/String;Ljava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetStringProperty)},
+    {"cppSetStringPropertyByHandle",
+     "(JJLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetStringPropertyByHandle)},
+    {"cppSetTracingEnabled",
+     "(JZ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetTracingEnabled)},
+    {"cppSetViewModelInstanceProperty",
+     "(JJLjava/lang/String;J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSetViewModelInstanceProperty)},
+    {"cppSubscribeToProperty",
+     "(JJLjava/lang/String;I)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSubscribeToProperty)},
+    {"cppSwapListItems",
+     "(JJLjava/lang/String;II)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppSwapListItems)},
+    {"cppUnregisterAudio",
+     "(JLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppUnregisterAudio)},
+    {"cppUnregisterFont",
+     "(JLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppUnregisterFont)},
+    {"cppUnregisterImage",
+     "(JLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_cppUnregisterImage)},
+    {"isCurrentThreadCommandServer",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_core_CommandQueueJNIBridge_isCurrentThreadCommandServer)},
+};
+
+const JNINativeMethod kCoreListenersMethods[] = {
+    {"cppDelete",
+     "(JJJJJJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_Listeners_cppDelete)},
+};
+
+const JNINativeMethod kCoreRenderContextGLMethods[] = {
+    {"cppConstructor",
+     "(JJ)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_RenderContextGL_cppConstructor)},
+    {"cppCreateSurface",
+     "(JII)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_RenderContextGL_cppCreateSurface)},
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_RenderContextGL_cppDelete)},
+};
+
+#if defined(RIVE_VULKAN)
+const JNINativeMethod kCoreRenderContextVulkanMethods[] = {
+    {"cppConstructor",
+     "()J",
+     reinterpret_cast<void*>(&Java_app_rive_core_RenderContextVulkan_cppConstructor)},
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_RenderContextVulkan_cppDelete)},
+};
+#endif
+
+const JNINativeMethod kCoreRiveSurfaceMethods[] = {
+    {"cppDeleteSurfaceNative",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_RiveSurface_cppDeleteSurfaceNative)},
+    {"cppFramePipelineStats",
+     "(J)[J",
+     reinterpret_cast<void*>(&Java_app_rive_core_RiveSurface_cppFramePipelineStats)},
+    {"cppResizeSurface",
+     "(JII)V",
+     reinterpret_cast<void*>(&Java_app_rive_core_RiveSurface_cppResizeSurface)},
+};
+
+#if defined(RIVE_VULKAN)
+const JNINativeMethod kCoreRiveSurfaceVulkanMethods[] = {
+    {"cppCreateSurface",
+     "(JLandroid/view/Surface;II)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_RiveSurfaceVulkan_cppCreateSurface)},
+};
+#endif
+
+#if defined(RIVE_VULKAN)
+const JNINativeMethod kCoreRiveSurfaceVulkanImageMethods[] = {
+    {"cppCreateImageSurface",
+     "(JII)J",
+     reinterpret_cast<void*>(&Java_app_rive_core_RiveSurfaceVulkanImage_cppCreateImageSurface)},
+};
+#endif
+
+const JNINativeMethod kRuntimeKotlinCoreAnimationStateMethods[] = {
+    {"cppName",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_AnimationState_cppName)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreArtboardMethods[] = {
+    {"cppAdvance",
+     "(JF)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppAdvance)},
+    {"cppAnimationByIndex",
+     "(JI)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppAnimationByIndex)},
+    {"cppAnimationByName",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppAnimationByName)},
+    {"cppAnimationCount",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppAnimationCount)},
+    {"cppAnimationNameByIndex",
+     "(JI)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppAnimationNameByIndex)},
+    {"cppBounds",
+     "(J)Landroid/graphics/RectF;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppBounds)},
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppDelete)},
+    {"cppDraw",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppDraw)},
+    {"cppDrawAligned",
+     "(JJLapp/rive/runtime/kotlin/core/Fit;Lapp/rive/runtime/kotlin/core/Alignment;F)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppDrawAligned)},
+    {"cppFindTextValueRun",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppFindTextValueRun)},
+    {"cppFindTextValueRunAtPath",
+     "(JLjava/lang/String;Ljava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppFindTextValueRunAtPath)},
+    {"cppFindValueOfTextValueRun",
+     "(JLjava/lang/String;)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppFindValueOfTextValueRun)},
+    {"cppFindValueOfTextValueRunAtPath",
+     "(JLjava/lang/String;Ljava/lang/String;)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppFindValueOfTextValueRunAtPath)},
+    {"cppGetArtboardHeight",
+     "(J)F",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppGetArtboardHeight)},
+    {"cppGetArtboardWidth",
+     "(J)F",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppGetArtboardWidth)},
+    {"cppGetVolume",
+     "(J)F",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppGetVolume)},
+    {"cppInputByNameAtPath",
+     "(JLjava/lang/String;Ljava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppInputByNameAtPath)},
+    {"cppName",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppName)},
+    {"cppResetArtboardSize",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppResetArtboardSize)},
+    {"cppSetArtboardHeight",
+     "(JF)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppSetArtboardHeight)},
+    {"cppSetArtboardWidth",
+     "(JF)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppSetArtboardWidth)},
+    {"cppSetValueOfTextValueRun",
+     "(JLjava/lang/String;Ljava/lang/String;)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppSetValueOfTextValueRun)},
+    {"cppSetValueOfTextValueRunAtPath",
+     "(JLjava/lang/String;Ljava/lang/String;Ljava/lang/String;)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppSetValueOfTextValueRunAtPath)},
+    {"cppSetViewModelInstance",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppSetViewModelInstance)},
+    {"cppSetVolume",
+     "(JF)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppSetVolume)},
+    {"cppStateMachineByIndex",
+     "(JI)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppStateMachineByIndex)},
+    {"cppStateMachineByName",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppStateMachineByName)},
+    {"cppStateMachineCount",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppStateMachineCount)},
+    {"cppStateMachineNameByIndex",
+     "(JI)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Artboard_cppStateMachineNameByIndex)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreAudioAssetMethods[] = {
+    {"cppGetAudio",
+     "(J)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_AudioAsset_cppGetAudio)},
+    {"cppSetAudio",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_AudioAsset_cppSetAudio)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreBindableArtboardMethods[] = {
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_BindableArtboard_cppDelete)},
+    {"cppName",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_BindableArtboard_cppName)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreFileMethods[] = {
+    {"cppArtboardByIndex",
+     "(JI)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppArtboardByIndex)},
+    {"cppArtboardByName",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppArtboardByName)},
+    {"cppArtboardCount",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppArtboardCount)},
+    {"cppArtboardNameByIndex",
+     "(JI)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppArtboardNameByIndex)},
+    {"cppCreateBindableArtboardByName",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppCreateBindableArtboardByName)},
+    {"cppCreateDefaultBindableArtboard",
+     "(J)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppCreateDefaultBindableArtboard)},
+    {"cppDefaultViewModelForArtboard",
+     "(JJ)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppDefaultViewModelForArtboard)},
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppDelete)},
+    {"cppEnums",
+     "(J)Ljava/util/List;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppEnums)},
+    {"cppViewModelByIndex",
+     "(JI)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppViewModelByIndex)},
+    {"cppViewModelByName",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppViewModelByName)},
+    {"cppViewModelCount",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_cppViewModelCount)},
+    {"import",
+     "([BIIJ)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_import)},
+    {"importFd",
+     "(IJJIJ)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_File_importFd)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreFileAssetMethods[] = {
+    {"cppCDNUrl",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_FileAsset_cppCDNUrl)},
+    {"cppDecode",
+     "(J[BI)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_FileAsset_cppDecode)},
+    {"cppName",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_FileAsset_cppName)},
+    {"cppUniqueFilename",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_FileAsset_cppUniqueFilename)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreFileAssetLoaderMethods[] = {
+    {"constructor",
+     "()J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_FileAssetLoader_constructor)},
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_FileAssetLoader_cppDelete)},
+    {"cppRef",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_FileAssetLoader_cppRef)},
+    {"cppSetRendererType",
+     "(JI)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_FileAssetLoader_cppSetRendererType)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreFontAssetMethods[] = {
+    {"cppGetFont",
+     "(J)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_FontAsset_cppGetFont)},
+    {"cppSetFont",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_FontAsset_cppSetFont)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreHelpersMethods[] = {
+    {"cppConvertToArtboardSpace",
+     "(Landroid/graphics/RectF;Landroid/graphics/PointF;Lapp/rive/runtime/kotlin/core/Fit;Lapp/rive/runtime/kotlin/core/Alignment;Landroid/graphics/RectF;F)Landroid/graphics/PointF;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Helpers_cppConvertToArtboardSpace)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreImageAssetMethods[] = {
+    {"cppGetRenderImage",
+     "(J)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ImageAsset_cppGetRenderImage)},
+    {"cppImageAssetHeight",
+     "(J)F",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ImageAsset_cppImageAssetHeight)},
+    {"cppImageAssetWidth",
+     "(J)F",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ImageAsset_cppImageAssetWidth)},
+    {"cppSetRenderImage",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ImageAsset_cppSetRenderImage)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreLayerStateMethods[] = {
+    {"cppIsAnimationState",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LayerState_cppIsAnimationState)},
+    {"cppIsAnyState",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LayerState_cppIsAnyState)},
+    {"cppIsBlendState",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LayerState_cppIsBlendState)},
+    {"cppIsBlendState1D",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LayerState_cppIsBlendState1D)},
+    {"cppIsBlendStateDirect",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LayerState_cppIsBlendStateDirect)},
+    {"cppIsEntryState",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LayerState_cppIsEntryState)},
+    {"cppIsExitState",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LayerState_cppIsExitState)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreLinearAnimationInstanceMethods[] = {
+    {"cppAdvance",
+     "(JF)Lapp/rive/runtime/kotlin/core/Loop;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppAdvance)},
+    {"cppAdvanceAndGetResult",
+     "(JF)Lapp/rive/runtime/kotlin/core/AdvanceResult;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppAdvanceAndGetResult)},
+    {"cppApply",
+     "(JF)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppApply)},
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppDelete)},
+    {"cppDuration",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppDuration)},
+    {"cppFps",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppFps)},
+    {"cppGetDirection",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppGetDirection)},
+    {"cppGetLoop",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppGetLoop)},
+    {"cppGetTime",
+     "(J)F",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppGetTime)},
+    {"cppName",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppName)},
+    {"cppSetDirection",
+     "(JI)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppSetDirection)},
+    {"cppSetLoop",
+     "(JI)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppSetLoop)},
+    {"cppSetTime",
+     "(JF)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppSetTime)},
+    {"cppWorkEnd",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppWorkEnd)},
+    {"cppWorkStart",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_LinearAnimationInstance_cppWorkStart)},
+};
+
+#if defined(DEBUG)
+const JNINativeMethod kRuntimeKotlinCoreNativeFontTestHelperMethods[] = {
+    {"cppCleanupFallbacks",
+     "()V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeFontTestHelper_cppCleanupFallbacks)},
+    {"cppFindFontFallback",
+     "(I[B)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeFontTestHelper_cppFindFontFallback)},
+    {"cppGetSystemFontBytes",
+     "()[B",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeFontTestHelper_cppGetSystemFontBytes)},
+};
+#endif
+
+#if defined(DEBUG)
+const JNINativeMethod kRuntimeKotlinCoreNativeFramePacerTestHelperMethods[] = {
+    {"cppSimulate",
+     "(JJI)[J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeFramePacerTestHelper_cppSimulate)},
+};
+#endif
+
+#if defined(DEBUG)
+const JNINativeMethod kRuntimeKotlinCoreNativeFrameStatsTestHelperMethods[] = {
+    {"cppCopyRecords",
+     "([J[J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeFrameStatsTestHelper_cppCopyRecords)},
+    {"cppSummarize",
+     "([J)[J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeFrameStatsTestHelper_cppSummarize)},
+};
+#endif
+
+#if defined(DEBUG)
+const JNINativeMethod kRuntimeKotlinCoreNativePixelKernelsTestHelperMethods[] = {
+    {"cppCountMismatches",
+     "()I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativePixelKernelsTestHelper_cppCountMismatches)},
+    {"cppTimeKernels",
+     "(IIZ)[J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativePixelKernelsTestHelper_cppTimeKernels)},
+};
+#endif
+
+#if defined(DEBUG)
+const JNINativeMethod kRuntimeKotlinCoreNativeRiveLogTestHelperMethods[] = {
+    {"cppLog",
+     "(ILjava/lang/String;Ljava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeRiveLogTestHelper_cppLog)},
+};
+#endif
+
+#if defined(DEBUG)
+const JNINativeMethod kRuntimeKotlinCoreNativeStringTestHelperMethods[] = {
+    {"cppMakeEmbeddedNullString",
+     "()Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeStringTestHelper_cppMakeEmbeddedNullString)},
+    {"cppMakeEmojiString",
+     "()Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeStringTestHelper_cppMakeEmojiString)},
+    {"cppRoundTripString",
+     "(Ljava/lang/String;)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeStringTestHelper_cppRoundTripString)},
+};
+#endif
+
+#if defined(DEBUG)
+const JNINativeMethod kRuntimeKotlinCoreNativeThreadTestHelperMethods[] = {
+    {"cppSelectPerformanceCpus",
+     "(Ljava/lang/String;)[I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeThreadTestHelper_cppSelectPerformanceCpus)},
+};
+#endif
+
+#if defined(DEBUG)
+const JNINativeMethod kRuntimeKotlinCoreNativeWorkQueueTestHelperMethods[] = {
+    {"cppRunContentionBenchmark",
+     "(IIZ)[J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_NativeWorkQueueTestHelper_cppRunContentionBenchmark)},
+};
+#endif
+
+const JNINativeMethod kRuntimeKotlinCoreReportedEventsMethods[] = {
+    {"constructor",
+     "()J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ReportedEvents_constructor)},
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ReportedEvents_cppDelete)},
+    {"cppView",
+     "(J)Ljava/nio/ByteBuffer;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ReportedEvents_cppView)},
+    {"cppWrite",
+     "(JJ)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ReportedEvents_cppWrite)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreRiveMethods[] = {
+    {"cppCalculateRequiredBounds",
+     "(Lapp/rive/runtime/kotlin/core/Fit;Lapp/rive/runtime/kotlin/core/Alignment;Landroid/graphics/RectF;Landroid/graphics/RectF;Landroid/graphics/RectF;F)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Rive_cppCalculateRequiredBounds)},
+    {"cppInitialize",
+     "()V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_Rive_cppInitialize)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreRiveAudioMethods[] = {
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveAudio_cppDelete)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreRiveAudioCompanionMethods[] = {
+    {"cppMakeAudio",
+     "([BI)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveAudio_00024Companion_cppMakeAudio)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreRiveEventMethods[] = {
+    {"cppData",
+     "(J)Ljava/util/HashMap;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveEvent_cppData)},
+    {"cppName",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveEvent_cppName)},
+    {"cppProperties",
+     "(J)Ljava/util/HashMap;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveEvent_cppProperties)},
+    {"cppType",
+     "(J)S",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveEvent_cppType)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreRiveFontMethods[] = {
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveFont_cppDelete)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreRiveFontCompanionMethods[] = {
+    {"cppMakeFont",
+     "([BI)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveFont_00024Companion_cppMakeFont)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreRiveOpenURLEventMethods[] = {
+    {"cppTarget",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveOpenURLEvent_cppTarget)},
+    {"cppURL",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveOpenURLEvent_cppURL)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreRiveRenderImageMethods[] = {
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveRenderImage_cppDelete)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreRiveRenderImageCompanionMethods[] = {
+    {"cppFromARGBInts",
+     "([IIIIZ)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveRenderImage_00024Companion_cppFromARGBInts)},
+    {"cppFromBitmapCanvas",
+     "(Landroid/graphics/Bitmap;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveRenderImage_00024Companion_cppFromBitmapCanvas)},
+    {"cppFromBitmapRive",
+     "(Landroid/graphics/Bitmap;Z)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveRenderImage_00024Companion_cppFromBitmapRive)},
+    {"cppFromRGBABytes",
+     "([BIIIZ)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveRenderImage_00024Companion_cppFromRGBABytes)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreRiveTextValueRunMethods[] = {
+    {"cppSetText",
+     "(JLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveTextValueRun_cppSetText)},
+    {"cppText",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_RiveTextValueRun_cppText)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreSMIBooleanMethods[] = {
+    {"cppSetValue",
+     "(JZ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_SMIBoolean_cppSetValue)},
+    {"cppValue",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_SMIBoolean_cppValue)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreSMIInputMethods[] = {
+    {"cppIsBoolean",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_SMIInput_cppIsBoolean)},
+    {"cppIsNumber",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_SMIInput_cppIsNumber)},
+    {"cppIsTrigger",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_SMIInput_cppIsTrigger)},
+    {"cppName",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_SMIInput_cppName)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreSMINumberMethods[] = {
+    {"cppSetValue",
+     "(JF)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_SMINumber_cppSetValue)},
+    {"cppValue",
+     "(J)F",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_SMINumber_cppValue)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreSMITriggerMethods[] = {
+    {"cppFire",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_SMITrigger_cppFire)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreStateMachineInstanceMethods[] = {
+    {"cppAdvance",
+     "(JF)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppAdvance)},
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppDelete)},
+    {"cppInputCount",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppInputCount)},
+    {"cppLayerCount",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppLayerCount)},
+    {"cppName",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppName)},
+    {"cppPointerDown",
+     "(JIFF)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppPointerDown)},
+    {"cppPointerExit",
+     "(JIFF)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppPointerExit)},
+    {"cppPointerMove",
+     "(JIFF)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppPointerMove)},
+    {"cppPointerUp",
+     "(JIFF)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppPointerUp)},
+    {"cppReportedEventAt",
+     "(JI)Lapp/rive/runtime/kotlin/core/RiveEventReport;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppReportedEventAt)},
+    {"cppReportedEventCount",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppReportedEventCount)},
+    {"cppSMIInputByIndex",
+     "(JI)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppSMIInputByIndex)},
+    {"cppSetViewModelInstance",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppSetViewModelInstance)},
+    {"cppStateChangedByIndex",
+     "(JI)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppStateChangedByIndex)},
+    {"cppStateChangedCount",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_StateMachineInstance_cppStateChangedCount)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelMethods[] = {
+    {"cppCreateBlankInstance",
+     "(J)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModel_cppCreateBlankInstance)},
+    {"cppCreateDefaultInstance",
+     "(J)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModel_cppCreateDefaultInstance)},
+    {"cppCreateInstanceFromIndex",
+     "(JI)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModel_cppCreateInstanceFromIndex)},
+    {"cppCreateInstanceFromName",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModel_cppCreateInstanceFromName)},
+    {"cppGetProperties",
+     "(J)Ljava/util/List;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModel_cppGetProperties)},
+    {"cppInstanceCount",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModel_cppInstanceCount)},
+    {"cppName",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModel_cppName)},
+    {"cppPropertyCount",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModel_cppPropertyCount)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelArtboardPropertyMethods[] = {
+    {"cppSetArtboard",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelArtboardProperty_cppSetArtboard)},
+    {"cppSetBindableArtboard",
+     "(JJJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelArtboardProperty_cppSetBindableArtboard)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelBooleanPropertyMethods[] = {
+    {"cppGetValue",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelBooleanProperty_cppGetValue)},
+    {"cppSetValue",
+     "(JZ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelBooleanProperty_cppSetValue)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelColorPropertyMethods[] = {
+    {"cppGetValue",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelColorProperty_cppGetValue)},
+    {"cppSetValue",
+     "(JI)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelColorProperty_cppSetValue)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelEnumPropertyMethods[] = {
+    {"cppGetValue",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelEnumProperty_cppGetValue)},
+    {"cppSetValue",
+     "(JLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelEnumProperty_cppSetValue)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelImagePropertyMethods[] = {
+    {"cppSetValue",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelImageProperty_cppSetValue)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelInstanceMethods[] = {
+    {"cppDerefInstance",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppDerefInstance)},
+    {"cppName",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppName)},
+    {"cppPropertyArtboard",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyArtboard)},
+    {"cppPropertyBoolean",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyBoolean)},
+    {"cppPropertyColor",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyColor)},
+    {"cppPropertyEnum",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyEnum)},
+    {"cppPropertyImage",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyImage)},
+    {"cppPropertyInstance",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyInstance)},
+    {"cppPropertyList",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyList)},
+    {"cppPropertyNumber",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyNumber)},
+    {"cppPropertyString",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyString)},
+    {"cppPropertyTrigger",
+     "(JLjava/lang/String;)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppPropertyTrigger)},
+    {"cppRefInstance",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppRefInstance)},
+    {"cppSetInstanceProperty",
+     "(JLjava/lang/String;J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelInstance_cppSetInstanceProperty)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelListPropertyMethods[] = {
+    {"cppAdd",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppAdd)},
+    {"cppAddAt",
+     "(JIJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppAddAt)},
+    {"cppElementAt",
+     "(JI)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppElementAt)},
+    {"cppRemove",
+     "(JJ)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppRemove)},
+    {"cppRemoveAt",
+     "(JI)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppRemoveAt)},
+    {"cppSize",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppSize)},
+    {"cppSwap",
+     "(JII)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelListProperty_cppSwap)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelNumberPropertyMethods[] = {
+    {"cppGetValue",
+     "(J)F",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelNumberProperty_cppGetValue)},
+    {"cppSetValue",
+     "(JF)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelNumberProperty_cppSetValue)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelPropertyMethods[] = {
+    {"cppFlushChanges",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelProperty_cppFlushChanges)},
+    {"cppHasChanged",
+     "(J)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelProperty_cppHasChanged)},
+    {"cppName",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelProperty_cppName)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelStringPropertyMethods[] = {
+    {"cppGetValue",
+     "(J)Ljava/lang/String;",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelStringProperty_cppGetValue)},
+    {"cppSetValue",
+     "(JLjava/lang/String;)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelStringProperty_cppSetValue)},
+};
+
+const JNINativeMethod kRuntimeKotlinCoreViewModelTriggerPropertyMethods[] = {
+    {"cppTrigger",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_core_ViewModelTriggerProperty_cppTrigger)},
+};
+
+const JNINativeMethod kRuntimeKotlinFontsFontFallbackStrategyCompanionMethods[] = {
+    {"cppResetFontCache",
+     "()V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_fonts_FontFallbackStrategy_00024Companion_cppResetFontCache)},
+};
+
+const JNINativeMethod kRuntimeKotlinFontsNativeFontHelperMethods[] = {
+    {"cppRegisterFallbackFont",
+     "([B)Z",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_fonts_NativeFontHelper_cppRegisterFallbackFont)},
+};
+
+const JNINativeMethod kRuntimeKotlinRenderersRendererMethods[] = {
+    {"constructor",
+     "(ZI)J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_constructor)},
+    {"cppAlign",
+     "(JLapp/rive/runtime/kotlin/core/Fit;Lapp/rive/runtime/kotlin/core/Alignment;Landroid/graphics/RectF;Landroid/graphics/RectF;F)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppAlign)},
+    {"cppAvgFps",
+     "(J)F",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppAvgFps)},
+    {"cppCopyFrameRecords",
+     "(J[J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppCopyFrameRecords)},
+    {"cppDelete",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppDelete)},
+    {"cppDestroySurface",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppDestroySurface)},
+    {"cppDoFrame",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppDoFrame)},
+    {"cppFramePacingStats",
+     "(J)[J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppFramePacingStats)},
+    {"cppFrameTimingStats",
+     "(J)[J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppFrameTimingStats)},
+    {"cppHeight",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppHeight)},
+    {"cppRestore",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppRestore)},
+    {"cppSave",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppSave)},
+    {"cppSetSurface",
+     "(Landroid/view/Surface;J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppSetSurface)},
+    {"cppStart",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppStart)},
+    {"cppStop",
+     "(J)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppStop)},
+    {"cppTransform",
+     "(JFFFFFF)V",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppTransform)},
+    {"cppWidth",
+     "(J)I",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppWidth)},
+    {"cppWorkerLaneStats",
+     "(JI)[J",
+     reinterpret_cast<void*>(&Java_app_rive_runtime_kotlin_renderers_Renderer_cppWorkerLaneStats)},
+};
+
+} // namespace
+
+const NativeClassMethods kNativeClassMethods[] = {
+    {"app/rive/RiveLog",
+     kRiveLogMethods,
+     std::size(kRiveLogMethods)},
+    {"app/rive/core/AudioEngine",
+     kCoreAudioEngineMethods,
+     std::size(kCoreAudioEngineMethods)},
+    {"app/rive/core/CommandQueueJNIBridge",
+     kCoreCommandQueueJNIBridgeMethods,
+     std::size(kCoreCommandQueueJNIBridgeMethods)},
+    {"app/rive/core/Listeners",
+     kCoreListenersMethods,
+     std::size(kCoreListenersMethods)},
+    {"app/rive/core/RenderContextGL",
+     kCoreRenderContextGLMethods,
+     std::size(kCoreRenderContextGLMethods)},
+#if defined(RIVE_VULKAN)
+    {"app/rive/core/RenderContextVulkan",
+     kCoreRenderContextVulkanMethods,
+     std::size(kCoreRenderContextVulkanMethods)},
+#endif
+    {"app/rive/core/RiveSurface",
+     kCoreRiveSurfaceMethods,
+     std::size(kCoreRiveSurfaceMethods)},
+#if defined(RIVE_VULKAN)
+    {"app/rive/core/RiveSurfaceVulkan",
+     kCoreRiveSurfaceVulkanMethods,
+     std::size(kCoreRiveSurfaceVulkanMethods)},
+    {"app/rive/core/RiveSurfaceVulkanImage",
+     kCoreRiveSurfaceVulkanImageMethods,
+     std::size(kCoreRiveSurfaceVulkanImageMethods)},
+#endif
+    {"app/rive/runtime/kotlin/core/AnimationState",
+     kRuntimeKotlinCoreAnimationStateMethods,
+     std::size(kRuntimeKotlinCoreAnimationStateMethods)},
+    {"app/rive/runtime/kotlin/core/Artboard",
+     kRuntimeKotlinCoreArtboardMethods,
+     std::size(kRuntimeKotlinCoreArtboardMethods)},
+    {"app/rive/runtime/kotlin/core/AudioAsset",
+     kRuntimeKotlinCoreAudioAssetMethods,
+     std::size(kRuntimeKotlinCoreAudioAssetMethods)},
+    {"app/rive/runtime/kotlin/core/BindableArtboard",
+     kRuntimeKotlinCoreBindableArtboardMethods,
+     std::size(kRuntimeKotlinCoreBindableArtboardMethods)},
+    {"app/rive/runtime/kotlin/core/File",
+     kRuntimeKotlinCoreFileMethods,
+     std::size(kRuntimeKotlinCoreFileMethods)},
+    {"app/rive/runtime/kotlin/core/FileAsset",
+     kRuntimeKotlinCoreFileAssetMethods,
+     std::size(kRuntimeKotlinCoreFileAssetMethods)},
+    {"app/rive/runtime/kotlin/core/FileAssetLoader",
+     kRuntimeKotlinCoreFileAssetLoaderMethods,
+     std::size(kRuntimeKotlinCoreFileAssetLoaderMethods)},
+    {"app/rive/runtime/kotlin/core/FontAsset",
+     kRuntimeKotlinCoreFontAssetMethods,
+     std::size(kRuntimeKotlinCoreFontAssetMethods)},
+    {"app/rive/runtime/kotlin/core/Helpers",
+     kRuntimeKotlinCoreHelpersMethods,
+     std::size(kRuntimeKotlinCoreHelpersMethods)},
+    {"app/rive/runtime/kotlin/core/ImageAsset",
+     kRuntimeKotlinCoreImageAssetMethods,
+     std::size(kRuntimeKotlinCoreImageAssetMethods)},
+    {"app/rive/runtime/kotlin/core/LayerState",
+     kRuntimeKotlinCoreLayerStateMethods,
+     std::size(kRuntimeKotlinCoreLayerStateMethods)},
+    {"app/rive/runtime/kotlin/core/LinearAnimationInstance",
+     kRuntimeKotlinCoreLinearAnimationInstanceMethods,
+     std::size(kRuntimeKotlinCoreLinearAnimationInstanceMethods)},
+#if defined(DEBUG)
+    {"app/rive/runtime/kotlin/core/NativeFontTestHelper",
+     kRuntimeKotlinCoreNativeFontTestHelperMethods,
+     std::size(kRuntimeKotlinCoreNativeFontTestHelperMethods)},
+    {"app/rive/runtime/kotlin/core/NativeFramePacerTestHelper",
+     kRuntimeKotlinCoreNativeFramePacerTestHelperMethods,
+     std::size(kRuntimeKotlinCoreNativeFramePacerTestHelperMethods)},
+    {"app/rive/runtime/kotlin/core/NativeFrameStatsTestHelper",
+     kRuntimeKotlinCoreNativeFrameStatsTestHelperMethods,
+     std::size(kRuntimeKotlinCoreNativeFrameStatsTestHelperMethods)},
+    {"app/rive/runtime/kotlin/core/NativePixelKernelsTestHelper",
+     kRuntimeKotlinCoreNativePixelKernelsTestHelperMethods,
+     std::size(kRuntimeKotlinCoreNativePixelKernelsTestHelperMethods)},
+    {"app/rive/runtime/kotlin/core/NativeRiveLogTestHelper",
+     kRuntimeKotlinCoreNativeRiveLogTestHelperMethods,
+     std::size(kRuntimeKotlinCoreNativeRiveLogTestHelperMethods)},
+    {"app/rive/runtime/kotlin/core/NativeStringTestHelper",
+     kRuntimeKotlinCoreNativeStringTestHelperMethods,
+     std::size(kRuntimeKotlinCoreNativeStringTestHelperMethods)},
+    {"app/rive/runtime/kotlin/core/NativeThreadTestHelper",
+     kRuntimeKotlinCoreNativeThreadTestHelperMethods,
+     std::size(kRuntimeKotlinCoreNativeThreadTestHelperMethods)},
+    {"app/rive/runtime/kotlin/core/NativeWorkQueueTestHelper",
+     kRuntimeKotlinCoreNativeWorkQueueTestHelperMethods,
+     std::size(kRuntimeKotlinCoreNativeWorkQueueTestHelperMethods)},
+#endif
+    {"app/rive/runtime/kotlin/core/ReportedEvents",
+     kRuntimeKotlinCoreReportedEventsMethods,
+     std::size(kRuntimeKotlinCoreReportedEventsMethods)},
+    {"app/rive/runtime/kotlin/core/Rive",
+     kRuntimeKotlinCoreRiveMethods,
+     std::size(kRuntimeKotlinCoreRiveMethods)},
+    {"app/rive/runtime/kotlin/core/RiveAudio",
+     kRuntimeKotlinCoreRiveAudioMethods,
+     std::size(kRuntimeKotlinCoreRiveAudioMethods)},
+    {"app/rive/runtime/kotlin/core/RiveAudio$Companion",
+     kRuntimeKotlinCoreRiveAudioCompanionMethods,
+     std::size(kRuntimeKotlinCoreRiveAudioCompanionMethods)},
+    {"app/rive/runtime/kotlin/core/RiveEvent",
+     kRuntimeKotlinCoreRiveEventMethods,
+     std::size(kRuntimeKotlinCoreRiveEventMethods)},
+    {"app/rive/runtime/kotlin/core/RiveFont",
+     kRuntimeKotlinCoreRiveFontMethods,
+     std::size(kRuntimeKotlinCoreRiveFontMethods)},
+    {"app/rive/runtime/kotlin/core/RiveFont$Companion",
+     kRuntimeKotlinCoreRiveFontCompanionMethods,
+     std::size(kRuntimeKotlinCoreRiveFontCompanionMethods)},
+    {"app/rive/runtime/kotlin/core/RiveOpenURLEvent",
+     kRuntimeKotlinCoreRiveOpenURLEventMethods,
+     std::size(kRuntimeKotlinCoreRiveOpenURLEventMethods)},
+    {"app/rive/runtime/kotlin/core/RiveRenderImage",
+     kRuntimeKotlinCoreRiveRenderImageMethods,
+     std::size(kRuntimeKotlinCoreRiveRenderImageMethods)},
+    {"app/rive/runtime/kotlin/core/RiveRenderImage$Companion",
+     kRuntimeKotlinCoreRiveRenderImageCompanionMethods,
+     std::size(kRuntimeKotlinCoreRiveRenderImageCompanionMethods)},
+    {"app/rive/runtime/kotlin/core/RiveTextValueRun",
+     kRuntimeKotlinCoreRiveTextValueRunMethods,
+     std::size(kRuntimeKotlinCoreRiveTextValueRunMethods)},
+    {"app/rive/runtime/kotlin/core/SMIBoolean",
+     kRuntimeKotlinCoreSMIBooleanMethods,
+     std::size(kRuntimeKotlinCoreSMIBooleanMethods)},
+    {"app/rive/runtime/kotlin/core/SMIInput",
+     kRuntimeKotlinCoreSMIInputMethods,
+     std::size(kRuntimeKotlinCoreSMIInputMethods)},
+    {"app/rive/runtime/kotlin/core/SMINumber",
+     kRuntimeKotlinCoreSMINumberMethods,
+     std::size(kRuntimeKotlinCoreSMINumberMethods)},
+    {"app/rive/runtime/kotlin/core/SMITrigger",
+     kRuntimeKotlinCoreSMITriggerMethods,
+     std::size(kRuntimeKotlinCoreSMITriggerMethods)},
+    {"app/rive/runtime/kotlin/core/StateMachineInstance",
+     kRuntimeKotlinCoreStateMachineInstanceMethods,
+     std::size(kRuntimeKotlinCoreStateMachineInstanceMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModel",
+     kRuntimeKotlinCoreViewModelMethods,
+     std::size(kRuntimeKotlinCoreViewModelMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModelArtboardProperty",
+     kRuntimeKotlinCoreViewModelArtboardPropertyMethods,
+     std::size(kRuntimeKotlinCoreViewModelArtboardPropertyMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModelBooleanProperty",
+     kRuntimeKotlinCoreViewModelBooleanPropertyMethods,
+     std::size(kRuntimeKotlinCoreViewModelBooleanPropertyMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModelColorProperty",
+     kRuntimeKotlinCoreViewModelColorPropertyMethods,
+     std::size(kRuntimeKotlinCoreViewModelColorPropertyMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModelEnumProperty",
+     kRuntimeKotlinCoreViewModelEnumPropertyMethods,
+     std::size(kRuntimeKotlinCoreViewModelEnumPropertyMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModelImageProperty",
+     kRuntimeKotlinCoreViewModelImagePropertyMethods,
+     std::size(kRuntimeKotlinCoreViewModelImagePropertyMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModelInstance",
+     kRuntimeKotlinCoreViewModelInstanceMethods,
+     std::size(kRuntimeKotlinCoreViewModelInstanceMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModelListProperty",
+     kRuntimeKotlinCoreViewModelListPropertyMethods,
+     std::size(kRuntimeKotlinCoreViewModelListPropertyMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModelNumberProperty",
+     kRuntimeKotlinCoreViewModelNumberPropertyMethods,
+     std::size(kRuntimeKotlinCoreViewModelNumberPropertyMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModelProperty",
+     kRuntimeKotlinCoreViewModelPropertyMethods,
+     std::size(kRuntimeKotlinCoreViewModelPropertyMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModelStringProperty",
+     kRuntimeKotlinCoreViewModelStringPropertyMethods,
+     std::size(kRuntimeKotlinCoreViewModelStringPropertyMethods)},
+    {"app/rive/runtime/kotlin/core/ViewModelTriggerProperty",
+     kRuntimeKotlinCoreViewModelTriggerPropertyMethods,
+     std::size(kRuntimeKotlinCoreViewModelTriggerPropertyMethods)},
+    {"app/rive/runtime/kotlin/fonts/FontFallbackStrategy$Companion",
+     kRuntimeKotlinFontsFontFallbackStrategyCompanionMethods,
+     std::size(kRuntimeKotlinFontsFontFallbackStrategyCompanionMethods)},
+    {"app/rive/runtime/kotlin/fonts/NativeFontHelper",
+     kRuntimeKotlinFontsNativeFontHelperMethods,
+     std::size(kRuntimeKotlinFontsNativeFontHelperMethods)},
+    {"app/rive/runtime/kotlin/renderers/Renderer",
+     kRuntimeKotlinRenderersRendererMethods,
+     std::size(kRuntimeKotlinRenderersRendererMethods)},
+};
+const size_t kNativeClassMethodsCount = std::size(kNativeClassMethods);
+} // namespace rive_android
@@ -0,0 +1,59 @@
+#include "jni_natives.hpp"
+
+#include "helpers/rive_log.hpp"
+
+namespace rive_android
+{
+namespace
+{
+constexpr auto* TAG = "RiveN/JNINatives";
+
+/**
+ * Registers a class's methods one at a time, after registering them together
+ * failed, so that a single missing method only disables itself.
+ */
+void RegisterEachMethod(JNIEnv* env,
+                        jclass clazz,
+                        const NativeClassMethods& natives)
+{
+    for (size_t i = 0; i < natives.count; i++)
+    {
+        const auto& method = natives.methods[i];
+        if (env->RegisterNatives(clazz, &method, 1) != JNI_OK)
+        {
+            env->ExceptionClear();
+            RiveLogE(TAG,
+                     "Failed to register native %s.%s%s",
+                     natives.className,
+                     method.name,
+                     method.signature);
+        }
+    }
+}
+} // namespace
+
+void RegisterNativeMethods(JNIEnv* env)
+{
+    for (size_t i = 0; i < kNativeClassMethodsCount; i++)
+    {
+        const auto& natives = kNativeClassMethods[i];
+        jclass clazz = env->FindClass(natives.className);
+        if (clazz == nullptr)
+        {
+            env->ExceptionClear();
+            RiveLogD(TAG,
+                     "Skipping natives of unavailable class %s",
+                     natives.className);
+            continue;
+        }
+        if (env->RegisterNatives(clazz,
+                                 natives.methods,
+                                 static_cast<jint>(natives.count)) != JNI_OK)
+        {
+            env->ExceptionClear();
+            RegisterEachMethod(env, clazz, natives);
+        }
+        env->DeleteLocalRef(clazz);
+    }
+}
+} // namespace rive_android
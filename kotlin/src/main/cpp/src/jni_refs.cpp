@@ -6,415 +6,542 @@
 #include <sys/system_properties.h>
 
 #include "helpers/general.hpp"
+#include "helpers/rive_log.hpp"
 
 namespace rive_android
 {
-jclass GetClass(const char* name) { return GetJNIEnv()->FindClass(name); }
-jmethodID GetMethodId(jclass clazz, const char* name, const char* sig)
-{
-    JNIEnv* env = GetJNIEnv();
-    jmethodID output = env->GetMethodID(clazz, name, sig);
-    env->DeleteLocalRef(clazz);
-    return output;
-}
-jmethodID GetStaticMethodId(jclass clazz, const char* name, const char* sig)
-{
-    JNIEnv* env = GetJNIEnv();
-    jmethodID output = env->GetStaticMethodID(clazz, name, sig);
-    env->DeleteLocalRef(clazz);
-    return output;
-}
-
-jfieldID GetStaticFieldId(jclass clazz, const char* name, const char* sig)
-{
-    JNIEnv* env = GetJNIEnv();
-    jfieldID output = env->GetStaticFieldID(clazz, name, sig);
-    env->DeleteLocalRef(clazz);
-    return output;
-}
-
-jfieldID GetFieldId(jclass clazz, const char* name, const char* sig)
-{
-    JNIEnv* env = GetJNIEnv();
-    jfieldID output = env->GetFieldID(clazz, name, sig);
-    env->DeleteLocalRef(clazz);
-    return output;
-}
-
-jint ThrowRiveException(const char* message)
-{
-    jclass exClass =
-        GetClass("app/rive/runtime/kotlin/core/errors/RiveException");
-    return GetJNIEnv()->ThrowNew(exClass, message);
-}
-jint ThrowMalformedFileException(const char* message)
-{
-    jclass exClass =
-        GetClass("app/rive/runtime/kotlin/core/errors/MalformedFileException");
-    return GetJNIEnv()->ThrowNew(exClass, message);
-}
-jint ThrowUnsupportedRuntimeVersionException(const char* message)
-{
-    jclass exClass = GetClass("app/rive/runtime/kotlin/core/errors/"
-                              "UnsupportedRuntimeVersionException");
-    return GetJNIEnv()->ThrowNew(exClass, message);
-}
-
-jclass GetHashMapClass() { return GetClass("java/util/HashMap"); }
-jmethodID GetHashMapConstructorId()
-{
-    return GetMethodId(GetHashMapClass(), "<init>", "()V");
-}
-
-jclass GetFloatClass() { return GetClass("java/lang/Float"); }
-jmethodID GetFloatConstructor()
-{
-    return GetMethodId(GetFloatClass(), "<init>", "(F)V");
-}
-
-jclass GetBooleanClass() { return GetClass("java/lang/Boolean"); }
-jmethodID GetBooleanConstructor()
-{
-    return GetMethodId(GetBooleanClass(), "<init>", "(Z)V");
-}
-
-jclass GetShortClass() { return GetClass("java/lang/Short"); }
-jmethodID GetShortConstructor()
-{
-    return GetMethodId(GetShortClass(), "<init>", "(S)V");
-}
-
-jclass GetFitClass() { return GetClass("app/rive/runtime/kotlin/core/Fit"); }
-jmethodID GetFitNameMethodId()
-{
-    return GetMethodId(GetFitClass(), "name", "()Ljava/lang/String;");
-}
-
-jclass GetAlignmentClass()
-{
-    return GetClass("app/rive/runtime/kotlin/core/Alignment");
-}
-jmethodID GetAlignmentNameMethodId()
-{
-    return GetMethodId(GetAlignmentClass(), "name", "()Ljava/lang/String;");
-}
-
-jclass GetLoopClass() { return GetClass("app/rive/runtime/kotlin/core/Loop"); }
-
-jfieldID GetNoneLoopField()
-{
-    return GetStaticFieldId(GetLoopClass(),
-                            "NONE",
-                            "Lapp/rive/runtime/kotlin/core/Loop;");
-}
-jfieldID GetOneShotLoopField()
-{
-    return GetStaticFieldId(GetLoopClass(),
-                            "ONESHOT",
-                            "Lapp/rive/runtime/kotlin/core/Loop;");
-}
-jfieldID GetLoopLoopField()
-{
-    return GetStaticFieldId(GetLoopClass(),
-                            "LOOP",
-                            "Lapp/rive/runtime/kotlin/core/Loop;");
-}
-jfieldID GetPingPongLoopField()
-{
-    return GetStaticFieldId(GetLoopClass(),
-                            "PINGPONG",
-                            "Lapp/rive/runtime/kotlin/core/Loop;");
-}
-
-jclass GetAdvanceResultClass()
-{
-    return GetClass("app/rive/runtime/kotlin/core/AdvanceResult");
-}
-
-jfieldID GetAdvanceResultAdvancedField()
-{
-    return GetStaticFieldId(GetAdvanceResultClass(),
-                            "ADVANCED",
-                            "Lapp/rive/runtime/kotlin/core/AdvanceResult;");
-}
-jfieldID GetAdvanceResultOneShotField()
-{
-    return GetStaticFieldId(GetAdvanceResultClass(),
-                            "ONESHOT",
-                            "Lapp/rive/runtime/kotlin/core/AdvanceResult;");
-}
-jfieldID GetAdvanceResultLoopField()
-{
-    return GetStaticFieldId(GetAdvanceResultClass(),
-                            "LOOP",
-                            "Lapp/rive/runtime/kotlin/core/AdvanceResult;");
-}
-jfieldID GetAdvanceResultPingPongField()
-{
-    return GetStaticFieldId(GetAdvanceResultClass(),
-                            "PINGPONG",
-                            "Lapp/rive/runtime/kotlin/core/AdvanceResult;");
-}
-jfieldID GetAdvanceResultNoneField()
-{
-    return GetStaticFieldId(GetAdvanceResultClass(),
-                            "NONE",
-                            "Lapp/rive/runtime/kotlin/core/AdvanceResult;");
-}
-
-jclass GetRiveEventReportClass()
-{
-    return GetClass("app/rive/runtime/kotlin/core/RiveEventReport");
-}
-jmethodID GetRiveEventReportConstructorId()
-{
-    return GetMethodId(GetRiveEventReportClass(), "<init>", "(JF)V");
-}
-
-jclass GetPointerFClass() { return GetClass("android/graphics/PointF"); }
-
-jfieldID GetXFieldId() { return GetFieldId(GetPointerFClass(), "x", "F"); }
-
-jfieldID GetYFieldId() { return GetFieldId(GetPointerFClass(), "y", "F"); }
-
-jmethodID GetPointFInitMethod()
-{
-    return GetMethodId(GetPointerFClass(), "<init>", "(FF)V");
-}
-
-static const char* AABBFieldNames[] = {"left", "top", "right", "bottom"};
-
-rive::AABB RectFToAABB(JNIEnv* env, jobject rectf)
-{
-    auto cls = env->FindClass("android/graphics/RectF");
-    float values[4];
-    for (int i = 0; i < 4; ++i)
+namespace
+{
+constexpr auto* TAG = "RiveN/JNIRefs";
+
+/**
+ * Every class, method and field ID handed out by the accessors in this file.
+ *
+ * Populated once by InitJNIRefs() from JNI_OnLoad and read-only afterwards, so
+ * the accessors are plain loads that are safe from any thread, including
+ * native-attached threads whose FindClass can't see app classes. Classes are
+ * held as global refs, which also keeps the IDs derived from them valid for
+ * the lifetime of the process.
+ */
+struct JNIRefs
+{
+    jclass riveExceptionClass = nullptr;
+    jclass malformedFileExceptionClass = nullptr;
+    jclass unsupportedRuntimeVersionExceptionClass = nullptr;
+
+    jclass hashMapClass = nullptr;
+    jmethodID hashMapConstructor = nullptr;
+    jmethodID hashMapPut = nullptr;
+    jclass floatClass = nullptr;
+    jmethodID floatConstructor = nullptr;
+    jclass booleanClass = nullptr;
+    jmethodID booleanConstructor = nullptr;
+    jclass shortClass = nullptr;
+    jmethodID shortConstructor = nullptr;
+
+    jclass fitClass = nullptr;
+    jmethodID fitName = nullptr;
+    jclass alignmentClass = nullptr;
+    jmethodID alignmentName = nullptr;
+
+    jclass loopClass = nullptr;
+    jfieldID loopNone = nullptr;
+    jfieldID loopOneShot = nullptr;
+    jfieldID loopLoop = nullptr;
+    jfieldID loopPingPong = nullptr;
+
+    jclass advanceResultClass = nullptr;
+    jfieldID advanceResultAdvanced = nullptr;
+    jfieldID advanceResultOneShot = nullptr;
+    jfieldID advanceResultLoop = nullptr;
+    jfieldID advanceResultPingPong = nullptr;
+    jfieldID advanceResultNone = nullptr;
+
+    jclass riveEventReportClass = nullptr;
+    jmethodID riveEventReportConstructor = nullptr;
+
+    jclass pointFClass = nullptr;
+    jmethodID pointFInit = nullptr;
+    jfieldID pointFX = nullptr;
+    jfieldID pointFY = nullptr;
+
+    jclass rectFClass = nullptr;
+    // Ordered as left, top, right, bottom to match rive::AABB.
+    jfieldID rectFFields[4] = {};
+
+    jclass radialGradientClass = nullptr;
+    jmethodID radialGradientInit = nullptr;
+    jclass linearGradientClass = nullptr;
+    jmethodID linearGradientInit = nullptr;
+    jclass tileModeClass = nullptr;
+    jfieldID tileModeClamp = nullptr;
+
+    jclass paintClass = nullptr;
+    jmethodID paintInit = nullptr;
+    jmethodID paintSetColor = nullptr;
+    jmethodID paintSetAlpha = nullptr;
+    jmethodID paintSetAntiAlias = nullptr;
+    jmethodID paintSetFilterBitmap = nullptr;
+    jmethodID paintSetShader = nullptr;
+    jmethodID paintSetStyle = nullptr;
+    jmethodID paintSetStrokeWidth = nullptr;
+    jmethodID paintSetStrokeJoin = nullptr;
+    jmethodID paintSetStrokeCap = nullptr;
+    jmethodID paintSetBlendMode = nullptr;
+    jmethodID paintSetXfermode = nullptr;
+    jmethodID paintSetColorFilter = nullptr;
+
+    jclass styleClass = nullptr;
+    jfieldID styleFill = nullptr;
+    jfieldID styleStroke = nullptr;
+
+    jclass joinClass = nullptr;
+    jfieldID joinMiter = nullptr;
+    jfieldID joinRound = nullptr;
+    jfieldID joinBevel = nullptr;
+
+    jclass capClass = nullptr;
+    jfieldID capButt = nullptr;
+    jfieldID capRound = nullptr;
+    jfieldID capSquare = nullptr;
+
+    // android.graphics.BlendMode only exists on API 29+.
+    jclass blendModeClass = nullptr;
+    jfieldID blendSrcOver = nullptr;
+    jfieldID blendScreen = nullptr;
+    jfieldID blendOverlay = nullptr;
+    jfieldID blendDarken = nullptr;
+    jfieldID blendLighten = nullptr;
+    jfieldID blendColorDodge = nullptr;
+    jfieldID blendColorBurn = nullptr;
+    jfieldID blendHardLight = nullptr;
+    jfieldID blendSoftLight = nullptr;
+    jfieldID blendDifference = nullptr;
+    jfieldID blendExclusion = nullptr;
+    jfieldID blendMultiply = nullptr;
+    jfieldID blendHue = nullptr;
+    jfieldID blendSaturation = nullptr;
+    jfieldID blendColor = nullptr;
+    jfieldID blendLuminosity = nullptr;
+
+    jclass pathClass = nullptr;
+    jmethodID pathInit = nullptr;
+    jmethodID pathReset = nullptr;
+    jmethodID pathSetFillType = nullptr;
+    jmethodID pathAddPath = nullptr;
+    jmethodID pathMoveTo = nullptr;
+    jmethodID pathLineTo = nullptr;
+    jmethodID pathCubicTo = nullptr;
+    jmethodID pathClose = nullptr;
+
+    jclass fillTypeClass = nullptr;
+    jfieldID fillTypeEvenOdd = nullptr;
+    jfieldID fillTypeNonZero = nullptr;
+
+    jclass matrixClass = nullptr;
+    jmethodID matrixInit = nullptr;
+    jmethodID matrixSetValues = nullptr;
+
+    jclass surfaceClass = nullptr;
+    jmethodID surfaceLockCanvas = nullptr;
+    jmethodID surfaceUnlockCanvasAndPost = nullptr;
+
+    jclass canvasClass = nullptr;
+    jclass canvasVertexModeClass = nullptr;
+    jmethodID canvasSave = nullptr;
+    jmethodID canvasRestore = nullptr;
+    jmethodID canvasConcat = nullptr;
+    jmethodID canvasDrawPath = nullptr;
+    jmethodID canvasDrawColor = nullptr;
+    jmethodID canvasDrawBitmap = nullptr;
+    jmethodID canvasDrawVertices = nullptr;
+    jfieldID vertexModeTriangles = nullptr;
+    jmethodID canvasClipPath = nullptr;
+    jmethodID canvasGetWidth = nullptr;
+    jmethodID canvasGetHeight = nullptr;
+
+    jclass porterDuffModeClass = nullptr;
+    jclass porterDuffXfermodeClass = nullptr;
+    jmethodID porterDuffXfermodeInit = nullptr;
+    jfieldID pdClear = nullptr;
+    jfieldID pdSrcOver = nullptr;
+    jfieldID pdDarken = nullptr;
+    jfieldID pdLighten = nullptr;
+    jfieldID pdMultiply = nullptr;
+    jfieldID pdScreen = nullptr;
+    jfieldID pdOverlay = nullptr;
+
+    jclass bitmapShaderClass = nullptr;
+    jmethodID bitmapShaderInit = nullptr;
+
+    jclass colorMatrixClass = nullptr;
+    jmethodID colorMatrixInit = nullptr;
+    jmethodID colorMatrixSet = nullptr;
+    jclass colorMatrixColorFilterClass = nullptr;
+    jmethodID colorMatrixColorFilterInit = nullptr;
+
+    jclass bitmapClass = nullptr;
+    jclass bitmapConfigClass = nullptr;
+    jclass bitmapFactoryClass = nullptr;
+    jmethodID bitmapCreateBitmap = nullptr;
+    jmethodID bitmapFactoryDecodeByteArray = nullptr;
+    jmethodID bitmapGetWidth = nullptr;
+    jmethodID bitmapGetHeight = nullptr;
+    jfieldID bitmapConfigARGB8888 = nullptr;
+    jmethodID bitmapSetPixels = nullptr;
+};
+
+JNIRefs g_refs;
+
+/** Clears and logs any pending exception. Returns true if one was pending. */
+bool ClearResolveException(JNIEnv* env, const char* what, const char* name)
+{
+    if (!env->ExceptionCheck())
     {
-        values[i] =
-            env->GetFloatField(rectf,
-                               env->GetFieldID(cls, AABBFieldNames[i], "F"));
+        return false;
     }
-    env->DeleteLocalRef(cls);
-    return {values[0], values[1], values[2], values[3]};
+    env->ExceptionClear();
+    RiveLogE(TAG, "Failed to resolve %s: %s", what, name);
+    return true;
 }
 
-void AABBToRectF(JNIEnv* env, const rive::AABB& aabb, jobject rectf)
+jclass ResolveClass(JNIEnv* env, const char* name)
 {
-    auto cls = env->FindClass("android/graphics/RectF");
-    const float values[4] = {aabb.left(),
-                             aabb.top(),
-                             aabb.right(),
-                             aabb.bottom()};
-    for (int i = 0; i < 4; ++i)
+    jclass localClass = env->FindClass(name);
+    if (ClearResolveException(env, "class", name) || localClass == nullptr)
     {
-        env->SetFloatField(rectf,
-                           env->GetFieldID(cls, AABBFieldNames[i], "F"),
-                           values[i]);
+        return nullptr;
     }
-    env->DeleteLocalRef(cls);
+    auto globalClass = static_cast<jclass>(env->NewGlobalRef(localClass));
+    env->DeleteLocalRef(localClass);
+    return globalClass;
 }
 
-jclass GetRadialGradientClass()
+jmethodID ResolveMethod(JNIEnv* env,
+                        jclass clazz,
+                        const char* name,
+                        const char* sig)
 {
-    return GetClass("android/graphics/RadialGradient");
-}
-jmethodID GetRadialGradientInitMethodId()
-{
-    return GetMethodId(GetRadialGradientClass(),
-                       "<init>",
-                       "(FFF[I[FLandroid/graphics/Shader$TileMode;)V");
-}
-
-jclass GetLinearGradientClass()
-{
-    return GetClass("android/graphics/LinearGradient");
-}
-jmethodID GetLinearGradientInitMethodId()
-{
-    return GetMethodId(GetLinearGradientClass(),
-                       "<init>",
-                       "(FFFF[I[FLandroid/graphics/Shader$TileMode;)V");
+    if (clazz == nullptr)
+    {
+        return nullptr;
+    }
+    jmethodID output = env->GetMethodID(clazz, name, sig);
+    return ClearResolveException(env, "method", name) ? nullptr : output;
 }
 
-jclass GetTileModeClass()
-{
-    return GetClass("android/graphics/Shader$TileMode");
-}
-jfieldID GetClampId()
+jmethodID ResolveStaticMethod(JNIEnv* env,
+                              jclass clazz,
+                              const char* name,
+                              const char* sig)
 {
-    return GetStaticFieldId(GetTileModeClass(),
-                            "CLAMP",
-                            "Landroid/graphics/Shader$TileMode;");
+    if (clazz == nullptr)
+    {
+        return nullptr;
+    }
+    jmethodID output = env->GetStaticMethodID(clazz, name, sig);
+    return ClearResolveException(env, "static method", name) ? nullptr
+                                                              : output;
 }
 
-jclass GetPaintClass() { return GetClass("android/graphics/Paint"); }
-
-jmethodID GetPaintInitMethod()
-{
-    return GetMethodId(GetPaintClass(), "<init>", "()V");
-}
-jmethodID GetSetColorMethodId()
-{
-    return GetMethodId(GetPaintClass(), "setColor", "(I)V");
-}
-jmethodID GetSetAlphaMethodId()
-{
-    return GetMethodId(GetPaintClass(), "setAlpha", "(I)V");
-}
-jmethodID GetSetAntiAliasMethodId()
-{
-    return GetMethodId(GetPaintClass(), "setAntiAlias", "(Z)V");
-}
-jmethodID GetSetFilterBitmapMethodId()
+jfieldID ResolveField(JNIEnv* env,
+                      jclass clazz,
+                      const char* name,
+                      const char* sig)
 {
-    return GetMethodId(GetPaintClass(), "setFilterBitmap", "(Z)V");
-}
-jmethodID GetSetShaderMethodId()
-{
-    return GetMethodId(GetPaintClass(),
-                       "setShader",
-                       "(Landroid/graphics/Shader;)Landroid/graphics/Shader;");
-}
-jmethodID GetSetStyleMethodId()
-{
-    return GetMethodId(GetPaintClass(),
-                       "setStyle",
-                       "(Landroid/graphics/Paint$Style;)V");
+    if (clazz == nullptr)
+    {
+        return nullptr;
+    }
+    jfieldID output = env->GetFieldID(clazz, name, sig);
+    return ClearResolveException(env, "field", name) ? nullptr : output;
 }
 
-jclass GetStyleClass() { return GetClass("android/graphics/Paint$Style"); }
-jclass GetJoinClass() { return GetClass("android/graphics/Paint$Join"); }
-jmethodID GetSetStrokeWidthMethodId()
-{
-    return GetMethodId(GetPaintClass(), "setStrokeWidth", "(F)V");
-}
-jmethodID GetSetStrokeJoinMethodId()
+jfieldID ResolveStaticField(JNIEnv* env,
+                            jclass clazz,
+                            const char* name,
+                            const char* sig)
 {
-    return GetMethodId(GetPaintClass(),
-                       "setStrokeJoin",
-                       "(Landroid/graphics/Paint$Join;)V");
+    if (clazz == nullptr)
+    {
+        return nullptr;
+    }
+    jfieldID output = env->GetStaticFieldID(clazz, name, sig);
+    return ClearResolveException(env, "static field", name) ? nullptr
+                                                             : output;
 }
+} // namespace
 
-jclass GetCapClass() { return GetClass("android/graphics/Paint$Cap"); }
-
-jmethodID GetSetStrokeCapMethodId()
+void InitJNIRefs(JNIEnv* env)
 {
-    return GetMethodId(GetPaintClass(),
-                       "setStrokeCap",
-                       "(Landroid/graphics/Paint$Cap;)V");
-}
-jclass GetBlendModeClass() { return GetClass("android/graphics/BlendMode"); }
+    if (g_refs.hashMapClass != nullptr)
+    {
+        // Already initialized.
+        return;
+    }
+    auto& r = g_refs;
+
+    r.riveExceptionClass =
+        ResolveClass(env, "app/rive/runtime/kotlin/core/errors/RiveException");
+    r.malformedFileExceptionClass = ResolveClass(
+        env,
+        "app/rive/runtime/kotlin/core/errors/MalformedFileException");
+    r.unsupportedRuntimeVersionExceptionClass =
+        ResolveClass(env,
+                     "app/rive/runtime/kotlin/core/errors/"
+                     "UnsupportedRuntimeVersionException");
+
+    r.hashMapClass = ResolveClass(env, "java/util/HashMap");
+    r.hashMapConstructor = ResolveMethod(env, r.hashMapClass, "<init>", "()V");
+    r.hashMapPut = ResolveMethod(
+        env,
+        r.hashMapClass,
+        "put",
+        "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+    r.floatClass = ResolveClass(env, "java/lang/Float");
+    r.floatConstructor = ResolveMethod(env, r.floatClass, "<init>", "(F)V");
+    r.booleanClass = ResolveClass(env, "java/lang/Boolean");
+    r.booleanConstructor =
+        ResolveMethod(env, r.booleanClass, "<init>", "(Z)V");
+    r.shortClass = ResolveClass(env, "java/lang/Short");
+    r.shortConstructor = ResolveMethod(env, r.shortClass, "<init>", "(S)V");
+
+    r.fitClass = ResolveClass(env, "app/rive/runtime/kotlin/core/Fit");
+    r.fitName =
+        ResolveMethod(env, r.fitClass, "name", "()Ljava/lang/String;");
+    r.alignmentClass =
+        ResolveClass(env, "app/rive/runtime/kotlin/core/Alignment");
+    r.alignmentName =
+        ResolveMethod(env, r.alignmentClass, "name", "()Ljava/lang/String;");
+
+    constexpr auto* loopSig = "Lapp/rive/runtime/kotlin/core/Loop;";
+    r.loopClass = ResolveClass(env, "app/rive/runtime/kotlin/core/Loop");
+    r.loopNone = ResolveStaticField(env, r.loopClass, "NONE", loopSig);
+    r.loopOneShot = ResolveStaticField(env, r.loopClass, "ONESHOT", loopSig);
+    r.loopLoop = ResolveStaticField(env, r.loopClass, "LOOP", loopSig);
+    r.loopPingPong =
+        ResolveStaticField(env, r.loopClass, "PINGPONG", loopSig);
+
+    constexpr auto* advanceResultSig =
+        "Lapp/rive/runtime/kotlin/core/AdvanceResult;";
+    r.advanceResultClass =
+        ResolveClass(env, "app/rive/runtime/kotlin/core/AdvanceResult");
+    r.advanceResultAdvanced = ResolveStaticField(env,
+                                                 r.advanceResultClass,
+                                                 "ADVANCED",
+                                                 advanceResultSig);
+    r.advanceResultOneShot = ResolveStaticField(env,
+                                                r.advanceResultClass,
+                                                "ONESHOT",
+                                                advanceResultSig);
+    r.advanceResultLoop = ResolveStaticField(env,
+                                             r.advanceResultClass,
+                                             "LOOP",
+                                             advanceResultSig);
+    r.advanceResultPingPong = ResolveStaticField(env,
+                                                 r.advanceResultClass,
+                                                 "PINGPONG",
+                                                 advanceResultSig);
+    r.advanceResultNone = ResolveStaticField(env,
+                                             r.advanceResultClass,
+                                             "NONE",
+                                             advanceResultSig);
+
+    r.riveEventReportClass =
+        ResolveClass(env, "app/rive/runtime/kotlin/core/RiveEventReport");
+    r.riveEventReportConstructor =
+        ResolveMethod(env, r.riveEventReportClass, "<init>", "(JF)V");
+
+    r.pointFClass = ResolveClass(env, "android/graphics/PointF");
+    r.pointFInit = ResolveMethod(env, r.pointFClass, "<init>", "(FF)V");
+    r.pointFX = ResolveField(env, r.pointFClass, "x", "F");
+    r.pointFY = ResolveField(env, r.pointFClass, "y", "F");
+
+    r.rectFClass = ResolveClass(env, "android/graphics/RectF");
+    r.rectFFields[0] = ResolveField(env, r.rectFClass, "left", "F");
+    r.rectFFields[1] = ResolveField(env, r.rectFClass, "top", "F");
+    r.rectFFields[2] = ResolveField(env, r.rectFClass, "right", "F");
+    r.rectFFields[3] = ResolveField(env, r.rectFClass, "bottom", "F");
+
+    r.radialGradientClass =
+        ResolveClass(env, "android/graphics/RadialGradient");
+    r.radialGradientInit =
+        ResolveMethod(env,
+                      r.radialGradientClass,
+                      "<init>",
+                      "(FFF[I[FLandroid/graphics/Shader$TileMode;)V");
+    r.linearGradientClass =
+        ResolveClass(env, "android/graphics/LinearGradient");
+    r.linearGradientInit =
+        ResolveMethod(env,
+                      r.linearGradientClass,
+                      "<init>",
+                      "(FFFF[I[FLandroid/graphics/Shader$TileMode;)V");
+    r.tileModeClass = ResolveClass(env, "android/graphics/Shader$TileMode");
+    r.tileModeClamp = ResolveStaticField(env,
+                                         r.tileModeClass,
+                                         "CLAMP",
+                                         "Landroid/graphics/Shader$TileMode;");
+
+    r.paintClass = ResolveClass(env, "android/graphics/Paint");
+    r.paintInit = ResolveMethod(env, r.paintClass, "<init>", "()V");
+    r.paintSetColor = ResolveMethod(env, r.paintClass, "setColor", "(I)V");
+    r.paintSetAlpha = ResolveMethod(env, r.paintClass, "setAlpha", "(I)V");
+    r.paintSetAntiAlias =
+        ResolveMethod(env, r.paintClass, "setAntiAlias", "(Z)V");
+    r.paintSetFilterBitmap =
+        ResolveMethod(env, r.paintClass, "setFilterBitmap", "(Z)V");
+    r.paintSetShader =
+        ResolveMethod(env,
+                      r.paintClass,
+                      "setShader",
+                      "(Landroid/graphics/Shader;)Landroid/graphics/Shader;");
+    r.paintSetStyle = ResolveMethod(env,
+                                    r.paintClass,
+                                    "setStyle",
+                                    "(Landroid/graphics/Paint$Style;)V");
+    r.paintSetStrokeWidth =
+        ResolveMethod(env, r.paintClass, "setStrokeWidth", "(F)V");
+    r.paintSetStrokeJoin = ResolveMethod(env,
+                                         r.paintClass,
+                                         "setStrokeJoin",
+                                         "(Landroid/graphics/Paint$Join;)V");
+    r.paintSetStrokeCap = ResolveMethod(env,
+                                        r.paintClass,
+                                        "setStrokeCap",
+                                        "(Landroid/graphics/Paint$Cap;)V");
+    r.paintSetXfermode = ResolveMethod(
+        env,
+        r.paintClass,
+        "setXfermode",
+        "(Landroid/graphics/Xfermode;)Landroid/graphics/Xfermode;");
+    /**
+     * Kotlin signature:
+     * ColorFilter setColorFilter(ColorFilter filter)
+     */
+    r.paintSetColorFilter = ResolveMethod(
+        env,
+        r.paintClass,
+        "setColorFilter",
+        "(Landroid/graphics/ColorFilter;)Landroid/graphics/ColorFilter;");
 
-jmethodID GetSetBlendModeMethodId()
-{
-    return GetMethodId(GetPaintClass(),
-                       "setBlendMode",
-                       "(Landroid/graphics/BlendMode;)V");
-}
+    constexpr auto* styleSig = "Landroid/graphics/Paint$Style;";
+    r.styleClass = ResolveClass(env, "android/graphics/Paint$Style");
+    r.styleFill = ResolveStaticField(env, r.styleClass, "FILL", styleSig);
+    r.styleStroke = ResolveStaticField(env, r.styleClass, "STROKE", styleSig);
 
-jclass GetPathClass() { return GetClass("android/graphics/Path"); }
-jmethodID GetPathInitMethodId()
-{
-    return GetMethodId(GetPathClass(), "<init>", "()V");
-}
-jmethodID GetResetMethodId()
-{
-    return GetMethodId(GetPathClass(), "reset", "()V");
-}
-jmethodID GetSetFillTypeMethodId()
-{
-    return GetMethodId(GetPathClass(),
-                       "setFillType",
-                       "(Landroid/graphics/Path$FillType;)V");
-}
+    constexpr auto* joinSig = "Landroid/graphics/Paint$Join;";
+    r.joinClass = ResolveClass(env, "android/graphics/Paint$Join");
+    r.joinMiter = ResolveStaticField(env, r.joinClass, "MITER", joinSig);
+    r.joinRound = ResolveStaticField(env, r.joinClass, "ROUND", joinSig);
+    r.joinBevel = ResolveStaticField(env, r.joinClass, "BEVEL", joinSig);
 
-jclass GetFillTypeClass() { return GetClass("android/graphics/Path$FillType"); }
-jclass GetMatrixClass() { return GetClass("android/graphics/Matrix"); }
-jmethodID GetMatrixInitMethodId()
-{
-    return GetMethodId(GetMatrixClass(), "<init>", "()V");
-}
-jmethodID GetMatrixSetValuesMethodId()
-{
-    return GetMethodId(GetMatrixClass(), "setValues", "([F)V");
-}
-jmethodID GetAddPathMethodId()
-{
-    return GetMethodId(GetPathClass(),
-                       "addPath",
-                       "(Landroid/graphics/Path;Landroid/graphics/Matrix;)V");
-}
-jmethodID GetMoveToMethodId()
-{
-    return GetMethodId(GetPathClass(), "moveTo", "(FF)V");
-}
-jmethodID GetLineToMethodId()
-{
-    return GetMethodId(GetPathClass(), "lineTo", "(FF)V");
-}
-jmethodID GetCubicToMethodId()
-{
-    return GetMethodId(GetPathClass(), "cubicTo", "(FFFFFF)V");
-}
-jmethodID GetCloseMethodId()
-{
-    return GetMethodId(GetPathClass(), "close", "()V");
-}
+    constexpr auto* capSig = "Landroid/graphics/Paint$Cap;";
+    r.capClass = ResolveClass(env, "android/graphics/Paint$Cap");
+    r.capButt = ResolveStaticField(env, r.capClass, "BUTT", capSig);
+    r.capRound = ResolveStaticField(env, r.capClass, "ROUND", capSig);
+    r.capSquare = ResolveStaticField(env, r.capClass, "SQUARE", capSig);
 
-jclass GetAndroidSurfaceClass() { return GetClass("android/view/Surface"); }
-jmethodID GetSurfaceLockCanvasMethodId()
-{
-    return GetMethodId(GetAndroidSurfaceClass(),
-                       "lockCanvas",
-                       "(Landroid/graphics/Rect;)Landroid/graphics/Canvas;");
-}
-jmethodID GetSurfaceUnlockCanvasAndPostMethodId()
-{
-    return GetMethodId(GetAndroidSurfaceClass(),
-                       "unlockCanvasAndPost",
-                       "(Landroid/graphics/Canvas;)V");
-}
+    if (g_sdkVersion >= 29)
+    {
+        constexpr auto* blendSig = "Landroid/graphics/BlendMode;";
+        auto* blend = r.blendModeClass =
+            ResolveClass(env, "android/graphics/BlendMode");
+        r.paintSetBlendMode = ResolveMethod(env,
+                                            r.paintClass,
+                                            "setBlendMode",
+                                            "(Landroid/graphics/BlendMode;)V");
+        r.blendSrcOver = ResolveStaticField(env, blend, "SRC_OVER", blendSig);
+        r.blendScreen = ResolveStaticField(env, blend, "SCREEN", blendSig);
+        r.blendOverlay = ResolveStaticField(env, blend, "OVERLAY", blendSig);
+        r.blendDarken = ResolveStaticField(env, blend, "DARKEN", blendSig);
+        r.blendLighten = ResolveStaticField(env, blend, "LIGHTEN", blendSig);
+        r.blendColorDodge =
+            ResolveStaticField(env, blend, "COLOR_DODGE", blendSig);
+        r.blendColorBurn =
+            ResolveStaticField(env, blend, "COLOR_BURN", blendSig);
+        r.blendHardLight =
+            ResolveStaticField(env, blend, "HARD_LIGHT", blendSig);
+        r.blendSoftLight =
+            ResolveStaticField(env, blend, "SOFT_LIGHT", blendSig);
+        r.blendDifference =
+            ResolveStaticField(env, blend, "DIFFERENCE", blendSig);
+        r.blendExclusion =
+            ResolveStaticField(env, blend, "EXCLUSION", blendSig);
+        r.blendMultiply = ResolveStaticField(env, blend, "MULTIPLY", blendSig);
+        r.blendHue = ResolveStaticField(env, blend, "HUE", blendSig);
+        r.blendSaturation =
+            ResolveStaticField(env, blend, "SATURATION", blendSig);
+        r.blendColor = ResolveStaticField(env, blend, "COLOR", blendSig);
+        r.blendLuminosity =
+            ResolveStaticField(env, blend, "LUMINOSITY", blendSig);
+    }
 
-jclass GetAndroidCanvasClass() { return GetClass("android/graphics/Canvas"); }
-jclass GetAndroidCanvasVertexModeClass()
-{
-    return GetClass("android/graphics/Canvas$VertexMode");
-}
-jmethodID GetCanvasSaveMethodId()
-{
-    return GetMethodId(GetAndroidCanvasClass(), "save", "()I");
-}
-jmethodID GetCanvasRestoreMethodId()
-{
-    return GetMethodId(GetAndroidCanvasClass(), "restore", "()V");
-}
-jmethodID GetCanvasConcatMatrixMethodId()
-{
-    return GetMethodId(GetAndroidCanvasClass(),
-                       "concat",
-                       "(Landroid/graphics/Matrix;)V");
-}
-jmethodID GetCanvasDrawPathMethodId()
-{
-    return GetMethodId(GetAndroidCanvasClass(),
-                       "drawPath",
-                       "(Landroid/graphics/Path;Landroid/graphics/Paint;)V");
-}
-jmethodID GetCanvasDrawColorMethodId()
-{
-    return GetMethodId(GetAndroidCanvasClass(),
-                       "drawColor",
-                       "(ILandroid/graphics/PorterDuff$Mode;)V");
-}
-jmethodID GetCanvasDrawBitmapMethodId()
-{
-    return GetMethodId(
-        GetAndroidCanvasClass(),
+    r.pathClass = ResolveClass(env, "android/graphics/Path");
+    r.pathInit = ResolveMethod(env, r.pathClass, "<init>", "()V");
+    r.pathReset = ResolveMethod(env, r.pathClass, "reset", "()V");
+    r.pathSetFillType = ResolveMethod(env,
+                                      r.pathClass,
+                                      "setFillType",
+                                      "(Landroid/graphics/Path$FillType;)V");
+    r.pathAddPath =
+        ResolveMethod(env,
+                      r.pathClass,
+                      "addPath",
+                      "(Landroid/graphics/Path;Landroid/graphics/Matrix;)V");
+    r.pathMoveTo = ResolveMethod(env, r.pathClass, "moveTo", "(FF)V");
+    r.pathLineTo = ResolveMethod(env, r.pathClass, "lineTo", "(FF)V");
+    r.pathCubicTo = ResolveMethod(env, r.pathClass, "cubicTo", "(FFFFFF)V");
+    r.pathClose = ResolveMethod(env, r.pathClass, "close", "()V");
+
+    constexpr auto* fillTypeSig = "Landroid/graphics/Path$FillType;";
+    r.fillTypeClass = ResolveClass(env, "android/graphics/Path$FillType");
+    r.fillTypeEvenOdd =
+        ResolveStaticField(env, r.fillTypeClass, "EVEN_ODD", fillTypeSig);
+    r.fillTypeNonZero =
+        ResolveStaticField(env, r.fillTypeClass, "WINDING", fillTypeSig);
+
+    r.matrixClass = ResolveClass(env, "android/graphics/Matrix");
+    r.matrixInit = ResolveMethod(env, r.matrixClass, "<init>", "()V");
+    r.matrixSetValues =
+        ResolveMethod(env, r.matrixClass, "setValues", "([F)V");
+
+    r.surfaceClass = ResolveClass(env, "android/view/Surface");
+    r.surfaceLockCanvas =
+        ResolveMethod(env,
+                      r.surfaceClass,
+                      "lockCanvas",
+                      "(Landroid/graphics/Rect;)Landroid/graphics/Canvas;");
+    r.surfaceUnlockCanvasAndPost =
+        ResolveMethod(env,
+                      r.surfaceClass,
+                      "unlockCanvasAndPost",
+                      "(Landroid/graphics/Canvas;)V");
+
+    r.canvasClass = ResolveClass(env, "android/graphics/Canvas");
+    r.canvasVertexModeClass =
+        ResolveClass(env, "android/graphics/Canvas$VertexMode");
+    r.canvasSave = ResolveMethod(env, r.canvasClass, "save", "()I");
+    r.canvasRestore = ResolveMethod(env, r.canvasClass, "restore", "()V");
+    r.canvasConcat = ResolveMethod(env,
+                                   r.canvasClass,
+                                   "concat",
+                                   "(Landroid/graphics/Matrix;)V");
+    r.canvasDrawPath =
+        ResolveMethod(env,
+                      r.canvasClass,
+                      "drawPath",
+                      "(Landroid/graphics/Path;Landroid/graphics/Paint;)V");
+    r.canvasDrawColor =
+        ResolveMethod(env,
+                      r.canvasClass,
+                      "drawColor",
+                      "(ILandroid/graphics/PorterDuff$Mode;)V");
+    r.canvasDrawBitmap = ResolveMethod(
+        env,
+        r.canvasClass,
         "drawBitmap",
         "(Landroid/graphics/Bitmap;FFLandroid/graphics/Paint;)V");
-}
-jmethodID GetCanvasDrawVerticesMethodId()
-{
     /** Kotlin signature:
      * drawVertices (Canvas.VertexMode mode,
                 int vertexCount,
@@ -429,371 +556,336 @@ jmethodID GetCanvasDrawVerticesMethodId()
                 int indexCount,
                 Paint paint)
      */
-    return GetMethodId(
-        GetAndroidCanvasClass(),
+    r.canvasDrawVertices = ResolveMethod(
+        env,
+        r.canvasClass,
         "drawVertices",
         "(Landroid/graphics/Canvas$VertexMode;I[FI[FI[II[SIILandroid/graphics/"
         "Paint;)V");
+    r.vertexModeTriangles =
+        ResolveStaticField(env,
+                           r.canvasVertexModeClass,
+                           "TRIANGLES",
+                           "Landroid/graphics/Canvas$VertexMode;");
+    r.canvasClipPath = ResolveMethod(env,
+                                     r.canvasClass,
+                                     "clipPath",
+                                     "(Landroid/graphics/Path;)Z");
+    r.canvasGetWidth = ResolveMethod(env, r.canvasClass, "getWidth", "()I");
+    r.canvasGetHeight = ResolveMethod(env, r.canvasClass, "getHeight", "()I");
+
+    constexpr auto* pdSig = "Landroid/graphics/PorterDuff$Mode;";
+    auto* pd = r.porterDuffModeClass =
+        ResolveClass(env, "android/graphics/PorterDuff$Mode");
+    r.porterDuffXfermodeClass =
+        ResolveClass(env, "android/graphics/PorterDuffXfermode");
+    r.porterDuffXfermodeInit =
+        ResolveMethod(env,
+                      r.porterDuffXfermodeClass,
+                      "<init>",
+                      "(Landroid/graphics/PorterDuff$Mode;)V");
+    r.pdClear = ResolveStaticField(env, pd, "CLEAR", pdSig);
+    r.pdSrcOver = ResolveStaticField(env, pd, "SRC_OVER", pdSig);
+    r.pdDarken = ResolveStaticField(env, pd, "DARKEN", pdSig);
+    r.pdLighten = ResolveStaticField(env, pd, "LIGHTEN", pdSig);
+    r.pdMultiply = ResolveStaticField(env, pd, "MULTIPLY", pdSig);
+    r.pdScreen = ResolveStaticField(env, pd, "SCREEN", pdSig);
+    r.pdOverlay = ResolveStaticField(env, pd, "OVERLAY", pdSig);
+
+    r.bitmapShaderClass = ResolveClass(env, "android/graphics/BitmapShader");
+    /**
+     * Kotlin signature:
+     * BitmapShader(Bitmap bitmap, Shader.TileMode tileX, Shader.TileMode tileY)
+     */
+    r.bitmapShaderInit = ResolveMethod(
+        env,
+        r.bitmapShaderClass,
+        "<init>",
+        "(Landroid/graphics/Bitmap;Landroid/graphics/Shader$TileMode;Landroid/"
+        "graphics/Shader$TileMode;)V");
+
+    r.colorMatrixClass = ResolveClass(env, "android/graphics/ColorMatrix");
+    r.colorMatrixInit = ResolveMethod(env, r.colorMatrixClass, "<init>", "()V");
+    /** Kotlin signature: void set(float[] src) */
+    r.colorMatrixSet = ResolveMethod(env, r.colorMatrixClass, "set", "([F)V");
+    r.colorMatrixColorFilterClass =
+        ResolveClass(env, "android/graphics/ColorMatrixColorFilter");
+    /**
+     * Kotlin signature:
+     * ColorMatrixColorFilter(ColorMatrix matrix)
+     */
+    r.colorMatrixColorFilterInit =
+        ResolveMethod(env,
+                      r.colorMatrixColorFilterClass,
+                      "<init>",
+                      "(Landroid/graphics/ColorMatrix;)V");
+
+    r.bitmapClass = ResolveClass(env, "android/graphics/Bitmap");
+    r.bitmapConfigClass = ResolveClass(env, "android/graphics/Bitmap$Config");
+    r.bitmapFactoryClass = ResolveClass(env, "android/graphics/BitmapFactory");
+    /**
+     * Kotlin signature:
+     * static Bitmap createBitmap (int width,
+     *  int height,
+     *  Bitmap.Config config)
+     */
+    r.bitmapCreateBitmap = ResolveStaticMethod(
+        env,
+        r.bitmapClass,
+        "createBitmap",
+        "(IILandroid/graphics/Bitmap$Config;)Landroid/graphics/Bitmap;");
+    /**
+     * Kotlin signature:
+     * static Bitmap decodeByteArray (byte[] data,
+     *   int offset,
+     *   int length)
+     */
+    r.bitmapFactoryDecodeByteArray =
+        ResolveStaticMethod(env,
+                            r.bitmapFactoryClass,
+                            "decodeByteArray",
+                            "([BII)Landroid/graphics/Bitmap;");
+    /** Kotlin signature: int getWidth () */
+    r.bitmapGetWidth = ResolveMethod(env, r.bitmapClass, "getWidth", "()I");
+    /** Kotlin signature: int getHeight () */
+    r.bitmapGetHeight = ResolveMethod(env, r.bitmapClass, "getHeight", "()I");
+    r.bitmapConfigARGB8888 =
+        ResolveStaticField(env,
+                           r.bitmapConfigClass,
+                           "ARGB_8888",
+                           "Landroid/graphics/Bitmap$Config;");
+    // void setPixels (int[] pixels, int offset, int stride, int x, int y, int
+    // width, int height)
+    r.bitmapSetPixels =
+        ResolveMethod(env, r.bitmapClass, "setPixels", "([IIIIIII)V");
 }
-jfieldID GetVertexModeTrianglesId()
-{
-    return GetStaticFieldId(GetAndroidCanvasVertexModeClass(),
-                            "TRIANGLES",
-                            "Landroid/graphics/Canvas$VertexMode;");
-}
-jmethodID GetCanvasClipPathMethodId()
+
+jint ThrowRiveException(const char* message)
 {
-    return GetMethodId(GetAndroidCanvasClass(),
-                       "clipPath",
-                       "(Landroid/graphics/Path;)Z");
+    return GetJNIEnv()->ThrowNew(g_refs.riveExceptionClass, message);
 }
-jmethodID GetCanvasWidthMethodId()
+jint ThrowMalformedFileException(const char* message)
 {
-    return GetMethodId(GetAndroidCanvasClass(), "getWidth", "()I");
+    return GetJNIEnv()->ThrowNew(g_refs.malformedFileExceptionClass, message);
 }
-jmethodID GetCanvasHeightMethodId()
+jint ThrowUnsupportedRuntimeVersionException(const char* message)
 {
-    return GetMethodId(GetAndroidCanvasClass(), "getHeight", "()I");
+    return GetJNIEnv()->ThrowNew(g_refs.unsupportedRuntimeVersionExceptionClass,
+                                 message);
 }
 
-jclass GetPorterDuffClass()
-{
-    return GetClass("android/graphics/PorterDuff$Mode");
-}
+jclass GetHashMapClass() { return g_refs.hashMapClass; }
+jmethodID GetHashMapConstructorId() { return g_refs.hashMapConstructor; }
+jmethodID GetHashMapPutMethodId() { return g_refs.hashMapPut; }
 
-jclass GetPorterDuffXferModeClass()
-{
-    return GetClass("android/graphics/PorterDuffXfermode");
-}
+jclass GetFloatClass() { return g_refs.floatClass; }
+jmethodID GetFloatConstructor() { return g_refs.floatConstructor; }
 
-jmethodID GetPorterDuffXferModeInitMethodId()
-{
-    return GetMethodId(GetPorterDuffXferModeClass(),
-                       "<init>",
-                       "(Landroid/graphics/PorterDuff$Mode;)V");
-}
-jmethodID GetSetXfermodeMethodId()
-{
-    return GetMethodId(
-        GetPaintClass(),
-        "setXfermode",
-        "(Landroid/graphics/Xfermode;)Landroid/graphics/Xfermode;");
-}
+jclass GetBooleanClass() { return g_refs.booleanClass; }
+jmethodID GetBooleanConstructor() { return g_refs.booleanConstructor; }
 
-jfieldID GetFillId()
-{
-    return GetStaticFieldId(GetStyleClass(),
-                            "FILL",
-                            "Landroid/graphics/Paint$Style;");
-}
-jfieldID GetStrokeId()
-{
-    return GetStaticFieldId(GetStyleClass(),
-                            "STROKE",
-                            "Landroid/graphics/Paint$Style;");
-}
-jfieldID GetMiterId()
-{
-    return GetStaticFieldId(GetJoinClass(),
-                            "MITER",
-                            "Landroid/graphics/Paint$Join;");
-}
-jfieldID GetRoundId()
-{
-    return GetStaticFieldId(GetJoinClass(),
-                            "ROUND",
-                            "Landroid/graphics/Paint$Join;");
-}
-jfieldID GetBevelId()
-{
-    return GetStaticFieldId(GetJoinClass(),
-                            "BEVEL",
-                            "Landroid/graphics/Paint$Join;");
-}
-jfieldID GetCapButtID()
-{
-    return GetStaticFieldId(GetCapClass(),
-                            "BUTT",
-                            "Landroid/graphics/Paint$Cap;");
-}
-jfieldID GetCapRoundId()
-{
-    return GetStaticFieldId(GetCapClass(),
-                            "ROUND",
-                            "Landroid/graphics/Paint$Cap;");
-}
-jfieldID GetCapSquareId()
-{
-    return GetStaticFieldId(GetCapClass(),
-                            "SQUARE",
-                            "Landroid/graphics/Paint$Cap;");
-}
+jclass GetShortClass() { return g_refs.shortClass; }
+jmethodID GetShortConstructor() { return g_refs.shortConstructor; }
 
-jfieldID GetEvenOddId()
-{
-    return GetStaticFieldId(GetFillTypeClass(),
-                            "EVEN_ODD",
-                            "Landroid/graphics/Path$FillType;");
-}
-jfieldID GetNonZeroId()
-{
-    return GetStaticFieldId(GetFillTypeClass(),
-                            "WINDING",
-                            "Landroid/graphics/Path$FillType;");
-}
+jclass GetFitClass() { return g_refs.fitClass; }
+jmethodID GetFitNameMethodId() { return g_refs.fitName; }
 
-jfieldID GetSrcOver()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "SRC_OVER",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetScreen()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "SCREEN",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetOverlay()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "OVERLAY",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetDarken()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "DARKEN",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetLighten()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "LIGHTEN",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetColorDodge()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "COLOR_DODGE",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetColorBurn()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "COLOR_BURN",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetHardLight()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "HARD_LIGHT",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetSoftLight()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "SOFT_LIGHT",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetDifference()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "DIFFERENCE",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetExclusion()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "EXCLUSION",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetMultiply()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "MULTIPLY",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetHue()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "HUE",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetSaturation()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "SATURATION",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetColor()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "COLOR",
-                            "Landroid/graphics/BlendMode;");
-}
-jfieldID GetLuminosity()
-{
-    return GetStaticFieldId(GetBlendModeClass(),
-                            "LUMINOSITY",
-                            "Landroid/graphics/BlendMode;");
-}
+jclass GetAlignmentClass() { return g_refs.alignmentClass; }
+jmethodID GetAlignmentNameMethodId() { return g_refs.alignmentName; }
 
-jfieldID GetPdClear()
-{
-    return GetStaticFieldId(GetPorterDuffClass(),
-                            "CLEAR",
-                            "Landroid/graphics/PorterDuff$Mode;");
-}
-jfieldID GetPdSrcOver()
-{
-    return GetStaticFieldId(GetPorterDuffClass(),
-                            "SRC_OVER",
-                            "Landroid/graphics/PorterDuff$Mode;");
-}
-jfieldID GetPdDarken()
-{
-    return GetStaticFieldId(GetPorterDuffClass(),
-                            "DARKEN",
-                            "Landroid/graphics/PorterDuff$Mode;");
-}
-jfieldID GetPdLighten()
-{
-    return GetStaticFieldId(GetPorterDuffClass(),
-                            "LIGHTEN",
-                            "Landroid/graphics/PorterDuff$Mode;");
-}
-jfieldID GetPdMultiply()
+jclass GetLoopClass() { return g_refs.loopClass; }
+jfieldID GetNoneLoopField() { return g_refs.loopNone; }
+jfieldID GetOneShotLoopField() { return g_refs.loopOneShot; }
+jfieldID GetLoopLoopField() { return g_refs.loopLoop; }
+jfieldID GetPingPongLoopField() { return g_refs.loopPingPong; }
+
+jclass GetAdvanceResultClass() { return g_refs.advanceResultClass; }
+jfieldID GetAdvanceResultAdvancedField()
 {
-    return GetStaticFieldId(GetPorterDuffClass(),
-                            "MULTIPLY",
-                            "Landroid/graphics/PorterDuff$Mode;");
+    return g_refs.advanceResultAdvanced;
 }
-jfieldID GetPdScreen()
+jfieldID GetAdvanceResultOneShotField() { return g_refs.advanceResultOneShot; }
+jfieldID GetAdvanceResultLoopField() { return g_refs.advanceResultLoop; }
+jfieldID GetAdvanceResultPingPongField()
 {
-    return GetStaticFieldId(GetPorterDuffClass(),
-                            "SCREEN",
-                            "Landroid/graphics/PorterDuff$Mode;");
+    return g_refs.advanceResultPingPong;
 }
-jfieldID GetPdOverlay()
+jfieldID GetAdvanceResultNoneField() { return g_refs.advanceResultNone; }
+
+jclass GetRiveEventReportClass() { return g_refs.riveEventReportClass; }
+jmethodID GetRiveEventReportConstructorId()
 {
-    return GetStaticFieldId(GetPorterDuffClass(),
-                            "OVERLAY",
-                            "Landroid/graphics/PorterDuff$Mode;");
+    return g_refs.riveEventReportConstructor;
 }
 
-jclass GetBitmapShaderClass()
+jclass GetPointerFClass() { return g_refs.pointFClass; }
+jfieldID GetXFieldId() { return g_refs.pointFX; }
+jfieldID GetYFieldId() { return g_refs.pointFY; }
+jmethodID GetPointFInitMethod() { return g_refs.pointFInit; }
+
+rive::AABB RectFToAABB(JNIEnv* env, jobject rectf)
 {
-    return GetClass("android/graphics/BitmapShader");
+    float values[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        values[i] = env->GetFloatField(rectf, g_refs.rectFFields[i]);
+    }
+    return {values[0], values[1], values[2], values[3]};
 }
-jmethodID GetBitmapShaderConstructor()
+
+void AABBToRectF(JNIEnv* env, const rive::AABB& aabb, jobject rectf)
 {
-    /**
-     * Kotlin signature:
-     * BitmapShader(Bitmap bitmap, Shader.TileMode tileX, Shader.TileMode tileY)
-     */
-    return GetMethodId(
-        GetBitmapShaderClass(),
-        "<init>",
-        "(Landroid/graphics/Bitmap;Landroid/graphics/Shader$TileMode;Landroid/"
-        "graphics/Shader$TileMode;)V");
+    const float values[4] = {aabb.left(),
+                             aabb.top(),
+                             aabb.right(),
+                             aabb.bottom()};
+    for (int i = 0; i < 4; ++i)
+    {
+        env->SetFloatField(rectf, g_refs.rectFFields[i], values[i]);
+    }
 }
 
-jclass GetColorMatrixClass()
+jclass GetRadialGradientClass() { return g_refs.radialGradientClass; }
+jmethodID GetRadialGradientInitMethodId() { return g_refs.radialGradientInit; }
+
+jclass GetLinearGradientClass() { return g_refs.linearGradientClass; }
+jmethodID GetLinearGradientInitMethodId() { return g_refs.linearGradientInit; }
+
+jclass GetTileModeClass() { return g_refs.tileModeClass; }
+jfieldID GetClampId() { return g_refs.tileModeClamp; }
+
+jclass GetPaintClass() { return g_refs.paintClass; }
+jmethodID GetPaintInitMethod() { return g_refs.paintInit; }
+jmethodID GetSetColorMethodId() { return g_refs.paintSetColor; }
+jmethodID GetSetAlphaMethodId() { return g_refs.paintSetAlpha; }
+jmethodID GetSetAntiAliasMethodId() { return g_refs.paintSetAntiAlias; }
+jmethodID GetSetFilterBitmapMethodId() { return g_refs.paintSetFilterBitmap; }
+jmethodID GetSetShaderMethodId() { return g_refs.paintSetShader; }
+jmethodID GetSetStyleMethodId() { return g_refs.paintSetStyle; }
+
+jclass GetStyleClass() { return g_refs.styleClass; }
+jfieldID GetFillId() { return g_refs.styleFill; }
+jfieldID GetStrokeId() { return g_refs.styleStroke; }
+
+jclass GetJoinClass() { return g_refs.joinClass; }
+jfieldID GetMiterId() { return g_refs.joinMiter; }
+jfieldID GetRoundId() { return g_refs.joinRound; }
+jfieldID GetBevelId() { return g_refs.joinBevel; }
+
+jmethodID GetSetStrokeWidthMethodId() { return g_refs.paintSetStrokeWidth; }
+jmethodID GetSetStrokeJoinMethodId() { return g_refs.paintSetStrokeJoin; }
+
+jclass GetCapClass() { return g_refs.capClass; }
+jfieldID GetCapButtID() { return g_refs.capButt; }
+jfieldID GetCapRoundId() { return g_refs.capRound; }
+jfieldID GetCapSquareId() { return g_refs.capSquare; }
+
+jmethodID GetSetStrokeCapMethodId() { return g_refs.paintSetStrokeCap; }
+
+jclass GetBlendModeClass() { return g_refs.blendModeClass; }
+jfieldID GetSrcOver() { return g_refs.blendSrcOver; }
+jfieldID GetScreen() { return g_refs.blendScreen; }
+jfieldID GetOverlay() { return g_refs.blendOverlay; }
+jfieldID GetDarken() { return g_refs.blendDarken; }
+jfieldID GetLighten() { return g_refs.blendLighten; }
+jfieldID GetColorDodge() { return g_refs.blendColorDodge; }
+jfieldID GetColorBurn() { return g_refs.blendColorBurn; }
+jfieldID GetHardLight() { return g_refs.blendHardLight; }
+jfieldID GetSoftLight() { return g_refs.blendSoftLight; }
+jfieldID GetDifference() { return g_refs.blendDifference; }
+jfieldID GetExclusion() { return g_refs.blendExclusion; }
+jfieldID GetMultiply() { return g_refs.blendMultiply; }
+jfieldID GetHue() { return g_refs.blendHue; }
+jfieldID GetSaturation() { return g_refs.blendSaturation; }
+jfieldID GetColor() { return g_refs.blendColor; }
+jfieldID GetLuminosity() { return g_refs.blendLuminosity; }
+jmethodID GetSetBlendModeMethodId() { return g_refs.paintSetBlendMode; }
+
+jclass GetPathClass() { return g_refs.pathClass; }
+jmethodID GetPathInitMethodId() { return g_refs.pathInit; }
+jmethodID GetResetMethodId() { return g_refs.pathReset; }
+jmethodID GetSetFillTypeMethodId() { return g_refs.pathSetFillType; }
+
+jclass GetFillTypeClass() { return g_refs.fillTypeClass; }
+jfieldID GetEvenOddId() { return g_refs.fillTypeEvenOdd; }
+jfieldID GetNonZeroId() { return g_refs.fillTypeNonZero; }
+
+jclass GetMatrixClass() { return g_refs.matrixClass; }
+jmethodID GetMatrixInitMethodId() { return g_refs.matrixInit; }
+jmethodID GetMatrixSetValuesMethodId() { return g_refs.matrixSetValues; }
+jmethodID GetAddPathMethodId() { return g_refs.pathAddPath; }
+jmethodID GetMoveToMethodId() { return g_refs.pathMoveTo; }
+jmethodID GetLineToMethodId() { return g_refs.pathLineTo; }
+jmethodID GetCubicToMethodId() { return g_refs.pathCubicTo; }
+jmethodID GetCloseMethodId() { return g_refs.pathClose; }
+
+jclass GetAndroidSurfaceClass() { return g_refs.surfaceClass; }
+jmethodID GetSurfaceLockCanvasMethodId() { return g_refs.surfaceLockCanvas; }
+jmethodID GetSurfaceUnlockCanvasAndPostMethodId()
 {
-    return GetClass("android/graphics/ColorMatrix");
+    return g_refs.surfaceUnlockCanvasAndPost;
 }
-jmethodID GetColorMatrixInitMethodId()
+
+jclass GetAndroidCanvasClass() { return g_refs.canvasClass; }
+jclass GetAndroidCanvasVertexModeClass()
 {
-    return GetMethodId(GetColorMatrixClass(), "<init>", "()V");
-}
-jmethodID GetColorMatrixSetMethodId()
+    return g_refs.canvasVertexModeClass;
+}
+jmethodID GetCanvasSaveMethodId() { return g_refs.canvasSave; }
+jmethodID GetCanvasRestoreMethodId() { return g_refs.canvasRestore; }
+jmethodID GetCanvasConcatMatrixMethodId() { return g_refs.canvasConcat; }
+jmethodID GetCanvasDrawPathMethodId() { return g_refs.canvasDrawPath; }
+jmethodID GetCanvasDrawColorMethodId() { return g_refs.canvasDrawColor; }
+jmethodID GetCanvasDrawBitmapMethodId() { return g_refs.canvasDrawBitmap; }
+jmethodID GetCanvasDrawVerticesMethodId() { return g_refs.canvasDrawVertices; }
+jfieldID GetVertexModeTrianglesId() { return g_refs.vertexModeTriangles; }
+jmethodID GetCanvasClipPathMethodId() { return g_refs.canvasClipPath; }
+jmethodID GetCanvasWidthMethodId() { return g_refs.canvasGetWidth; }
+jmethodID GetCanvasHeightMethodId() { return g_refs.canvasGetHeight; }
+
+jclass GetPorterDuffClass() { return g_refs.porterDuffModeClass; }
+jclass GetPorterDuffXferModeClass() { return g_refs.porterDuffXfermodeClass; }
+jmethodID GetPorterDuffXferModeInitMethodId()
 {
-    /** Kotlin signature: void set(float[] src) */
-    return GetMethodId(GetColorMatrixClass(), "set", "([F)V");
+    return g_refs.porterDuffXfermodeInit;
 }
+jmethodID GetSetXfermodeMethodId() { return g_refs.paintSetXfermode; }
+
+jfieldID GetPdClear() { return g_refs.pdClear; }
+jfieldID GetPdSrcOver() { return g_refs.pdSrcOver; }
+jfieldID GetPdDarken() { return g_refs.pdDarken; }
+jfieldID GetPdLighten() { return g_refs.pdLighten; }
+jfieldID GetPdMultiply() { return g_refs.pdMultiply; }
+jfieldID GetPdScreen() { return g_refs.pdScreen; }
+jfieldID GetPdOverlay() { return g_refs.pdOverlay; }
+
+jclass GetBitmapShaderClass() { return g_refs.bitmapShaderClass; }
+jmethodID GetBitmapShaderConstructor() { return g_refs.bitmapShaderInit; }
+
+jclass GetColorMatrixClass() { return g_refs.colorMatrixClass; }
+jmethodID GetColorMatrixInitMethodId() { return g_refs.colorMatrixInit; }
+jmethodID GetColorMatrixSetMethodId() { return g_refs.colorMatrixSet; }
 jclass GetColorMatrixColorFilterClass()
 {
-    return GetClass("android/graphics/ColorMatrixColorFilter");
+    return g_refs.colorMatrixColorFilterClass;
 }
 jmethodID GetColorMatrixColorFilterInitMethodId()
 {
-    /**
-     * Kotlin signature:
-     * ColorMatrixColorFilter(ColorMatrix matrix)
-     */
-    return GetMethodId(GetColorMatrixColorFilterClass(),
-                       "<init>",
-                       "(Landroid/graphics/ColorMatrix;)V");
-}
-jmethodID GetSetColorFilterMethodId()
-{
-    /**
-     * Kotlin signature:
-     * ColorFilter setColorFilter(ColorFilter filter)
-     */
-    return GetMethodId(
-        GetPaintClass(),
-        "setColorFilter",
-        "(Landroid/graphics/ColorFilter;)Landroid/graphics/ColorFilter;");
+    return g_refs.colorMatrixColorFilterInit;
 }
+jmethodID GetSetColorFilterMethodId() { return g_refs.paintSetColorFilter; }
 
-jclass GetAndroidBitmapClass() { return GetClass("android/graphics/Bitmap"); }
-jclass GetAndroidBitmapConfigClass()
-{
-    return GetClass("android/graphics/Bitmap$Config");
-}
-jclass GetAndroidBitmapFactoryClass()
-{
-    return GetClass("android/graphics/BitmapFactory");
-}
-jmethodID GetCreateBitmapStaticMethodId()
-{
-    /**
-     * Kotlin signature:
-     * static Bitmap createBitmap (int width,
-     *  int height,
-     *  Bitmap.Config config)
-     */
-    return GetStaticMethodId(
-        GetAndroidBitmapClass(),
-        "createBitmap",
-        "(IILandroid/graphics/Bitmap$Config;)Landroid/graphics/Bitmap;");
-}
+jclass GetAndroidBitmapClass() { return g_refs.bitmapClass; }
+jclass GetAndroidBitmapConfigClass() { return g_refs.bitmapConfigClass; }
+jclass GetAndroidBitmapFactoryClass() { return g_refs.bitmapFactoryClass; }
+jmethodID GetCreateBitmapStaticMethodId() { return g_refs.bitmapCreateBitmap; }
 jmethodID GetDecodeByteArrayStaticMethodId()
 {
-    /**
-     * Kotlin signature:
-     * static Bitmap decodeByteArray (byte[] data,
-     *   int offset,
-     *   int length)
-     */
-    return GetStaticMethodId(GetAndroidBitmapFactoryClass(),
-                             "decodeByteArray",
-                             "([BII)Landroid/graphics/Bitmap;");
-}
-jmethodID GetBitmapWidthMethodId()
-{
-    /** Kotlin signature: int getWidth () */
-    return GetMethodId(GetAndroidBitmapClass(), "getWidth", "()I");
-}
-jmethodID GetBitmapHeightMethodId()
-{
-    /** Kotlin signature: int getHeight () */
-    return GetMethodId(GetAndroidBitmapClass(), "getHeight", "()I");
-}
-jfieldID GetARGB8888Field()
-{
-    return GetStaticFieldId(GetAndroidBitmapConfigClass(),
-                            "ARGB_8888",
-                            "Landroid/graphics/Bitmap$Config;");
-}
-
-jmethodID GetBitmapSetPixelsMethodId()
-{
-    // void setPixels (int[] pixels, int offset, int stride, int x, int y, int
-    // width, int height)
-    return GetMethodId(GetAndroidBitmapClass(), "setPixels", "([IIIIIII)V");
+    return g_refs.bitmapFactoryDecodeByteArray;
 }
+jmethodID GetBitmapWidthMethodId() { return g_refs.bitmapGetWidth; }
+jmethodID GetBitmapHeightMethodId() { return g_refs.bitmapGetHeight; }
+jfieldID GetARGB8888Field() { return g_refs.bitmapConfigARGB8888; }
+jmethodID GetBitmapSetPixelsMethodId() { return g_refs.bitmapSetPixels; }
 
 } // namespace rive_android
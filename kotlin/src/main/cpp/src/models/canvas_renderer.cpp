@@ -56,7 +56,6 @@ void CanvasRenderer::transform(const rive::Mat2D& transform)
                                         GetCanvasConcatMatrixMethodId(),
                                         matrix);
 
-    env->DeleteLocalRef(matrixClass);
     env->DeleteLocalRef(matrixArray);
     env->DeleteLocalRef(matrix);
 }
@@ -104,10 +103,8 @@ static void ApplyOpacityColorFilter(JNIEnv* env, jobject ktPaint, float opacity)
 
     env->CallObjectMethod(ktPaint, GetSetColorFilterMethodId(), ktColorFilter);
 
-    env->DeleteLocalRef(colorFilterClass);
     env->DeleteLocalRef(matrixArray);
     env->DeleteLocalRef(ktColorMatrix);
-    env->DeleteLocalRef(colorMatrixClass);
     env->DeleteLocalRef(ktColorFilter);
 }
 
@@ -202,7 +199,6 @@ void CanvasRenderer::drawImageMesh(const rive::RenderImage* image,
     jclass vertexModeClass = GetAndroidCanvasVertexModeClass();
     jobject trianglesMode =
         env->GetStaticObjectField(vertexModeClass, GetVertexModeTrianglesId());
-    env->DeleteLocalRef(vertexModeClass);
 
     /** Set up the vertices */
     const float* vertices =
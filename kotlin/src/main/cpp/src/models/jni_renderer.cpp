@@ -1,6 +1,7 @@
 #include "models/jni_renderer.hpp"
 
 #include <algorithm>
+#include <utility>
 
 #include "helpers/jni_exception_handler.hpp"
 #include "helpers/jni_resource.hpp"
@@ -13,6 +14,38 @@ namespace rive_android
 {
 constexpr auto* TAG = "RiveLN/JNIRenderer";
 
+namespace
+{
+// Captured by frame work to balance `m_numScheduledFrames++`. The counter
+// tracks queued frame work, not draw success, so it is decremented when the
+// work is destroyed: after it runs (including early returns), or when it is
+// dropped for missing its deadline.
+class ScheduledFrame
+{
+public:
+    explicit ScheduledFrame(std::atomic_uint8_t* counter) : m_counter(counter)
+    {
+        (*m_counter)++;
+    }
+    ScheduledFrame(ScheduledFrame&& other) noexcept :
+        m_counter(std::exchange(other.m_counter, nullptr))
+    {}
+    ScheduledFrame(const ScheduledFrame&) = delete;
+    ScheduledFrame& operator=(const ScheduledFrame&) = delete;
+    ScheduledFrame& operator=(ScheduledFrame&&) = delete;
+    ~ScheduledFrame()
+    {
+        if (m_counter != nullptr)
+        {
+            (*m_counter)--;
+        }
+    }
+
+private:
+    std::atomic_uint8_t* m_counter;
+};
+} // namespace
+
 JNIRenderer::JNIRenderer(
     jobject ktRenderer,
     bool trace /* = false */,
@@ -177,67 +210,73 @@ void JNIRenderer::doFrame()
         return;
     }
 
-    if (m_numScheduledFrames >= kMaxScheduledFrames)
+    const auto tick = m_framePacer.onTick(
+        m_numScheduledFrames.load(std::memory_order_relaxed));
+    if (tick.decision != FramePacer::Decision::Schedule)
     {
-        auto numScheduled =
-            m_numScheduledFrames.load(std::memory_order_relaxed);
-        RiveLogV(
-            TAG,
-            "Main thread: doFrame() called too many times in a row; skipping. (Scheduled: %d vs. Max: %d)",
-            numScheduled,
-            kMaxScheduledFrames);
+        RiveLogV(TAG,
+                 "Main thread: doFrame() %s; skipping.",
+                 tick.decision == FramePacer::Decision::Drop
+                     ? "called with the worker full"
+                     : "paced to a lower rate");
         return;
     }
 
-    m_worker->run([this](DrawableThreadState* threadState) {
-        // RAII guard that balances `m_numScheduledFrames++` from the caller
-        // path. The counter tracks queued frame work, not draw success, so it
-        // must be decremented on every exit path (including early returns).
-        struct FrameCountGuard
-        {
-            std::atomic_uint8_t& counter;
-            ~FrameCountGuard() { counter--; }
-        } frameCountGuard{m_numScheduledFrames};
-
-        auto now = std::chrono::steady_clock::now();
-
-        if (isRecovering())
-        {
-            // In recovering mode, normal draw/flush is suspended. Use this
-            // frame tick to drive one recovery attempt instead.
-            attemptRecovery(threadState, now);
-            return;
-        }
+    // A frame that can't start by its deadline is stale; dropping it lets the
+    // next one draw the current state instead.
+    const auto requestedAt = std::chrono::steady_clock::now();
+    const auto deadline = requestedAt + kFrameDeadline;
+    m_worker->run(
+        [this,
+         frame = ScheduledFrame(&m_numScheduledFrames),
+         presentDeadline = tick.presentDeadline,
+         requestedAt](DrawableThreadState* threadState) {
+            auto now = m_framePacer.now();
+
+            if (isRecovering())
+            {
+                // In recovering mode, normal draw/flush is suspended. Use this
+                // frame tick to drive one recovery attempt instead.
+                attemptRecovery(threadState, now);
+                return;
+            }
 
-        if (!m_workerImpl)
-        {
-            RiveLogW(TAG,
-                     "Worker thread: doFrame() called before setSurface()");
-            return;
-        }
+            if (!m_workerImpl)
+            {
+                RiveLogW(TAG,
+                         "Worker thread: doFrame() called before setSurface()");
+                return;
+            }
 
-        auto frameResult = m_workerImpl->doFrame(m_tracer.get(),
-                                                 threadState,
-                                                 m_ktRenderer,
-                                                 now);
-        if (!frameResult.eglResult.isSuccess())
-        {
-            RiveLogW(TAG,
-                     "Frame aborted due to EGL error: %s",
-                     frameResult.eglResult.summary().c_str());
-            if (frameResult.eglResult.isFatal())
+            auto frameResult = m_workerImpl->doFrame(m_tracer.get(),
+                                                     threadState,
+                                                     m_ktRenderer,
+                                                     now);
+            if (!frameResult.eglResult.isSuccess())
             {
-                enterRecoveringState(threadState, frameResult.eglResult, now);
+                RiveLogW(TAG,
+                         "Frame aborted due to EGL error: %s",
+                         frameResult.eglResult.summary().c_str());
+                if (frameResult.eglResult.isFatal())
+                {
+                    enterRecoveringState(threadState,
+                                         frameResult.eglResult,
+                                         now);
+                }
+                return;
             }
-            return;
-        }
 
-        if (frameResult.didDraw)
-        {
-            calculateFps(now);
-        }
-    });
-    m_numScheduledFrames++;
+            if (frameResult.didDraw)
+            {
+                auto timings = frameResult.timings;
+                timings.queueWaitNanos = FrameRecord::Nanos(now - requestedAt);
+                m_frameStats.add(timings);
+                m_framePacer.onFrameFinished(now, presentDeadline);
+                calculateFps(now);
+            }
+        },
+        WorkLane::Frame,
+        deadline);
 }
 
 void JNIRenderer::notifyRenderContextEvent(int eventType,
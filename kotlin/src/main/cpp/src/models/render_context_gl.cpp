@@ -1,6 +1,5 @@
 #include <GLES3/gl3.h>
 #include <cstring>
-#include <vector>
 
 #include "helpers/egl_error.hpp"
 #include "helpers/rive_log.hpp"
@@ -14,6 +13,9 @@ namespace rive_android
 {
 namespace
 {
+// How long completeReadbacks(true) waits on one read before failing it.
+constexpr GLuint64 READBACK_TIMEOUT_NANOS = 5'000'000'000;
+
 std::string errorString(int32_t errorCode)
 {
     return EGLErrorString(static_cast<EGLint>(errorCode));
@@ -99,6 +101,8 @@ StartupResult RenderContextGL::initialize()
 
 void RenderContextGL::destroy()
 {
+    releaseReadbacks();
+
     RiveLogD(TAG_RC, "Releasing EGL context and surface bindings");
 
     eglMakeCurrent(eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
@@ -192,6 +196,16 @@ bool RenderContextGL::present(RenderSurface* surface)
 {
     auto* glSurface = static_cast<RenderSurfaceGL*>(surface);
     auto eglSurface = glSurface->eglSurface();
+    // A pipelined frame is presented during its surface's next draw, which
+    // may come after draws to other surfaces made those current.
+    if (eglGetCurrentSurface(EGL_DRAW) != eglSurface &&
+        !eglMakeCurrent(eglDisplay, eglSurface, eglSurface, eglContext))
+    {
+        RiveLogE(TAG_RC,
+                 "Failed to make EGL context current for present. Error: %s",
+                 errorString(eglGetError()).c_str());
+        return false;
+    }
     if (!eglSwapBuffers(eglDisplay, eglSurface))
     {
         RiveLogE(TAG_RC,
@@ -207,8 +221,10 @@ bool RenderContextGL::readPixels(RenderSurface*,
                                  uint32_t height,
                                  uint8_t* pixels)
 {
+    // Reading into client memory waits for the draw, so there's no need to
+    // glFinish() first. The draw was flipped (see readsBottomUp()), so the
+    // rows arrive top first.
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glFinish();
     glPixelStorei(GL_PACK_ALIGNMENT, 1);
     glReadPixels(0,
                  0,
@@ -217,19 +233,155 @@ bool RenderContextGL::readPixels(RenderSurface*,
                  GL_RGBA,
                  GL_UNSIGNED_BYTE,
                  pixels);
+    return true;
+}
+
+void RenderContextGL::readPixelsAsync(RenderSurface*,
+                                      uint32_t width,
+                                      uint32_t height,
+                                      uint8_t* destination,
+                                      ReadPixelsCallback callback)
+{
+    // Complete whatever has finished, then, if the ring is full, wait for the
+    // oldest read, which is in the slot about to be reused.
+    completeReadbacks(false);
+    auto& readback = m_readbacks[m_nextReadback];
+    completeReadback(readback, true);
+    m_nextReadback = (m_nextReadback + 1) % kReadbackBuffers;
+
+    readback.size = static_cast<size_t>(width) * height * 4;
+    if (readback.buffer == 0)
+    {
+        glGenBuffers(1, &readback.buffer);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+    if (readback.capacity < readback.size)
+    {
+        glBufferData(GL_PIXEL_PACK_BUFFER,
+                     static_cast<GLsizeiptr>(readback.size),
+                     nullptr,
+                     GL_STREAM_READ);
+        readback.capacity = readback.size;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    // With a pack buffer bound, this queues a copy into it and returns.
+    glReadPixels(0,
+                 0,
+                 static_cast<GLsizei>(width),
+                 static_cast<GLsizei>(height),
+                 GL_RGBA,
+                 GL_UNSIGNED_BYTE,
+                 nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
-    auto rowBytes = static_cast<size_t>(width) * 4;
-    std::vector<uint8_t> row(rowBytes);
-    auto* data = pixels;
-    for (uint32_t y = 0; y < height / 2; ++y)
+    readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (readback.fence == nullptr)
     {
-        auto* top = data + (static_cast<size_t>(y) * rowBytes);
-        auto* bottom = data + (static_cast<size_t>(height - 1 - y) * rowBytes);
-        std::memcpy(row.data(), top, rowBytes);
-        std::memcpy(top, bottom, rowBytes);
-        std::memcpy(bottom, row.data(), rowBytes);
+        RiveLogE(TAG_RC, "Failed to fence a pixel buffer read");
+        callback(nullptr);
+        return;
     }
+    // Submit the draw and the copy now rather than at the next frame.
+    glFlush();
+    readback.destination = destination;
+    readback.callback = std::move(callback);
+}
+
+void RenderContextGL::completeReadbacks(bool wait)
+{
+    // Oldest first, stopping at the first unfinished read so callbacks stay
+    // in order.
+    for (size_t i = 0; i < kReadbackBuffers; i++)
+    {
+        auto& readback =
+            m_readbacks[(m_nextReadback + i) % kReadbackBuffers];
+        if (!completeReadback(readback, wait))
+        {
+            return;
+        }
+    }
+}
+
+bool RenderContextGL::completeReadback(Readback& readback, bool wait)
+{
+    if (readback.fence == nullptr)
+    {
+        return true;
+    }
+    auto status = glClientWaitSync(readback.fence,
+                                   GL_SYNC_FLUSH_COMMANDS_BIT,
+                                   wait ? READBACK_TIMEOUT_NANOS : 0);
+    if (status == GL_TIMEOUT_EXPIRED && !wait)
+    {
+        return false;
+    }
+    glDeleteSync(readback.fence);
+    readback.fence = nullptr;
+    auto callback = std::move(readback.callback);
+    readback.callback = nullptr;
+    auto* destination = readback.destination;
+    readback.destination = nullptr;
+
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+    {
+        RiveLogE(TAG_RC,
+                 "Failed waiting for a pixel buffer read (status: 0x%x)",
+                 status);
+        callback(nullptr);
+        return true;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+    auto* pixels = static_cast<const uint8_t*>(
+        glMapBufferRange(GL_PIXEL_PACK_BUFFER,
+                         0,
+                         static_cast<GLsizeiptr>(readback.size),
+                         GL_MAP_READ_BIT));
+    if (pixels == nullptr)
+    {
+        RiveLogE(TAG_RC, "Failed to map a pixel buffer");
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        callback(nullptr);
+        return true;
+    }
+    if (destination != nullptr)
+    {
+        std::memcpy(destination, pixels, readback.size);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        callback(destination);
+        return true;
+    }
+    callback(pixels);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
     return true;
 }
 
+void RenderContextGL::releaseReadbacks()
+{
+    bool hasBuffers = false;
+    for (const auto& readback : m_readbacks)
+    {
+        hasBuffers |= readback.buffer != 0;
+    }
+    if (!hasBuffers)
+    {
+        return;
+    }
+    // The surface last drawn to may already be gone.
+    if (eglGetCurrentContext() != eglContext)
+    {
+        eglMakeCurrent(eglDisplay, pBuffer, pBuffer, eglContext);
+    }
+    RiveLogD(TAG_RC, "Completing pixel buffer reads");
+    completeReadbacks(true);
+    for (auto& readback : m_readbacks)
+    {
+        glDeleteBuffers(1, &readback.buffer);
+        readback = {};
+    }
+    m_nextReadback = 0;
+}
+
 } // namespace rive_android
@@ -54,7 +54,53 @@ void RenderSurface::resize(uint32_t requestedWidth, uint32_t requestedHeight)
     resetRenderTarget();
 }
 
-void RenderSurface::resetRenderTarget() { m_renderTarget.reset(); }
+void RenderSurface::resetRenderTarget()
+{
+    m_renderTarget.reset();
+    m_targetGeneration++;
+    m_hasPendingPresent = false;
+}
+
+void RenderSurface::deferPresent(
+    FramePipelineStats::Clock::time_point flushedAt)
+{
+    m_hasPendingPresent = true;
+    m_pendingFlushedAt = flushedAt;
+}
+
+FramePipelineStats::Clock::time_point RenderSurface::takePendingPresent()
+{
+    m_hasPendingPresent = false;
+    return m_pendingFlushedAt;
+}
+
+static uint64_t Nanos(FramePipelineStats::Clock::duration duration)
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+            .count());
+}
+
+void FramePipelineStats::addFrame(bool pipelined, Clock::duration drawTime)
+{
+    auto& frames = pipelined ? pipelinedFrames : directFrames;
+    auto& nanos = pipelined ? pipelinedDrawNanos : directDrawNanos;
+    frames.fetch_add(1, std::memory_order_relaxed);
+    nanos.fetch_add(Nanos(drawTime), std::memory_order_relaxed);
+}
+
+void FramePipelineStats::addPresent(Clock::duration blockedTime)
+{
+    presents.fetch_add(1, std::memory_order_relaxed);
+    presentNanos.fetch_add(Nanos(blockedTime), std::memory_order_relaxed);
+}
+
+void FramePipelineStats::addDeferredPresent(Clock::duration addedLatency)
+{
+    deferredPresents.fetch_add(1, std::memory_order_relaxed);
+    addedLatencyNanos.fetch_add(Nanos(addedLatency),
+                                std::memory_order_relaxed);
+}
 
 void RenderSurface::RenderTargetUnref::operator()(
     rive::gpu::RenderTarget* renderTarget) const
@@ -110,12 +110,23 @@ WorkerFrameResult WorkerImpl::doFrame(
     auto env = GetJNIEnv();
     tracer->beginSection("Rive/Frame");
 
+    using Clock = std::chrono::steady_clock;
+    auto& timings = result.timings;
+    auto stageStart = Clock::now();
+    // Records the time since the last stage ended into `stageNanos`.
+    auto endStage = [&stageStart](int64_t& stageNanos) {
+        const auto now = Clock::now();
+        stageNanos = FrameRecord::Nanos(now - stageStart);
+        stageStart = now;
+    };
+
     tracer->beginSection("Rive/Frame/Advance");
     JNIExceptionHandler::CallVoidMethod(env,
                                         ktRenderer,
                                         m_ktAdvanceCallback,
                                         fElapsedMs);
     tracer->endSection(); // Rive/Frame/Advance
+    endStage(timings.advanceNanos);
 
     tracer->beginSection("Rive/Frame/Draw");
 
@@ -134,14 +145,17 @@ WorkerFrameResult WorkerImpl::doFrame(
     // Kotlin callback.
     JNIExceptionHandler::CallVoidMethod(env, ktRenderer, m_ktDrawCallback);
     tracer->endSection(); // Rive/Frame/Draw/Render
+    endStage(timings.drawNanos);
 
     tracer->beginSection("Rive/Frame/Draw/Flush");
     flush(threadState);
     tracer->endSection(); // Rive/Frame/Draw/Flush
+    endStage(timings.flushNanos);
 
     tracer->beginSection("Rive/Frame/Draw/Present");
     EGLResult swapResult = threadState->swapBuffers();
     tracer->endSection(); // Rive/Frame/Draw/Present
+    endStage(timings.presentNanos);
     tracer->endSection(); // Rive/Frame/Draw
     tracer->endSection(); // Rive/Frame
     if (!swapResult.isSuccess())
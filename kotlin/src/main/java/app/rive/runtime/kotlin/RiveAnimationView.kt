@@ -2,6 +2,7 @@ package app.rive.runtime.kotlin
 
 import android.annotation.TargetApi
 import android.content.Context
+import android.content.res.Resources
 import android.graphics.RectF
 import android.graphics.SurfaceTexture
 import android.os.Build
@@ -480,20 +481,43 @@ open class RiveAnimationView(context: Context, attrs: AttributeSet? = null) :
 
             is ResourceType.ResourceId -> {
                 RiveLog.d(TAG) { "Loading Rive file from resource ID: ${resource.id}" }
-                resources.openRawResource(resource.id).use {
-                    val file = File(
-                        bytes = it.readBytes(),
-                        rendererType = rendererAttributes.rendererType,
-                        fileAssetLoader = rendererAttributes.assetLoader,
-                    )
-                    onComplete(file)
-                    // Don't retain the handle.
-                    file.release()
-                }
+                val file = importRawResource(resource.id)
+                onComplete(file)
+                // Don't retain the handle.
+                file.release()
             }
         }
     }
 
+    /**
+     * Imports a raw resource, mapping it in place when it is stored uncompressed in the APK so the
+     * file is never read into a byte array. Compressed resources cannot be opened as a file
+     * descriptor and are read into memory instead.
+     */
+    private fun importRawResource(@RawRes id: Int): File {
+        val assetFileDescriptor = try {
+            resources.openRawResourceFd(id)
+        } catch (_: Resources.NotFoundException) {
+            null // Compressed; a missing resource is reported by the fallback below.
+        }
+        assetFileDescriptor?.use {
+            return File(
+                fileDescriptor = it.parcelFileDescriptor,
+                offset = it.startOffset,
+                length = it.length,
+                rendererType = rendererAttributes.rendererType,
+                fileAssetLoader = rendererAttributes.assetLoader,
+            )
+        }
+        return resources.openRawResource(id).use {
+            File(
+                bytes = it.readBytes(),
+                rendererType = rendererAttributes.rendererType,
+                fileAssetLoader = rendererAttributes.assetLoader,
+            )
+        }
+    }
+
     private fun loadFromNetwork(url: String, onComplete: (File) -> Unit) {
         RiveLog.d(TAG) { "Loading Rive file from network: $url" }
         val queue = Volley.newRequestQueue(context.applicationContext)
@@ -1,5 +1,6 @@
 package app.rive.runtime.kotlin.core
 
+import android.os.ParcelFileDescriptor
 import androidx.annotation.OpenForTesting
 import androidx.annotation.VisibleForTesting
 import app.rive.runtime.kotlin.core.errors.ArtboardException
@@ -22,22 +23,72 @@ import java.util.concurrent.locks.ReentrantLock
  *
  * The Rive editor will always export your file in the latest runtime format.
  *
- * ⚠️ Important: If you create a [File] yourself using this constructor, you are responsible for
- * calling [release] when you are done with it, otherwise it will leak memory.
+ * ⚠️ Important: If you create a [File] yourself using one of its constructors, you are responsible
+ * for calling [release] when you are done with it, otherwise it will leak memory.
+ *
+ * Large files can instead be read in place from a [ParcelFileDescriptor], which avoids holding a
+ * copy of the whole file on the Java heap during import.
  *
- * @param bytes The bytes of the .riv file.
  * @param rendererType The [RendererType] to use when rendering this file. This defaults to
  *    [Rive.defaultRendererType], which is [RendererType.Rive].
  * @param fileAssetLoader An optional [FileAssetLoader] to use when loading external assets (images,
  *    fonts, audio) referenced by this file. If it is not provided you will not be able to load
  *    external assets.
+ * @param importFile Imports the file natively, given the renderer type value and the asset loader
+ *    pointer, and returns the native file pointer.
  */
 @OpenForTesting
-class File(
-    bytes: ByteArray,
-    val rendererType: RendererType = Rive.defaultRendererType,
-    fileAssetLoader: FileAssetLoader? = null,
+class File private constructor(
+    val rendererType: RendererType,
+    fileAssetLoader: FileAssetLoader?,
+    importFile: File.(rendererType: Int, fileAssetLoaderPointer: Long) -> Long,
 ) : NativeObject(NULL_POINTER) {
+    /**
+     * Imports a file from its bytes.
+     *
+     * @param bytes The bytes of the .riv file.
+     * @param rendererType The [RendererType] to use when rendering this file.
+     * @param fileAssetLoader An optional [FileAssetLoader] for assets referenced by this file.
+     */
+    constructor(
+        bytes: ByteArray,
+        rendererType: RendererType = Rive.defaultRendererType,
+        fileAssetLoader: FileAssetLoader? = null,
+    ) : this(rendererType, fileAssetLoader, { type, loaderPointer ->
+        import(bytes, bytes.size, type, loaderPointer)
+    })
+
+    /**
+     * Imports a file by memory mapping a region of a file descriptor, for example one opened with
+     * [ParcelFileDescriptor.open] for a path, or from [android.content.res.AssetFileDescriptor] for
+     * an uncompressed asset.
+     *
+     * The file is parsed directly from the mapping, so it is never read into a byte array. The
+     * mapping is released once the import returns.
+     *
+     * @param fileDescriptor The file to read. It remains owned by the caller and may be closed once
+     *    the constructor returns.
+     * @param offset The offset of the .riv file within [fileDescriptor], in bytes.
+     * @param length The length of the .riv file in bytes. Defaults to the rest of the file.
+     * @param rendererType The [RendererType] to use when rendering this file.
+     * @param fileAssetLoader An optional [FileAssetLoader] for assets referenced by this file.
+     * @throws IllegalArgumentException If [offset] is negative or [length] is not positive or does
+     *    not fit in an [Int].
+     * @throws RiveException If the file cannot be mapped or imported.
+     */
+    @Throws(IllegalArgumentException::class, RiveException::class)
+    constructor(
+        fileDescriptor: ParcelFileDescriptor,
+        offset: Long = 0L,
+        length: Long = fileDescriptor.statSize - offset,
+        rendererType: RendererType = Rive.defaultRendererType,
+        fileAssetLoader: FileAssetLoader? = null,
+    ) : this(rendererType, fileAssetLoader, { type, loaderPointer ->
+        require(offset >= 0L) { "File offset must not be negative: $offset" }
+        require(length in 1..Int.MAX_VALUE) { "File length out of range: $length" }
+        importFd(fileDescriptor.fd, offset, length, type, loaderPointer)
+    })
+
     init {
         // Set the correct renderer type and make sure we make this a dependency.
         // In fact, when importing a file, the FileAssetLoader rcp is incremented and Kotlin
@@ -48,12 +99,7 @@ class File(
             dependencies.add(it)
         }
 
-        cppPointer = import(
-            bytes,
-            bytes.size,
-            rendererType.value,
-            fileAssetLoader?.cppPointer ?: NULL_POINTER
-        )
+        cppPointer = importFile(rendererType.value, fileAssetLoader?.cppPointer ?: NULL_POINTER)
         refs.incrementAndGet()
     }
 
@@ -83,6 +129,14 @@ class File(
         fileAssetLoaderPointer: Long,
     ): Long
 
+    private external fun importFd(
+        fd: Int,
+        offset: Long,
+        length: Long,
+        rendererType: Int,
+        fileAssetLoaderPointer: Long,
+    ): Long
+
     private external fun cppArtboardByName(cppPointer: Long, name: String): Long
 
     @Suppress("ProtectedInFinal")
@@ -1,5 +1,6 @@
 package app.rive.runtime.kotlin.core
 
+import dalvik.annotation.optimization.FastNative
 import java.util.concurrent.locks.ReentrantLock
 
 /**
@@ -17,10 +18,13 @@ class LinearAnimationInstance(
 ) :
     PlayableInstance, NativeObject(unsafeCppPointer) {
 
+    @FastNative
     private external fun cppAdvance(pointer: Long, elapsedTime: Float): Loop?
     private external fun cppAdvanceAndGetResult(pointer: Long, elapsedTime: Float): AdvanceResult
     private external fun cppApply(pointer: Long, mix: Float)
+    @FastNative
     private external fun cppGetTime(pointer: Long): Float
+    @FastNative
     private external fun cppSetTime(pointer: Long, time: Float)
     private external fun cppGetDirection(pointer: Long): Int
     private external fun cppSetDirection(pointer: Long, int: Int)
@@ -0,0 +1,211 @@
+package app.rive.runtime.kotlin.core
+
+import dalvik.annotation.optimization.FastNative
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
+/**
+ * A reusable, native-owned buffer of the events a [StateMachineInstance] reported in its last
+ * advance, filled with [StateMachineInstance.readReportedEvents].
+ *
+ * Unlike [StateMachineInstance.eventsReported], which creates a [RiveEvent] and a properties map
+ * with boxed values for every event, reading into this buffer is a single native call that does
+ * not allocate once the buffer has grown to fit. Fields are decoded only when accessed, so e.g.
+ * checking [type] or [delay] never creates a string.
+ *
+ * Events are addressed by index, from `0` until [size], and their custom properties by index from
+ * `0` until [propertyCount]. Values are only valid until the next read.
+ *
+ * Intended to be kept as a member and reused for every advance. Call [release] when done to free
+ * the native buffer.
+ *
+ * Not thread-safe. Read and decode from one thread.
+ */
+class ReportedEvents : NativeObject(NULL_POINTER) {
+    internal companion object {
+        // Values must match EventReportBuffer::PropertyTag in event_report_buffer.hpp.
+        const val PROPERTY_BOOLEAN: Byte = 0
+        const val PROPERTY_NUMBER: Byte = 1
+        const val PROPERTY_STRING: Byte = 2
+
+        /** Open URL targets, indexed by their value in the Rive file. */
+        private val TARGETS = arrayOf("_blank", "_parent", "_self", "_top")
+
+        /** The offset of the name within an event record: its type and delay. */
+        private const val NAME_OFFSET = Short.SIZE_BYTES + Float.SIZE_BYTES
+    }
+
+    /** The type of a custom property on a reported event. */
+    enum class PropertyType { Boolean, Number, String }
+
+    init {
+        // Make the corresponding C++ object.
+        cppPointer = constructor()
+        refs.incrementAndGet()
+    }
+
+    /* C++ constructor */
+    private external fun constructor(): Long
+
+    external override fun cppDelete(pointer: Long)
+
+    @FastNative
+    private external fun cppWrite(pointer: Long, stateMachinePointer: Long): Int
+
+    private external fun cppView(pointer: Long): ByteBuffer
+
+    /** A view of the native buffer, replaced only when the native buffer grows. */
+    private var view: ByteBuffer? = null
+
+    /** Scratch space for decoding strings, grown to the longest string seen. */
+    private var scratch = ByteArray(64)
+
+    /** The number of events from the last read. */
+    var size: Int = 0
+        private set
+
+    /** Whether the last read had no events. */
+    val isEmpty: Boolean
+        get() = size == 0
+
+    /**
+     * Replace the contents with the events reported by the state machine at
+     * [stateMachinePointer]. The caller must hold the state machine's file lock.
+     */
+    internal fun read(stateMachinePointer: Long): Int {
+        val byteSize = cppWrite(cppPointer, stateMachinePointer)
+        var buffer = view
+        // The native buffer only moves when it grows past the previous capacity.
+        if (buffer == null || byteSize > buffer.capacity()) {
+            buffer = cppView(cppPointer).order(ByteOrder.nativeOrder())
+            view = buffer
+        }
+        size = buffer.getInt(0)
+        return size
+    }
+
+    /** The type of the event at [index]. */
+    fun type(index: Int): EventType =
+        EventType.fromInt(bytes.getShort(eventOffset(index))) ?: EventType.GeneralEvent
+
+    /** The delay in seconds of the event at [index] after the start of the last advance. */
+    fun delay(index: Int): Float = bytes.getFloat(eventOffset(index) + Short.SIZE_BYTES)
+
+    /** The name of the event at [index]. */
+    fun name(index: Int): String = string(eventOffset(index) + NAME_OFFSET)
+
+    /** The URL of the event at [index], or an empty string if it is not an [RiveOpenURLEvent]. */
+    fun url(index: Int): String = string(urlOffset(index) + 1)
+
+    /** The target of the event at [index], e.g. `_blank`, if it is an [RiveOpenURLEvent]. */
+    fun target(index: Int): String = TARGETS.getOrElse(bytes.get(urlOffset(index)).toInt()) {
+        TARGETS[0]
+    }
+
+    /** The number of custom properties on the event at [index]. */
+    fun propertyCount(index: Int): Int = bytes.getInt(propertiesOffset(index))
+
+    /** The name of custom property [property] on the event at [index]. */
+    fun propertyName(index: Int, property: Int): String =
+        string(propertyOffset(index, property) + 1)
+
+    /** The type of custom property [property] on the event at [index]. */
+    fun propertyType(index: Int, property: Int): PropertyType =
+        when (bytes.get(propertyOffset(index, property))) {
+            PROPERTY_BOOLEAN -> PropertyType.Boolean
+            PROPERTY_NUMBER -> PropertyType.Number
+            else -> PropertyType.String
+        }
+
+    /**
+     * The value of boolean property [property] on the event at [index].
+     *
+     * @throws IllegalStateException If the property is not a boolean.
+     */
+    fun booleanProperty(index: Int, property: Int): Boolean =
+        bytes.get(valueOffset(index, property, PROPERTY_BOOLEAN)).toInt() != 0
+
+    /**
+     * The value of number property [property] on the event at [index].
+     *
+     * @throws IllegalStateException If the property is not a number.
+     */
+    fun numberProperty(index: Int, property: Int): Float =
+        bytes.getFloat(valueOffset(index, property, PROPERTY_NUMBER))
+
+    /**
+     * The value of string property [property] on the event at [index].
+     *
+     * @throws IllegalStateException If the property is not a string.
+     */
+    fun stringProperty(index: Int, property: Int): String =
+        string(valueOffset(index, property, PROPERTY_STRING))
+
+    private val bytes: ByteBuffer
+        get() = checkNotNull(view) { "No events have been read." }
+
+    /** The offset of the record for the event at [index], from the offset table. */
+    private fun eventOffset(index: Int): Int {
+        if (index !in 0 until size) {
+            throw IndexOutOfBoundsException("Event index $index out of bounds for size $size.")
+        }
+        return bytes.getInt(Int.SIZE_BYTES * (1 + index))
+    }
+
+    /** The offset of the open URL target, which is followed by the URL. */
+    private fun urlOffset(index: Int): Int {
+        val nameOffset = eventOffset(index) + NAME_OFFSET
+        return skipString(nameOffset)
+    }
+
+    /** The offset of the property count, which is followed by the properties. */
+    private fun propertiesOffset(index: Int): Int = skipString(urlOffset(index) + 1)
+
+    /** The offset of the tag of [property], which is followed by its name and value. */
+    private fun propertyOffset(index: Int, property: Int): Int {
+        val countOffset = propertiesOffset(index)
+        val count = bytes.getInt(countOffset)
+        if (property !in 0 until count) {
+            throw IndexOutOfBoundsException(
+                "Property index $property out of bounds for count $count."
+            )
+        }
+        var offset = countOffset + Int.SIZE_BYTES
+        repeat(property) {
+            val tag = bytes.get(offset)
+            offset = skipString(offset + 1)
+            offset += when (tag) {
+                PROPERTY_BOOLEAN -> 1
+                PROPERTY_NUMBER -> Float.SIZE_BYTES
+                else -> Int.SIZE_BYTES + bytes.getInt(offset)
+            }
+        }
+        return offset
+    }
+
+    /** The offset of the value of [property], checking that it has the expected [tag]. */
+    private fun valueOffset(index: Int, property: Int, tag: Byte): Int {
+        val offset = propertyOffset(index, property)
+        check(bytes.get(offset) == tag) {
+            "Property $property of event $index is a ${propertyType(index, property)}."
+        }
+        return skipString(offset + 1)
+    }
+
+    private fun skipString(offset: Int): Int = offset + Int.SIZE_BYTES + bytes.getInt(offset)
+
+    private fun string(offset: Int): String {
+        val buffer = bytes
+        val length = buffer.getInt(offset)
+        if (length == 0) {
+            return ""
+        }
+        if (length > scratch.size) {
+            scratch = ByteArray(maxOf(scratch.size * 2, length))
+        }
+        // Absolute bulk gets need API 35. Every other read is absolute, so the position is free.
+        buffer.position(offset + Int.SIZE_BYTES)
+        buffer.get(scratch, 0, length)
+        return String(scratch, 0, length, Charsets.UTF_8)
+    }
+}
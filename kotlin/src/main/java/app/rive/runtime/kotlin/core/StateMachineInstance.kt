@@ -234,4 +234,16 @@ class StateMachineInstance(unsafeCppPointer: Long, private val fileLock: Reentra
         get() = synchronized(fileLock) {
             (0 until reportedEventCount).map { eventAt(it) }
         }
+
+    /**
+     * Reads all events fired in the last advance into [events], replacing its contents.
+     *
+     * An allocation-free alternative to [eventsReported] for files that report events every frame.
+     * The events are decoded lazily from [events], so keep it and reuse it for every advance.
+     *
+     * @return The number of events fired in the last advance.
+     */
+    fun readReportedEvents(events: ReportedEvents): Int = synchronized(fileLock) {
+        events.read(cppPointer)
+    }
 }
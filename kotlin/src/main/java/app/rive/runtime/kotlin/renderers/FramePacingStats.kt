@@ -0,0 +1,41 @@
+package app.rive.runtime.kotlin.renderers
+
+/**
+ * Frame pacing stats for a [Renderer].
+ *
+ * Each display frame callback either schedules a frame on the worker thread or skips. When frames
+ * predictably cost more than one display frame, the renderer lowers its target rate to every
+ * second, third, or fourth display frame, and the frames it skips are coalesced: the next frame
+ * advances by their time instead. Separately, a display frame is dropped when the worker already
+ * has two frames queued or running.
+ *
+ * @property scheduledFrames Frames scheduled on the worker thread.
+ * @property coalescedFrames Display frames skipped to hold a lower target rate.
+ * @property droppedFrames Display frames skipped because the worker was full.
+ * @property lateFrames Frames that finished after the display frame they were paced for.
+ * @property predictedFrameCostNanos The predicted cost of the next frame on the worker thread.
+ * @property displayFrameIntervalNanos The measured interval between display frame callbacks.
+ * @property targetFrameDivisor The target rate is one frame every this many display frames.
+ */
+data class FramePacingStats(
+    val scheduledFrames: Long,
+    val coalescedFrames: Long,
+    val droppedFrames: Long,
+    val lateFrames: Long,
+    val predictedFrameCostNanos: Long,
+    val displayFrameIntervalNanos: Long,
+    val targetFrameDivisor: Int,
+) {
+    internal companion object {
+        /** Matches the order of `rive_android::FramePacer::Stats`. */
+        fun fromArray(stats: LongArray) = FramePacingStats(
+            scheduledFrames = stats[0],
+            coalescedFrames = stats[1],
+            droppedFrames = stats[2],
+            lateFrames = stats[3],
+            predictedFrameCostNanos = stats[4],
+            displayFrameIntervalNanos = stats[5],
+            targetFrameDivisor = stats[6].toInt(),
+        )
+    }
+}
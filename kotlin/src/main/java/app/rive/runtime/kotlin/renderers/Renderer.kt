@@ -12,6 +12,7 @@ import androidx.annotation.VisibleForTesting
 import androidx.annotation.WorkerThread
 import app.rive.RiveLog
 import app.rive.core.EGLError
+import app.rive.core.FrameTimingStats
 import app.rive.runtime.kotlin.SharedSurface
 import app.rive.runtime.kotlin.core.Alignment
 import app.rive.runtime.kotlin.core.Fit
@@ -66,6 +67,10 @@ abstract class Renderer(
     private external fun cppWidth(rendererPointer: Long): Int
     private external fun cppHeight(rendererPointer: Long): Int
     private external fun cppAvgFps(rendererPointer: Long): Float
+    private external fun cppWorkerLaneStats(rendererPointer: Long, lane: Int): LongArray
+    private external fun cppFramePacingStats(rendererPointer: Long): LongArray
+    private external fun cppFrameTimingStats(rendererPointer: Long): LongArray
+    private external fun cppCopyFrameRecords(rendererPointer: Long, records: LongArray): Int
     private external fun cppDoFrame(rendererPointer: Long)
     private external fun cppSetSurface(surface: Surface, rendererPointer: Long)
     private external fun cppDestroySurface(rendererPointer: Long)
@@ -361,6 +366,35 @@ abstract class Renderer(
     val averageFps: Float
         get() = cppAvgFps(cppPointer)
 
+    /** Stats for frame work on the worker thread this renderer shares with others. */
+    val frameLaneStats: WorkerLaneStats
+        get() = WorkerLaneStats.fromArray(
+            cppWorkerLaneStats(cppPointer, WorkerLaneStats.LANE_FRAME)
+        )
+
+    /** Stats for background work on the worker thread this renderer shares with others. */
+    val backgroundLaneStats: WorkerLaneStats
+        get() = WorkerLaneStats.fromArray(
+            cppWorkerLaneStats(cppPointer, WorkerLaneStats.LANE_BACKGROUND)
+        )
+
+    /** How this renderer's frames have been paced against the display's frame callbacks. */
+    val framePacingStats: FramePacingStats
+        get() = FramePacingStats.fromArray(cppFramePacingStats(cppPointer))
+
+    /** Per-stage times of the frames this renderer most recently drew on the worker thread. */
+    val frameTimingStats: FrameTimingStats
+        get() = FrameTimingStats.fromArray(cppFrameTimingStats(cppPointer))
+
+    /**
+     * Copy the times of the frames this renderer most recently drew into [records], oldest first,
+     * as [FrameTimingStats.RECORD_FIELDS] values per frame. Copies as many as fit, up to
+     * [FrameTimingStats.MAX_RECORDS], so one array can be reused for every copy.
+     *
+     * @return The number of frames copied.
+     */
+    fun copyFrameRecords(records: LongArray): Int = cppCopyFrameRecords(cppPointer, records)
+
     fun align(
         fit: Fit,
         alignment: Alignment,
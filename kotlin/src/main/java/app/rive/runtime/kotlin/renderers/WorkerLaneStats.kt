@@ -0,0 +1,43 @@
+package app.rive.runtime.kotlin.renderers
+
+/**
+ * Scheduling stats for one lane of the native worker thread that a [Renderer] draws on. The worker
+ * is shared by all renderers of the same [type][Renderer.type], so the stats cover all of them.
+ *
+ * Frame work (frames and surface changes) runs ahead of background work (releasing GPU resources),
+ * and frames that can't start by their deadline are dropped rather than drawn late.
+ *
+ * @property queueDepth Work queued or running.
+ * @property peakQueueDepth The most work that has been queued or running at once.
+ * @property ranCount Work that has run.
+ * @property droppedCount Work dropped for missing its deadline.
+ * @property totalWaitNanos Total time work waited between being queued and starting.
+ * @property maxWaitNanos The longest time any work waited between being queued and starting.
+ */
+data class WorkerLaneStats(
+    val queueDepth: Long,
+    val peakQueueDepth: Long,
+    val ranCount: Long,
+    val droppedCount: Long,
+    val totalWaitNanos: Long,
+    val maxWaitNanos: Long,
+) {
+    /** The mean time work waited between being queued and starting or being dropped. */
+    val meanWaitNanos: Long
+        get() = (ranCount + droppedCount).let { if (it == 0L) 0L else totalWaitNanos / it }
+
+    internal companion object {
+        /** Matches `rive_android::WorkLane`. */
+        const val LANE_FRAME = 0
+        const val LANE_BACKGROUND = 1
+
+        fun fromArray(stats: LongArray) = WorkerLaneStats(
+            queueDepth = stats[0],
+            peakQueueDepth = stats[1],
+            ranCount = stats[2],
+            droppedCount = stats[3],
+            totalWaitNanos = stats[4],
+            maxWaitNanos = stats[5],
+        )
+    }
+}
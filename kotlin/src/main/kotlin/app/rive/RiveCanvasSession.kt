@@ -16,9 +16,9 @@ import app.rive.core.ChoreographerFrameTicker
 import app.rive.core.CloseOnce
 import app.rive.core.CommandQueue
 import app.rive.core.FrameTicker
+import app.rive.core.PointerEventBatch
 import app.rive.core.RenderingDefaults
 import app.rive.core.RiveWorker
-import app.rive.core.StateMachineHandle
 import app.rive.core.traceSection
 import kotlinx.coroutines.CompletableDeferred
 import kotlinx.coroutines.cancelAndJoin
@@ -33,8 +33,6 @@ import kotlinx.coroutines.launch
 import kotlin.coroutines.cancellation.CancellationException
 import kotlin.time.Duration.Companion.nanoseconds
 
-private typealias PointerFn = (StateMachineHandle, Fit, Float, Float, Int, Float, Float) -> Unit
-
 /**
  * Marks APIs that use experimental hardware bitmap rendering.
  *
@@ -153,11 +151,8 @@ class RiveCanvasSession @Throws(
         color = clearColor
     }
 
-    /** Memoized pointer functions to avoid allocating lambdas during pointer event handling. */
-    private val pointerDownFn: PointerFn = riveWorker::pointerDown
-    private val pointerMoveFn: PointerFn = riveWorker::pointerMove
-    private val pointerUpFn: PointerFn = riveWorker::pointerUp
-    private val pointerExitFn: PointerFn = riveWorker::pointerExit
+    /** Reused to submit each touch event, including its historical samples, in one call. */
+    private val pointerBatch = PointerEventBatch()
 
     /** Completed when [close] is called, used to stop [beginPlaying]. */
     private val closeSignal = CompletableDeferred<Unit>()
@@ -540,58 +535,74 @@ class RiveCanvasSession @Throws(
             x >= renderRegion.left && x < renderRegion.right &&
                     y >= renderRegion.top && y < renderRegion.bottom
 
-        fun dispatchPointer(index: Int, pointerFn: PointerFn) {
-            val xInRegion = event.getX(index) - renderRegion.left
-            val yInRegion = event.getY(index) - renderRegion.top
-            val pointerId = event.getPointerId(index)
-            pointerFn(
-                stateMachine.stateMachineHandle,
-                fit,
-                surfaceWidth,
-                surfaceHeight,
-                pointerId,
-                xInRegion,
-                yInRegion
-            )
+        val batch = pointerBatch.apply { clear() }
+
+        fun regionX(x: Float) = x - renderRegion.left
+        fun regionY(y: Float) = y - renderRegion.top
+
+        fun addMoveOrExit(pointerId: Int, x: Float, y: Float) {
+            if (containsInRegion(x, y)) {
+                batch.move(pointerId, regionX(x), regionY(y))
+            } else {
+                batch.exit(pointerId, regionX(x), regionY(y))
+            }
         }
 
         val handled = traceSection("Rive/PointerInput") {
             when (event.actionMasked) {
                 MotionEvent.ACTION_DOWN,
                 MotionEvent.ACTION_POINTER_DOWN -> {
-                    val actionX = event.getX(event.actionIndex)
-                    val actionY = event.getY(event.actionIndex)
+                    val index = event.actionIndex
+                    val actionX = event.getX(index)
+                    val actionY = event.getY(index)
                     if (!containsInRegion(actionX, actionY)) {
                         return@traceSection false
                     }
-                    dispatchPointer(event.actionIndex, pointerDownFn)
+                    batch.down(event.getPointerId(index), regionX(actionX), regionY(actionY))
                     true
                 }
 
                 MotionEvent.ACTION_MOVE -> {
+                    // Replay the samples coalesced into this event, oldest first, so fast drags
+                    // are not reduced to one position per frame.
+                    repeat(event.historySize) { historyIndex ->
+                        repeat(event.pointerCount) { index ->
+                            addMoveOrExit(
+                                event.getPointerId(index),
+                                event.getHistoricalX(index, historyIndex),
+                                event.getHistoricalY(index, historyIndex)
+                            )
+                        }
+                    }
                     repeat(event.pointerCount) { index ->
-                        val pointerFn =
-                            if (containsInRegion(event.getX(index), event.getY(index))) {
-                                pointerMoveFn
-                            } else {
-                                pointerExitFn
-                            }
-                        dispatchPointer(index, pointerFn)
+                        addMoveOrExit(
+                            event.getPointerId(index),
+                            event.getX(index),
+                            event.getY(index)
+                        )
                     }
                     true
                 }
 
                 MotionEvent.ACTION_UP,
                 MotionEvent.ACTION_POINTER_UP -> {
-                    dispatchPointer(event.actionIndex, pointerUpFn)
-                    dispatchPointer(event.actionIndex, pointerExitFn)
+                    val index = event.actionIndex
+                    val pointerId = event.getPointerId(index)
+                    val x = regionX(event.getX(index))
+                    val y = regionY(event.getY(index))
+                    batch.up(pointerId, x, y)
+                    batch.exit(pointerId, x, y)
                     true
                 }
 
                 MotionEvent.ACTION_CANCEL,
                 MotionEvent.ACTION_OUTSIDE -> {
                     repeat(event.pointerCount) { index ->
-                        dispatchPointer(index, pointerExitFn)
+                        batch.exit(
+                            event.getPointerId(index),
+                            regionX(event.getX(index)),
+                            regionY(event.getY(index))
+                        )
                     }
                     true
                 }
@@ -600,6 +611,14 @@ class RiveCanvasSession @Throws(
             }
         }
 
+        riveWorker.pointerEvents(
+            stateMachine.stateMachineHandle,
+            fit,
+            surfaceWidth,
+            surfaceHeight,
+            batch
+        )
+
         if (handled) {
             stateMachine.unsettle()
         }
@@ -101,18 +101,10 @@ class RiveFile internal constructor(
                 riveWorker.acquire(FILE_TAG)
                 workerReferenceAcquired = true
 
-                val fileBytes = when (source) {
-                    is RiveFileSource.Bytes -> source.data
-                    is RiveFileSource.RawRes -> {
-                        // Use an I/O worker to load the raw resource bytes
-                        withContext(Dispatchers.IO) {
-                            source.resources.openRawResource(source.resId)
-                                .use { it.readBytes() }
-                        }
-                    }
+                val fileHandle = when (source) {
+                    is RiveFileSource.Bytes -> riveWorker.loadFile(source.data)
+                    is RiveFileSource.RawRes -> loadRawResource(source, riveWorker)
                 }
-                RiveLog.v(FILE_TAG) { "Loaded Rive file bytes from source: $source; sending to Rive worker" }
-                val fileHandle = riveWorker.loadFile(fileBytes)
 
                 RiveLog.d(FILE_TAG) { "Loaded Rive file from source: $source; $fileHandle" }
                 RiveFile(fileHandle, riveWorker)
@@ -162,6 +154,35 @@ class RiveFile internal constructor(
         } catch (e: Exception) {
             Result.Error(e)
         }
+
+        /**
+         * Loads a raw resource, mapping it directly from the APK when it is stored uncompressed to
+         * avoid reading it into a byte array. Compressed resources cannot be opened as a file
+         * descriptor, so they fall back to reading the bytes on an I/O worker.
+         */
+        private suspend fun loadRawResource(
+            source: RiveFileSource.RawRes,
+            riveWorker: RiveWorker
+        ): FileHandle {
+            val assetFileDescriptor = withContext(Dispatchers.IO) {
+                try {
+                    source.resources.openRawResourceFd(source.resId)
+                } catch (_: Resources.NotFoundException) {
+                    null // Compressed; a missing resource is reported by the fallback below.
+                }
+            }
+            if (assetFileDescriptor != null) {
+                RiveLog.v(FILE_TAG) { "Mapping Rive file from source: $source" }
+                return assetFileDescriptor.use { riveWorker.loadFile(it) }
+            }
+
+            // Use an I/O worker to load the raw resource bytes
+            val fileBytes = withContext(Dispatchers.IO) {
+                source.resources.openRawResource(source.resId).use { it.readBytes() }
+            }
+            RiveLog.v(FILE_TAG) { "Loaded Rive file bytes from source: $source; sending to Rive worker" }
+            return riveWorker.loadFile(fileBytes)
+        }
     }
 
     /**
@@ -18,9 +18,58 @@ object RiveLog {
      * ```
      *
      * Marked as `@Volatile` to ensure immediate visibility across threads.
+     *
+     * While this is [NoOpLogger], native code discards its messages without formatting them.
      */
     @Volatile
     var logger: Logger = NoOpLogger
+        set(value) {
+            field = value
+            updateNativeLevel()
+        }
+
+    /**
+     * The lowest level of message from native code that reaches [logger]. Native code discards
+     * messages below it at the cost of one comparison, before formatting them, so raising it
+     * removes logging's cost from the render threads. Defaults to [Level.VERBOSE], passing every
+     * message.
+     *
+     * Messages that pass are delivered to [logger] on a low-priority native thread, in the order
+     * they were logged, rather than on the thread that logged them. See [droppedNativeMessages].
+     *
+     * May be set before the native library is loaded.
+     */
+    @Volatile
+    var nativeLevel: Level = Level.VERBOSE
+        set(value) {
+            field = value
+            updateNativeLevel()
+        }
+
+    /**
+     * Messages from native code dropped since the library was loaded because they were logged
+     * faster than they could be delivered to [logger]. Native code never waits for [logger], so a
+     * slow logger loses messages rather than stalling rendering. Each run of drops is also reported
+     * to [logger] as a warning.
+     */
+    val droppedNativeMessages: Long
+        get() = try {
+            cppDroppedMessageCount()
+        } catch (_: UnsatisfiedLinkError) {
+            0
+        }
+
+    /** Levels of log message, by increasing severity, for [nativeLevel]. */
+    enum class Level(internal val priority: Int) {
+        VERBOSE(Log.VERBOSE),
+        DEBUG(Log.DEBUG),
+        INFO(Log.INFO),
+        WARN(Log.WARN),
+        ERROR(Log.ERROR),
+
+        /** Discards every message. Matches `ANDROID_LOG_SILENT`. */
+        NONE(Log.ASSERT + 1),
+    }
 
     /**
      * Interface for logging. Implementations should provide methods for different log levels.
@@ -93,6 +142,28 @@ object RiveLog {
     @Suppress("UNUSED") // Used by native code
     fun logE(tag: String, msg: String) = logger.e(tag, null) { msg }
 
+    /** The Android log priority native code passes messages from. */
+    internal fun nativePriority(): Int =
+        if (logger === NoOpLogger) Level.NONE.priority else nativeLevel.priority
+
+    /**
+     * Pushes [nativePriority] to native code. Also called by native code when it initializes, so
+     * the level may be set before the library is loaded; the lock keeps that call from overwriting
+     * a newer level with a stale one.
+     */
+    @JvmStatic
+    @Synchronized
+    private fun updateNativeLevel() {
+        try {
+            cppSetNativeLogLevel(nativePriority())
+        } catch (_: UnsatisfiedLinkError) {
+            // Not loaded yet. Native code calls this again when it initializes.
+        }
+    }
+
+    private external fun cppSetNativeLogLevel(priority: Int)
+    private external fun cppDroppedMessageCount(): Long
+
     /** Implementation that logs to Logcat with lazy `msg()` evaluation. */
     class LogcatLogger : Logger {
         override fun v(tag: String, msg: () -> String) {
@@ -0,0 +1,57 @@
+package app.rive.core
+
+/**
+ * A reusable list of state machines to advance together with [CommandQueue.advanceStateMachines].
+ *
+ * Each state machine is added with the artboard it was created from, packed as `(artboard, state
+ * machine)` handle pairs so that the whole batch crosses JNI as one array and is advanced by one
+ * command on the command server. State machines that share an artboard, or a bound view model
+ * instance, always advance on the same thread in the order they were added.
+ *
+ * Intended to be kept as a member and [clear]ed between frames, so that steady-state advancing does
+ * not allocate.
+ *
+ * Not thread-safe. Fill and submit the batch from one thread.
+ *
+ * @param initialCapacity The number of state machines to reserve space for.
+ */
+class AdvanceBatch(initialCapacity: Int = DEFAULT_CAPACITY) {
+    internal companion object {
+        /** The number of longs per packed state machine. */
+        const val STRIDE = 2
+
+        private const val DEFAULT_CAPACITY = 16
+    }
+
+    init {
+        require(initialCapacity > 0) { "initialCapacity must be positive, got $initialCapacity" }
+    }
+
+    /** The packed handle pairs. Only the first [size] × [STRIDE] longs are valid. */
+    internal var handles = LongArray(initialCapacity * STRIDE)
+        private set
+
+    /** The number of state machines in the batch. */
+    var size: Int = 0
+        private set
+
+    /** Whether the batch has no state machines. */
+    val isEmpty: Boolean
+        get() = size == 0
+
+    /** Append [stateMachineHandle], which was created from [artboardHandle]. */
+    fun add(artboardHandle: ArtboardHandle, stateMachineHandle: StateMachineHandle) {
+        val offset = size * STRIDE
+        if (offset + STRIDE > handles.size) {
+            handles = handles.copyOf(handles.size * 2)
+        }
+        handles[offset] = artboardHandle.handle
+        handles[offset + 1] = stateMachineHandle.handle
+        size++
+    }
+
+    /** Remove all state machines, keeping the allocated capacity for reuse. */
+    fun clear() {
+        size = 0
+    }
+}
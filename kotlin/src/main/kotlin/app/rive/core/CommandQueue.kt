@@ -1,7 +1,9 @@
 package app.rive.core
 
+import android.content.res.AssetFileDescriptor
 import android.graphics.Color
 import android.os.Build
+import android.os.ParcelFileDescriptor
 import androidx.annotation.ColorInt
 import androidx.annotation.Keep
 import androidx.annotation.VisibleForTesting
@@ -41,6 +43,7 @@ import app.rive.runtime.kotlin.core.ViewModel
 import kotlinx.coroutines.CancellableContinuation
 import kotlinx.coroutines.Dispatchers
 import kotlinx.coroutines.ExperimentalCoroutinesApi
+import kotlinx.coroutines.NonCancellable
 import kotlinx.coroutines.channels.BufferOverflow
 import kotlinx.coroutines.flow.MutableSharedFlow
 import kotlinx.coroutines.flow.SharedFlow
@@ -48,12 +51,15 @@ import kotlinx.coroutines.flow.StateFlow
 import kotlinx.coroutines.isActive
 import kotlinx.coroutines.suspendCancellableCoroutine
 import kotlinx.coroutines.withContext
+import java.nio.ByteBuffer
 import java.util.concurrent.ConcurrentHashMap
 import java.util.concurrent.CountDownLatch
 import java.util.concurrent.TimeUnit
+import java.util.concurrent.atomic.AtomicBoolean
 import java.util.concurrent.atomic.AtomicLong
 import kotlin.coroutines.Continuation
 import kotlin.coroutines.CoroutineContext
+import kotlin.coroutines.EmptyCoroutineContext
 import kotlin.coroutines.cancellation.CancellationException
 import kotlin.coroutines.resume
 import kotlin.coroutines.resumeWithException
@@ -129,6 +135,8 @@ const val COMMAND_QUEUE_TAG = "Rive/CQ"
  *    `createNativeCommandQueueResources`. Supplying it lets backend fallback finish native startup
  *    before ownership is transferred to this instance.
  * @param settlingStore Settled-state store override used by unit tests without native code.
+ * @param startup Receives the startup result when [nativePointer] was created without waiting for
+ *    the command server to start, or `null` if startup already succeeded.
  */
 class CommandQueue internal constructor(
     private val renderContext: RenderContext,
@@ -136,6 +144,7 @@ class CommandQueue internal constructor(
     tracingEnabled: Boolean = false,
     nativePointer: Long = createNativeCommandQueue(renderContext, bridge),
     settlingStore: StateMachineSettlingStore? = null,
+    startup: CommandQueueStartup? = null,
 ) : RefCounted {
     /**
      * Creates a command queue using the requested render backend.
@@ -158,6 +167,42 @@ class CommandQueue internal constructor(
         tracingEnabled = tracingEnabled
     )
 
+    /**
+     * Creates a command queue without waiting for its command server to start.
+     *
+     * The other constructors block until the command server thread has attached to the JVM and
+     * initialized its render context, which for a first command queue includes creating the GPU
+     * device and can take a noticeable part of time to first frame. This constructor returns
+     * immediately instead. The command queue can be used straight away: commands are buffered
+     * until the command server starts, and suspend requests complete once it has served them.
+     *
+     * [startupListener] is called on the main thread once startup finishes. If startup fails,
+     * pending and later suspend requests fail with the same [RiveInitializationException], and
+     * buffered commands are never run. Release the command queue as usual in either case.
+     *
+     * Unlike the other constructors, a Vulkan startup failure is reported rather than retried with
+     * OpenGL, since it is only known after this constructor returns.
+     *
+     * @param renderBackend Preferred render backend. If Vulkan is requested below the minimum
+     *    supported Android API level, OpenGL is used instead.
+     * @param tracingEnabled Whether native command server tracing should start enabled.
+     * @param startupListener Notified when the command server has started or failed to start.
+     * @throws RiveInitializationException If the render context cannot be created.
+     */
+    @Throws(RiveInitializationException::class)
+    constructor(
+        renderBackend: RenderBackend = RenderBackend.OpenGL,
+        tracingEnabled: Boolean = false,
+        startupListener: CommandQueueStartupListener,
+    ) : this(
+        resources = createAsyncNativeCommandQueueResources(
+            renderBackend = renderBackend,
+            bridge = CommandQueueJNIBridge(),
+            startup = CommandQueueStartup(startupListener),
+        ),
+        tracingEnabled = tracingEnabled
+    )
+
     /**
      * Creates a command queue with injectable backend construction for unit tests.
      *
@@ -186,7 +231,39 @@ class CommandQueue internal constructor(
     )
 
     /**
-     * Completes construction from resources that already passed native startup.
+     * Creates a command queue without waiting for startup, with injectable backend construction
+     * for unit tests.
+     *
+     * @param renderBackend Preferred backend for the command queue.
+     * @param tracingEnabled Whether native command server tracing should start enabled.
+     * @param bridge Native bridge mock used to start the command server without loading JNI.
+     * @param startupListener Notified when the command server has started or failed to start.
+     * @param sdkInt Android API level to use for backend selection.
+     * @param renderContextFactory Factory that creates the requested concrete render context.
+     * @throws RiveInitializationException If the render context cannot be created.
+     */
+    @VisibleForTesting
+    internal constructor(
+        renderBackend: RenderBackend,
+        tracingEnabled: Boolean = false,
+        bridge: CommandQueueBridge,
+        startupListener: CommandQueueStartupListener,
+        sdkInt: Int = Build.VERSION.SDK_INT,
+        renderContextFactory: (RenderBackend) -> RenderContext,
+    ) : this(
+        resources = createAsyncNativeCommandQueueResources(
+            renderBackend = renderBackend,
+            bridge = bridge,
+            startup = CommandQueueStartup(startupListener),
+            sdkInt = sdkInt,
+            renderContextFactory = renderContextFactory,
+        ),
+        tracingEnabled = tracingEnabled,
+    )
+
+    /**
+     * Completes construction from resources that already passed native startup, or whose startup
+     * is reported to [NativeCommandQueueResources.startup].
      *
      * Kotlin delegated constructors cannot wrap a `this(...)` call in fallback logic. The public
      * backend constructor therefore creates the render context and native command queue first, then
@@ -206,6 +283,7 @@ class CommandQueue internal constructor(
         bridge = resources.bridge,
         tracingEnabled = tracingEnabled,
         nativePointer = resources.nativePointer,
+        startup = resources.startup,
     )
 
     /**
@@ -218,11 +296,14 @@ class CommandQueue internal constructor(
      * @property renderContext Render context selected for the command queue.
      * @property bridge Native bridge used to create [nativePointer].
      * @property nativePointer Native command queue pointer created from [renderContext].
+     * @property startup Receives the startup result if [nativePointer] was created without waiting
+     *    for it.
      */
     private data class NativeCommandQueueResources(
         val renderContext: RenderContext,
         val bridge: CommandQueueBridge,
         val nativePointer: Long = createNativeCommandQueue(renderContext, bridge),
+        val startup: CommandQueueStartup? = null,
     )
 
     companion object {
@@ -293,6 +374,33 @@ class CommandQueue internal constructor(
             )
         }
 
+        /**
+         * Creates command queue resources without waiting for the command server to start.
+         *
+         * @param renderBackend Preferred backend for the command queue.
+         * @param startup Receives the startup result from the command server thread.
+         * @return Resources whose native command queue may still be starting.
+         * @throws RiveInitializationException If the render context cannot be created.
+         */
+        private fun createAsyncNativeCommandQueueResources(
+            renderBackend: RenderBackend,
+            bridge: CommandQueueBridge,
+            startup: CommandQueueStartup,
+            sdkInt: Int = Build.VERSION.SDK_INT,
+            renderContextFactory: (RenderBackend) -> RenderContext = ::createRenderContext,
+        ): NativeCommandQueueResources {
+            val renderContext = renderContextFactory(effectiveRenderBackend(renderBackend, sdkInt))
+            return NativeCommandQueueResources(
+                renderContext = renderContext,
+                bridge = bridge,
+                nativePointer = bridge.cppConstructorAsync(
+                    renderContext.nativeObjectPointer,
+                    startup
+                ),
+                startup = startup,
+            )
+        }
+
         private fun createRenderContext(renderBackend: RenderBackend): RenderContext =
             when (renderBackend) {
                 RenderBackend.Vulkan -> RenderContextVulkan()
@@ -341,6 +449,10 @@ class CommandQueue internal constructor(
     )
     private var listeners = bridge.cppCreateListeners(cppPointer.pointer, this)
 
+    /** Set once an asynchronously started command server reports that it failed to start. */
+    @Volatile
+    private var startupFailure: RiveInitializationException? = null
+
     init {
         setTracingEnabled(tracingEnabled)
     }
@@ -498,6 +610,46 @@ class CommandQueue internal constructor(
         bridge.cppSetTracingEnabled(requireNativePointer(), enabled)
     }
 
+    /** Decoder owning the shared message buffer while batching is enabled. */
+    private var messageBatchDecoder: MessageBatchDecoder? = null
+
+    /**
+     * Enables or disables batched message delivery for [pollMessages].
+     *
+     * When enabled, messages from the command server that carry only scalars and strings, such as
+     * property updates, errors, and created handles, are packed by native code into a reusable
+     * direct buffer and delivered with a single JNI call per poll, rather than one JNI call (and
+     * its string allocations) per message. Callbacks, flows, and ordering are unchanged.
+     *
+     * Must be called from the thread that polls this command queue.
+     *
+     * @param enabled Whether messages should be batched.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun setMessageBatchingEnabled(enabled: Boolean) {
+        val decoder = if (enabled) messageBatchDecoder ?: MessageBatchDecoder() else null
+        bridge.cppSetMessageBuffer(requireNativePointer(), decoder?.buffer)
+        messageBatchDecoder = decoder
+    }
+
+    /**
+     * Callback with a batch of packed messages, delivered during [pollMessages] when message
+     * batching is enabled.
+     *
+     * @param size The number of bytes written to the message buffer.
+     */
+    @Keep // Called from JNI
+    @Suppress("Unused")
+    @JvmName("onMessageBatch")
+    internal fun onMessageBatch(size: Int) {
+        val decoder = messageBatchDecoder ?: run {
+            RiveLog.e(COMMAND_QUEUE_TAG) { "Received a message batch without a decoder" }
+            return
+        }
+        decoder.decode(size, this)
+    }
+
     /**
      * Tie this command queue's lifetime to a LifecycleOwner. This will call [release] when the
      * owner's lifecycle reaches DESTROYED. Returns an [AutoCloseable] that can be used to manually
@@ -717,6 +869,25 @@ class CommandQueue internal constructor(
     fun pollMessages() {
         traceSection("Rive/PollMessages") {
             bridge.cppPollMessages(requireNativePointer())
+            presentStalePipelinedFrames()
+        }
+    }
+
+    /**
+     * Surfaces with a pipelined draw, mapped to whether they have been drawn since the previous
+     * poll. A pipelined frame is only presented by the surface's next draw, so once a poll finds
+     * no draw since the one before, the surface has stopped drawing, e.g. because its state
+     * machine settled, and its last frame is presented here instead.
+     */
+    private val pipelinedSurfaces = ConcurrentHashMap<RiveSurface, Boolean>()
+
+    private fun presentStalePipelinedFrames() {
+        for ((surface, drawnSincePoll) in pipelinedSurfaces) {
+            if (drawnSincePoll) {
+                pipelinedSurfaces.replace(surface, true, false)
+            } else if (pipelinedSurfaces.remove(surface, false) && !surface.closed) {
+                presentPendingFrame(surface)
+            }
         }
     }
 
@@ -879,9 +1050,143 @@ class CommandQueue internal constructor(
     @Throws(RiveFileException::class, RiveResourceClosedException::class, CancellationException::class)
     suspend fun loadFile(bytes: ByteArray): FileHandle =
         suspendNativeResourceRequest(::deleteFile) { requestID ->
-            FileHandle(bridge.cppLoadFile(requireNativePointer(), requestID, bytes))
+            traceSection("Rive/LoadFile/Submit") {
+                FileHandle(bridge.cppLoadFile(requireNativePointer(), requestID, bytes))
+            }
         }
 
+    /**
+     * Loads a Rive file from the remaining bytes of a direct [ByteBuffer], such as a
+     * [java.nio.MappedByteBuffer], and suspends until the command server confirms the load.
+     *
+     * This is not zero-copy: the command queue takes ownership of its own copy of the file, so
+     * the bytes are copied once into native memory, on an I/O thread, and that copy is handed to
+     * the command queue without another. Until this function returns, the file is held twice, in
+     * [buffer] and in the copy, as with a [ByteArray]. The difference is that the main thread never
+     * copies the file and no Java heap array is needed. The buffer's position is not modified.
+     *
+     * @param buffer A direct buffer holding the bytes of the Rive file between its position and
+     *    limit. It is only read until this function returns, after which it may be released.
+     * @return A [FileHandle] that represents the loaded Rive file.
+     * @throws IllegalArgumentException If [buffer] is not direct or has no remaining bytes, or if
+     *    its position and limit are outside its capacity.
+     * @throws RiveFileException If the file could not be loaded.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     * @throws CancellationException If the coroutine is cancelled before the operation completes.
+     */
+    @Throws(
+        IllegalArgumentException::class,
+        RiveFileException::class,
+        RiveResourceClosedException::class,
+        CancellationException::class
+    )
+    suspend fun loadFile(buffer: ByteBuffer): FileHandle {
+        require(buffer.isDirect) { "File bytes must be in a direct ByteBuffer" }
+        require(buffer.hasRemaining()) { "File buffer has no remaining bytes" }
+        val fileBytes = withContext(Dispatchers.IO + NonCancellable) {
+            traceSection("Rive/LoadFile/Copy") {
+                bridge.cppCopyFileBytes(buffer, buffer.position(), buffer.remaining())
+            }
+        }
+        if (fileBytes == 0L) {
+            throw RiveFileException("Failed to read file bytes from $buffer")
+        }
+        return loadFileBytes(fileBytes)
+    }
+
+    /**
+     * Loads a Rive file from a region of a file descriptor and suspends until the command server
+     * confirms the load.
+     *
+     * The region is memory mapped and copied into native memory on an I/O thread, then handed to
+     * the command queue without a further copy. This avoids reading the file into a Java byte
+     * array, which would otherwise double the peak memory of a load, and keeps the copy off the
+     * main thread. The mapping is released before the load is submitted.
+     *
+     * @param fileDescriptor The file to read. It remains owned by the caller and may be closed
+     *    once this function returns.
+     * @param offset The offset of the Rive file within [fileDescriptor], in bytes.
+     * @param length The length of the Rive file in bytes. Defaults to the rest of the file.
+     * @return A [FileHandle] that represents the loaded Rive file.
+     * @throws IllegalArgumentException If [offset] is negative or [length] is not positive.
+     * @throws RiveFileException If the file could not be mapped or loaded.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     * @throws CancellationException If the coroutine is cancelled before the operation completes.
+     */
+    @Throws(
+        IllegalArgumentException::class,
+        RiveFileException::class,
+        RiveResourceClosedException::class,
+        CancellationException::class
+    )
+    suspend fun loadFile(
+        fileDescriptor: ParcelFileDescriptor,
+        offset: Long = 0L,
+        length: Long = fileDescriptor.statSize - offset
+    ): FileHandle {
+        require(offset >= 0L) { "File offset must not be negative: $offset" }
+        require(length > 0L) { "File length must be positive: $length" }
+        val fileBytes = withContext(Dispatchers.IO + NonCancellable) {
+            traceSection("Rive/LoadFile/Map") {
+                bridge.cppMapFileBytes(fileDescriptor.fd, offset, length)
+            }
+        }
+        if (fileBytes == 0L) {
+            throw RiveFileException("Failed to map $length bytes of file descriptor")
+        }
+        return loadFileBytes(fileBytes)
+    }
+
+    /**
+     * Loads a Rive file from an [AssetFileDescriptor], such as one returned by
+     * [android.content.res.Resources.openRawResourceFd] for an uncompressed raw resource.
+     *
+     * @param assetFileDescriptor The asset to read. It remains owned by the caller and may be
+     *    closed once this function returns.
+     * @return A [FileHandle] that represents the loaded Rive file.
+     * @throws RiveFileException If the file could not be mapped or loaded.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     * @throws CancellationException If the coroutine is cancelled before the operation completes.
+     * @see loadFile
+     */
+    @Throws(RiveFileException::class, RiveResourceClosedException::class, CancellationException::class)
+    suspend fun loadFile(assetFileDescriptor: AssetFileDescriptor): FileHandle {
+        val length = assetFileDescriptor.length.takeIf { it != AssetFileDescriptor.UNKNOWN_LENGTH }
+            ?: (assetFileDescriptor.parcelFileDescriptor.statSize - assetFileDescriptor.startOffset)
+        return loadFile(
+            assetFileDescriptor.parcelFileDescriptor,
+            assetFileDescriptor.startOffset,
+            length
+        )
+    }
+
+    /**
+     * Submits file bytes prepared in native memory by [loadFile] and suspends until the load is
+     * confirmed.
+     *
+     * Ownership of [fileBytes] passes to the command queue on submission. If the request ends
+     * before submission, such as by cancellation or disposal, the bytes are freed here instead.
+     * Submission and release race on different threads, so ownership is claimed atomically.
+     * Callers prepare the bytes in a [NonCancellable] context so that bytes prepared for a
+     * cancelled caller still reach this function to be freed.
+     */
+    private suspend fun loadFileBytes(fileBytes: Long): FileHandle {
+        val claimed = AtomicBoolean(false)
+        try {
+            return suspendNativeResourceRequest(::deleteFile) { requestID ->
+                val pointer = requireNativePointer()
+                check(claimed.compareAndSet(false, true)) { "File bytes were already released" }
+                traceSection("Rive/LoadFile/Submit") {
+                    FileHandle(bridge.cppLoadFileBytes(pointer, requestID, fileBytes))
+                }
+            }
+        } finally {
+            if (claimed.compareAndSet(false, true)) {
+                bridge.cppDeleteFileBytes(fileBytes)
+            }
+        }
+    }
+
     /**
      * Callback when a Rive file is loaded successfully, from [loadFile].
      *
@@ -1582,6 +1887,45 @@ class CommandQueue internal constructor(
             deltaTime.inWholeNanoseconds
         )
 
+    /**
+     * Advance every state machine in [batch] by the given delta time, with one native call and one
+     * command on the command server.
+     *
+     * Equivalent to calling [advanceStateMachine] for each state machine, including reporting
+     * invalid handles through [onStateMachineError] and settles through the settled callback. Draws
+     * queued after this call see every state machine advanced.
+     *
+     * With [parallel], independent state machines are advanced concurrently on a pool with a thread
+     * for each other core, which helps screens with many artboards, such as feeds and grids. State
+     * machines that share an artboard or a directly bound view model instance are kept on one
+     * thread. Only enable it when the batch's artboards share no other mutable state, such as a
+     * nested view model instance, and don't update GPU resources while advancing, such as
+     * deforming meshes, since the pool threads have no GL context.
+     *
+     * The batch is copied before returning, so it may be cleared and refilled immediately.
+     *
+     * @param batch The state machines to advance, with the artboards they were created from. Empty
+     *    batches are ignored.
+     * @param deltaTime The delta time to advance every state machine by.
+     * @param parallel Whether to advance independent state machines concurrently.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun advanceStateMachines(batch: AdvanceBatch, deltaTime: Duration, parallel: Boolean = false) {
+        val pointer = requireNativePointer()
+        if (batch.isEmpty) {
+            return
+        }
+        bridge.cppAdvanceStateMachines(
+            pointer,
+            nextRequestID.getAndIncrement(),
+            batch.handles,
+            batch.size,
+            deltaTime.inWholeNanoseconds,
+            parallel
+        )
+    }
+
     /**
      * Returns the latest settled state for a state machine owned by this command queue.
      *
@@ -2395,6 +2739,230 @@ class CommandQueue internal constructor(
         _triggerPropertyFlow
     )
 
+    /**
+     * Resolve a property path once for repeated access with the [PropertyHandle] overloads, e.g.
+     * [setNumberProperty]. Setting through a handle skips converting the path string on every call
+     * and resolving it against the view model instance on the CommandServer, which matters when
+     * updating many properties every frame.
+     *
+     * Resolution is lazy: an invalid path is reported asynchronously through the view model
+     * instance error callback on the first set, the same as for path based setters.
+     *
+     * The handle is invalidated when the view model instance is deleted with
+     * [deleteViewModelInstance]. Release it earlier with [releaseProperty].
+     *
+     * @param viewModelInstanceHandle The handle of the view model instance that the property
+     *    belongs to.
+     * @param propertyPath The path to the property. Slash delimited.
+     * @return A handle to the property.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun resolveProperty(
+        viewModelInstanceHandle: ViewModelInstanceHandle,
+        propertyPath: String
+    ): PropertyHandle = PropertyHandle(
+        bridge.cppResolveProperty(
+            requireNativePointer(),
+            viewModelInstanceHandle.handle,
+            propertyPath
+        ),
+        viewModelInstanceHandle,
+        propertyPath
+    )
+
+    /**
+     * Release a property handle from [resolveProperty] before its view model instance is deleted.
+     * Later sets through the handle are ignored.
+     *
+     * @param property The handle to release.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun releaseProperty(property: PropertyHandle) =
+        bridge.cppReleaseProperty(requireNativePointer(), property.handle)
+
+    /**
+     * Update a number property's value through a handle from [resolveProperty].
+     *
+     * @param property The handle of the property to update.
+     * @param value The new value of the property.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun setNumberProperty(property: PropertyHandle, value: Float) =
+        bridge.cppSetNumberPropertyByHandle(requireNativePointer(), property.handle, value)
+
+    /**
+     * Update a string property's value through a handle from [resolveProperty].
+     *
+     * @param property The handle of the property to update.
+     * @param value The new value of the property.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun setStringProperty(property: PropertyHandle, value: String) =
+        bridge.cppSetStringPropertyByHandle(requireNativePointer(), property.handle, value)
+
+    /**
+     * Update a boolean property's value through a handle from [resolveProperty].
+     *
+     * @param property The handle of the property to update.
+     * @param value The new value of the property.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun setBooleanProperty(property: PropertyHandle, value: Boolean) =
+        bridge.cppSetBooleanPropertyByHandle(requireNativePointer(), property.handle, value)
+
+    /**
+     * Update an enum property's value through a handle from [resolveProperty].
+     *
+     * @param property The handle of the property to update.
+     * @param value The new value of the property, as a string.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun setEnumProperty(property: PropertyHandle, value: String) =
+        bridge.cppSetEnumPropertyByHandle(requireNativePointer(), property.handle, value)
+
+    /**
+     * Update a color property's value through a handle from [resolveProperty].
+     *
+     * @param property The handle of the property to update.
+     * @param value The new value of the property, as an AARRGGBB [ColorInt].
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun setColorProperty(property: PropertyHandle, @ColorInt value: Int) =
+        bridge.cppSetColorPropertyByHandle(requireNativePointer(), property.handle, value)
+
+    /**
+     * Fire a trigger property through a handle from [resolveProperty].
+     *
+     * @param property The handle of the property to fire.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun fireTriggerProperty(property: PropertyHandle) =
+        bridge.cppFireTriggerPropertyByHandle(requireNativePointer(), property.handle)
+
+    /**
+     * Apply every update in [batch] as a single command.
+     *
+     * The updates are applied in order within one CommandServer step, so no state machine advance
+     * or draw queued around this call observes only some of them. This also replaces one queued
+     * command per property with one for the whole batch.
+     *
+     * Updates whose property does not resolve are reported asynchronously through the view model
+     * instance error callback, as for the individual setters, and do not prevent the rest of the
+     * batch from applying.
+     *
+     * The batch is copied before returning, so it may be cleared and refilled immediately.
+     *
+     * @param batch The updates to apply. Empty batches are ignored.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun applyPropertyBatch(batch: PropertyBatch) {
+        val pointer = requireNativePointer()
+        if (batch.isEmpty) {
+            return
+        }
+        bridge.cppApplyPropertyBatch(pointer, batch.bytes, batch.byteSize)
+    }
+
+    /**
+     * Get a number property's value through a handle from [resolveProperty].
+     *
+     * Gets are a round trip to the CommandServer, so unlike sets they are sent by path.
+     *
+     * @param property The handle of the property to retrieve.
+     * @return The value of the property.
+     * @throws RiveViewModelInstanceException If the view model instance operation fails.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     * @throws CancellationException If the coroutine is cancelled before the operation completes.
+     */
+    @Throws(
+        RiveViewModelInstanceException::class,
+        RiveResourceClosedException::class,
+        CancellationException::class
+    )
+    suspend fun getNumberProperty(property: PropertyHandle): Float =
+        getNumberProperty(property.viewModelInstanceHandle, property.path)
+
+    /**
+     * Get a string property's value through a handle from [resolveProperty].
+     *
+     * @param property The handle of the property to retrieve.
+     * @return The value of the property.
+     * @throws RiveViewModelInstanceException If the view model instance operation fails.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     * @throws CancellationException If the coroutine is cancelled before the operation completes.
+     * @see getNumberProperty
+     */
+    @Throws(
+        RiveViewModelInstanceException::class,
+        RiveResourceClosedException::class,
+        CancellationException::class
+    )
+    suspend fun getStringProperty(property: PropertyHandle): String =
+        getStringProperty(property.viewModelInstanceHandle, property.path)
+
+    /**
+     * Get a boolean property's value through a handle from [resolveProperty].
+     *
+     * @param property The handle of the property to retrieve.
+     * @return The value of the property.
+     * @throws RiveViewModelInstanceException If the view model instance operation fails.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     * @throws CancellationException If the coroutine is cancelled before the operation completes.
+     * @see getNumberProperty
+     */
+    @Throws(
+        RiveViewModelInstanceException::class,
+        RiveResourceClosedException::class,
+        CancellationException::class
+    )
+    suspend fun getBooleanProperty(property: PropertyHandle): Boolean =
+        getBooleanProperty(property.viewModelInstanceHandle, property.path)
+
+    /**
+     * Get an enum property's value through a handle from [resolveProperty].
+     *
+     * @param property The handle of the property to retrieve.
+     * @return The value of the property, as a string.
+     * @throws RiveViewModelInstanceException If the view model instance operation fails.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     * @throws CancellationException If the coroutine is cancelled before the operation completes.
+     * @see getNumberProperty
+     */
+    @Throws(
+        RiveViewModelInstanceException::class,
+        RiveResourceClosedException::class,
+        CancellationException::class
+    )
+    suspend fun getEnumProperty(property: PropertyHandle): String =
+        getEnumProperty(property.viewModelInstanceHandle, property.path)
+
+    /**
+     * Get a color property's value through a handle from [resolveProperty].
+     *
+     * @param property The handle of the property to retrieve.
+     * @return The value of the property, as an AARRGGBB [ColorInt].
+     * @throws RiveViewModelInstanceException If the view model instance operation fails.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     * @throws CancellationException If the coroutine is cancelled before the operation completes.
+     * @see getNumberProperty
+     */
+    @Throws(
+        RiveViewModelInstanceException::class,
+        RiveResourceClosedException::class,
+        CancellationException::class
+    )
+    suspend fun getColorProperty(property: PropertyHandle): Int =
+        getColorProperty(property.viewModelInstanceHandle, property.path)
+
     /**
      * Subscribe to changes to a property on the view model instance. Updates will be emitted on the
      * flow of the corresponding type, e.g. [numberPropertyFlow] for number properties.
@@ -2644,6 +3212,11 @@ class CommandQueue internal constructor(
      * decode. The bytes are for a compressed image format such as PNG or JPEG. The decoded image is
      * stored on the CommandServer.
      *
+     * For PNG, JPEG, WebP, and GIF, the command server only reads the image's dimensions and
+     * confirms right away. The pixels are decoded on a background pool and uploaded later, and
+     * until then the image draws as nothing. If those pixels then fail to decode, the image stays
+     * empty and the failure is only logged.
+     *
      * If the coroutine is cancelled after submission, the provisional image is deleted in command
      * order so a later successful decode cannot orphan it.
      *
@@ -3090,6 +3663,49 @@ class CommandQueue internal constructor(
         pointerY
     )
 
+    /**
+     * Notify the state machine of every pointer event in [batch], in order, with one native call.
+     *
+     * Equivalent to calling [pointerMove], [pointerDown], [pointerUp], and [pointerExit] for each
+     * event, but the events share one layout and are replayed by a single command. Prefer this
+     * when forwarding the historical samples of a `MotionEvent`, which otherwise cost a JNI call
+     * and a queued command each.
+     *
+     * The batch is copied before returning, so it may be cleared and refilled immediately.
+     *
+     * @param stateMachineHandle The handle of the state machine to notify.
+     * @param fit The fit mode of the artboard.
+     * @param surfaceWidth The width of the surface the artboard is drawn to.
+     * @param surfaceHeight The height of the surface the artboard is drawn to.
+     * @param batch The events to deliver, with coordinates in surface space. Empty batches are
+     *    ignored.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun pointerEvents(
+        stateMachineHandle: StateMachineHandle,
+        fit: Fit,
+        surfaceWidth: Float,
+        surfaceHeight: Float,
+        batch: PointerEventBatch
+    ) {
+        val pointer = requireNativePointer()
+        if (batch.isEmpty) {
+            return
+        }
+        bridge.cppPointerEvents(
+            pointer,
+            stateMachineHandle.handle,
+            fit.nativeMapping,
+            fit.alignment.nativeMapping,
+            fit.scaleFactor,
+            surfaceWidth,
+            surfaceHeight,
+            batch.samples,
+            batch.size
+        )
+    }
+
     /**
      * Resizes an artboard to match the dimensions of the given surface.
      *
@@ -3167,11 +3783,24 @@ class CommandQueue internal constructor(
     /**
      * Draw the artboard with the given state machine.
      *
+     * The draw is skipped, with no GPU work or present, when the surface already shows its frame:
+     * the state machine has settled, and no view model property, pointer event, artboard resize,
+     * or asset change has reached the command server since the surface was last drawn with the
+     * same parameters and size. Skips are counted in [FramePipelineStats.skippedFrames].
+     *
      * @param artboardHandle The handle of the artboard to draw.
      * @param stateMachineHandle The handle of the state machine to use for drawing.
      * @param surface The surface to draw to.
      * @param fit The fit mode of the artboard.
      * @param clearColor The color to clear the surface with before drawing, in AARRGGBB format.
+     * @param pipelined Whether to defer presenting this frame until the surface's next draw. The
+     *    GPU finishes this frame while the command server handles the commands queued before the
+     *    next draw, which presents it before beginning its own, so the command server is not
+     *    blocked waiting on the display between frames. At most one frame per surface is
+     *    deferred, which adds up to a frame of latency. Suits continuously animating surfaces;
+     *    when drawing stops, the last frame is presented by the next [pollMessages] after one
+     *    without a draw, or by [presentPendingFrame]. See [RiveSurface.framePipelineStats] for the
+     *    effect.
      * @throws RiveResourceClosedException If this command queue has been disposed or [surface] has
      *    been closed.
      * @throws RiveIncompatibleResourceException If [surface] is owned by another command queue.
@@ -3185,11 +3814,15 @@ class CommandQueue internal constructor(
         stateMachineHandle: StateMachineHandle,
         surface: RiveSurface,
         fit: Fit,
-        clearColor: Int = Color.TRANSPARENT
+        clearColor: Int = Color.TRANSPARENT,
+        pipelined: Boolean = false
     ) {
         checkOpen()
         val surfaceNativePointer = surface.requireNativePointer()
         surface.requireOwnedBy(this)
+        if (pipelined) {
+            pipelinedSurfaces[surface] = true
+        }
         bridge.cppDraw(
             requireNativePointer(),
             renderContext.nativeObjectPointer,
@@ -3202,10 +3835,60 @@ class CommandQueue internal constructor(
             fit.nativeMapping,
             fit.alignment.nativeMapping,
             fit.scaleFactor,
-            clearColor
+            clearColor,
+            pipelined
         )
     }
 
+    /**
+     * Present the frame that a pipelined [draw] left waiting on [surface], if any.
+     *
+     * Pipelined frames are otherwise presented by the surface's next draw, or by polling once the
+     * surface stops drawing. Call this to show the last frame immediately instead.
+     *
+     * @param surface The surface to present.
+     * @throws RiveResourceClosedException If this command queue has been disposed or [surface] has
+     *    been closed.
+     * @throws RiveIncompatibleResourceException If [surface] is owned by another command queue.
+     */
+    @Throws(
+        RiveResourceClosedException::class,
+        RiveIncompatibleResourceException::class
+    )
+    fun presentPendingFrame(surface: RiveSurface) {
+        checkOpen()
+        val surfaceNativePointer = surface.requireNativePointer()
+        surface.requireOwnedBy(this)
+        bridge.cppPresentPendingFrame(
+            requireNativePointer(),
+            renderContext.nativeObjectPointer,
+            surfaceNativePointer
+        )
+    }
+
+    /**
+     * Per-stage times of the frames most recently drawn by [draw], across all of this command
+     * queue's surfaces. Draws skipped because their scene was unchanged are not counted.
+     *
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    val frameTimingStats: FrameTimingStats
+        @Throws(RiveResourceClosedException::class)
+        get() = FrameTimingStats.fromArray(bridge.cppFrameTimingStats(requireNativePointer()))
+
+    /**
+     * Copy the times of the most recent frames drawn by [draw] into [records], oldest first, as
+     * [FrameTimingStats.RECORD_FIELDS] values per frame. Copies as many as fit, up to
+     * [FrameTimingStats.MAX_RECORDS], so one array can be reused for every copy.
+     *
+     * @param records The array to fill from the start.
+     * @return The number of frames copied.
+     * @throws RiveResourceClosedException If this command queue has been disposed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun copyFrameRecords(records: LongArray): Int =
+        bridge.cppCopyFrameRecords(requireNativePointer(), records)
+
     /**
      * Cancel a pending coalesced draw for the given draw key.
      *
@@ -3277,6 +3960,141 @@ class CommandQueue internal constructor(
         )
     }
 
+    /**
+     * Renders the current state of an artboard/state machine pair into an off-screen buffer, like
+     * [drawToBuffer], but returns once the draw is queued rather than when the pixels are ready.
+     *
+     * Each call is drawn in order with other commands, so it captures the state as of the call,
+     * and is never coalesced with other draws to [surface]. On OpenGL, the pixels are copied into
+     * one of a pair of pixel buffer objects and fenced, so that a copy overlaps with the next
+     * request's draw. Requests made together complete faster than the same number of
+     * [drawToBuffer] calls, which wait for every copy in turn.
+     *
+     * [onComplete] is called on the command server thread, in the order of the calls, with null
+     * once [buffer] holds the pixels or with the reason they could not be drawn. [buffer] must not
+     * be used until then. Keep [onComplete] short, since the command server waits for it.
+     *
+     * @param artboardHandle The handle of the artboard to draw.
+     * @param stateMachineHandle The handle of the state machine to advance/draw.
+     * @param surface The surface to draw to, likely created from [createImageSurface].
+     * @param buffer The byte array buffer to render into. Must be at least width * height * 4 bytes
+     *    in size.
+     * @param width The width of the buffer to render.
+     * @param height The height of the buffer to render.
+     * @param fit Fit to use when drawing.
+     * @param clearColor Clear color used prior to drawing, defaults to transparent.
+     * @param onComplete Called with null on success, or the exception describing the failure.
+     * @throws RiveDrawToBufferException If the dimensions are not positive or [buffer] is too
+     *    small.
+     * @throws RiveResourceClosedException If this command queue has been disposed or [surface] has
+     *    been closed.
+     * @throws RiveIncompatibleResourceException If [surface] is owned by another command queue.
+     */
+    @Throws(
+        RiveResourceClosedException::class,
+        RiveIncompatibleResourceException::class,
+        RiveDrawToBufferException::class
+    )
+    fun drawToBufferAsync(
+        artboardHandle: ArtboardHandle,
+        stateMachineHandle: StateMachineHandle,
+        surface: RiveSurface,
+        buffer: ByteArray,
+        width: Int,
+        height: Int,
+        fit: Fit = Fit.Contain(),
+        clearColor: Int = Color.TRANSPARENT,
+        onComplete: (RiveDrawToBufferException?) -> Unit
+    ) {
+        checkOpen()
+        val surfaceNativePointer = surface.requireNativePointer()
+        surface.requireOwnedBy(this)
+        bridge.cppDrawToBufferAsync(
+            requireNativePointer(),
+            renderContext.nativeObjectPointer,
+            surfaceNativePointer,
+            surface.drawKey.handle,
+            artboardHandle.handle,
+            stateMachineHandle.handle,
+            width,
+            height,
+            fit.nativeMapping,
+            fit.alignment.nativeMapping,
+            fit.scaleFactor,
+            clearColor,
+            buffer
+        ) { error -> onComplete(error?.let { RiveDrawToBufferException(it) }) }
+    }
+
+    /**
+     * Renders the current state of an artboard/state machine pair into a direct [ByteBuffer], like
+     * the [ByteArray] overload of [drawToBufferAsync], for continuous offscreen capture.
+     *
+     * Allocate [buffer] once with [ByteBuffer.allocateDirect] and reuse it for every frame. Its
+     * memory is outside the Java heap, so the pixels are written straight into it on the command
+     * server thread, without the pinning and copy-back of a [ByteArray] or any allocation per
+     * frame. On OpenGL they are copied once, from the mapped pixel buffer object. On Vulkan, which
+     * has no asynchronous readback, they are read synchronously into [buffer] as the request is
+     * drawn. The pixels are written as RGBA bytes starting at index 0, regardless of the buffer's
+     * position, limit, or byte order, which are left unchanged.
+     *
+     * [onComplete] is called on the command server thread, in the order of the calls, with null
+     * once [buffer] holds the pixels or with the reason they could not be drawn. [buffer] must not
+     * be read or requested again until then. Keep [onComplete] short, since the command server
+     * waits for it.
+     *
+     * @param artboardHandle The handle of the artboard to draw.
+     * @param stateMachineHandle The handle of the state machine to advance/draw.
+     * @param surface The surface to draw to, likely created from [createImageSurface].
+     * @param buffer The direct buffer to render into. Must have a capacity of at least width *
+     *    height * 4 bytes.
+     * @param width The width of the buffer to render.
+     * @param height The height of the buffer to render.
+     * @param fit Fit to use when drawing.
+     * @param clearColor Clear color used prior to drawing, defaults to transparent.
+     * @param onComplete Called with null on success, or the exception describing the failure.
+     * @throws RiveDrawToBufferException If the dimensions are not positive, or [buffer] is not
+     *    direct or is too small.
+     * @throws RiveResourceClosedException If this command queue has been disposed or [surface] has
+     *    been closed.
+     * @throws RiveIncompatibleResourceException If [surface] is owned by another command queue.
+     */
+    @Throws(
+        RiveResourceClosedException::class,
+        RiveIncompatibleResourceException::class,
+        RiveDrawToBufferException::class
+    )
+    fun drawToBufferAsync(
+        artboardHandle: ArtboardHandle,
+        stateMachineHandle: StateMachineHandle,
+        surface: RiveSurface,
+        buffer: ByteBuffer,
+        width: Int,
+        height: Int,
+        fit: Fit = Fit.Contain(),
+        clearColor: Int = Color.TRANSPARENT,
+        onComplete: (RiveDrawToBufferException?) -> Unit
+    ) {
+        checkOpen()
+        val surfaceNativePointer = surface.requireNativePointer()
+        surface.requireOwnedBy(this)
+        bridge.cppDrawToDirectBufferAsync(
+            requireNativePointer(),
+            renderContext.nativeObjectPointer,
+            surfaceNativePointer,
+            surface.drawKey.handle,
+            artboardHandle.handle,
+            stateMachineHandle.handle,
+            width,
+            height,
+            fit.nativeMapping,
+            fit.alignment.nativeMapping,
+            fit.scaleFactor,
+            clearColor,
+            buffer
+        ) { error -> onComplete(error?.let { RiveDrawToBufferException(it) }) }
+    }
+
     /**
      * Enqueue arbitrary Kotlin code to be run on the command server thread.
      *
@@ -3313,6 +4131,42 @@ class CommandQueue internal constructor(
      */
     private val pendingResourceCleanups = ConcurrentHashMap<Long, (Any) -> Unit>()
 
+    /**
+     * Completes asynchronous startup, called once by [CommandQueueStartup] when both this command
+     * queue and the startup result exist.
+     *
+     * On failure, requests waiting on the command server are failed with [failure], as are later
+     * ones, since it will never serve them. [listener] is then notified on the main thread.
+     *
+     * @param failure Why the command server could not start, or `null` if it started.
+     * @param listener The listener passed to the constructor.
+     */
+    internal fun onStartupComplete(
+        failure: RiveInitializationException?,
+        listener: CommandQueueStartupListener
+    ) {
+        if (failure == null) {
+            RiveLog.d(COMMAND_QUEUE_TAG) { "Command server started" }
+        } else {
+            RiveLog.e(COMMAND_QUEUE_TAG, failure) { "Command server failed to start" }
+            startupFailure = failure
+        }
+        runOrDispatchOnMain(
+            context = EmptyCoroutineContext,
+            onFailure = { t ->
+                RiveLog.e(COMMAND_QUEUE_TAG, t) { "Failed to deliver command queue startup" }
+            }
+        ) {
+            if (failure != null) {
+                pendingContinuations.values.toList().forEach { it.resumeWithException(failure) }
+                pendingContinuations.clear()
+                // No resources were created, so there is nothing to clean up.
+                pendingResourceCleanups.clear()
+            }
+            listener.onStartupComplete(failure)
+        }
+    }
+
     /**
      * Cancels all pending native requests because command queue disposal prevents any later JNI
      * callback from completing them.
@@ -3506,6 +4360,7 @@ class CommandQueue internal constructor(
                 return@runOrDispatchOnMain // Cancellation happened before submission was scheduled.
             }
 
+            startupFailure?.let { throw it }
             @Suppress("UNCHECKED_CAST")
             pendingContinuations[requestID] = cont as CancellableContinuation<Any>
             pendingResourceCleanups[requestID] = cleanupOnce
@@ -3537,6 +4392,7 @@ class CommandQueue internal constructor(
         crossinline nativeFn: (Long) -> Unit
     ): T = withContext(Dispatchers.Main.immediate) { // Ensure we're on the main thread
         suspendCancellableCoroutine { cont ->
+            startupFailure?.let { throw it }
             val requestID = nextRequestID.getAndIncrement()
 
             // Store the continuation
@@ -3557,6 +4413,12 @@ class CommandQueue internal constructor(
             }
         }
     }
+
+    // Last, so that a startup result that has already arrived is delivered to a fully
+    // initialized command queue.
+    init {
+        startup?.attach(this)
+    }
 }
 
 /**
@@ -3640,6 +4502,23 @@ value class FontHandle(val handle: Long) {
     override fun toString(): String = "FontHandle($handle)"
 }
 
+/**
+ * A view model instance property resolved for repeated access. Created with
+ * [CommandQueue.resolveProperty] and released with [CommandQueue.releaseProperty] or by deleting
+ * its view model instance.
+ *
+ * @param handle The handle issued by the native CommandQueue.
+ * @param viewModelInstanceHandle The view model instance the property belongs to.
+ * @param path The slash delimited path of the property.
+ */
+class PropertyHandle internal constructor(
+    val handle: Long,
+    val viewModelInstanceHandle: ViewModelInstanceHandle,
+    val path: String
+) {
+    override fun toString(): String = "PropertyHandle($handle, $viewModelInstanceHandle, $path)"
+}
+
 data class DefaultViewModelInfo(
     val viewModelName: String,
     val instanceName: String
@@ -1,6 +1,8 @@
 package app.rive.core
 
 import app.rive.RiveInitializationException
+import dalvik.annotation.optimization.FastNative
+import java.nio.ByteBuffer
 
 /**
  * Abstraction of calls to the native command queue.
@@ -10,14 +12,20 @@ import app.rive.RiveInitializationException
 interface CommandQueueBridge {
     @Throws(RiveInitializationException::class)
     fun cppConstructor(renderContextPointer: Long): Long
+    fun cppConstructorAsync(renderContextPointer: Long, startup: CommandQueueStartup): Long
     fun cppDelete(pointer: Long)
     fun cppCreateListeners(pointer: Long, receiver: CommandQueue): Listeners
 
     fun cppPollMessages(pointer: Long)
+    fun cppSetMessageBuffer(pointer: Long, buffer: ByteBuffer?)
     fun cppSetTracingEnabled(pointer: Long, enabled: Boolean)
     fun isCurrentThreadCommandServer(pointer: Long): Boolean
 
     fun cppLoadFile(pointer: Long, requestID: Long, bytes: ByteArray): Long
+    fun cppCopyFileBytes(buffer: ByteBuffer, position: Int, length: Int): Long
+    fun cppMapFileBytes(fd: Int, offset: Long, length: Long): Long
+    fun cppDeleteFileBytes(fileBytes: Long)
+    fun cppLoadFileBytes(pointer: Long, requestID: Long, fileBytes: Long): Long
     fun cppDeleteFile(pointer: Long, requestID: Long, fileHandle: Long)
 
     fun cppGetArtboardNames(
@@ -118,6 +126,15 @@ interface CommandQueueBridge {
         deltaTimeNs: Long
     )
 
+    fun cppAdvanceStateMachines(
+        pointer: Long,
+        requestID: Long,
+        handles: LongArray,
+        count: Int,
+        deltaTimeNs: Long,
+        parallel: Boolean
+    )
+
     fun cppNamedVMCreateBlankVMI(
         pointer: Long,
         requestID: Long,
@@ -278,6 +295,21 @@ interface CommandQueueBridge {
         propertyPath: String
     )
 
+    fun cppResolveProperty(
+        pointer: Long,
+        viewModelInstanceHandle: Long,
+        propertyPath: String
+    ): Long
+
+    fun cppReleaseProperty(pointer: Long, propertyHandle: Long)
+    fun cppSetNumberPropertyByHandle(pointer: Long, propertyHandle: Long, value: Float)
+    fun cppSetStringPropertyByHandle(pointer: Long, propertyHandle: Long, value: String)
+    fun cppSetBooleanPropertyByHandle(pointer: Long, propertyHandle: Long, value: Boolean)
+    fun cppSetEnumPropertyByHandle(pointer: Long, propertyHandle: Long, value: String)
+    fun cppSetColorPropertyByHandle(pointer: Long, propertyHandle: Long, value: Int)
+    fun cppFireTriggerPropertyByHandle(pointer: Long, propertyHandle: Long)
+    fun cppApplyPropertyBatch(pointer: Long, batch: ByteArray, length: Int)
+
     fun cppSubscribeToProperty(
         pointer: Long,
         viewModelInstanceHandle: Long,
@@ -429,6 +461,18 @@ interface CommandQueueBridge {
         y: Float
     )
 
+    fun cppPointerEvents(
+        pointer: Long,
+        stateMachineHandle: Long,
+        fit: Byte,
+        alignment: Byte,
+        layoutScale: Float,
+        surfaceWidth: Float,
+        surfaceHeight: Float,
+        samples: FloatArray,
+        count: Int
+    )
+
     fun cppResizeArtboard(
         pointer: Long,
         artboardHandle: Long,
@@ -462,10 +506,19 @@ interface CommandQueueBridge {
         fit: Byte,
         alignment: Byte,
         scaleFactor: Float,
-        clearColor: Int
+        clearColor: Int,
+        pipelined: Boolean
+    )
+
+    fun cppPresentPendingFrame(
+        pointer: Long,
+        renderContextPointer: Long,
+        surfaceNativePointer: Long
     )
 
     fun cppCancelDraw(pointer: Long, drawKey: Long)
+    fun cppFrameTimingStats(pointer: Long): LongArray
+    fun cppCopyFrameRecords(pointer: Long, records: LongArray): Int
 
     fun cppDrawToBuffer(
         pointer: Long,
@@ -483,20 +536,63 @@ interface CommandQueueBridge {
         buffer: ByteArray
     )
 
+    fun cppDrawToBufferAsync(
+        pointer: Long,
+        renderContextPointer: Long,
+        surfaceNativePointer: Long,
+        drawKey: Long,
+        artboardHandle: Long,
+        stateMachineHandle: Long,
+        width: Int,
+        height: Int,
+        fit: Byte,
+        alignment: Byte,
+        scaleFactor: Float,
+        clearColor: Int,
+        buffer: ByteArray,
+        onComplete: (String?) -> Unit
+    )
+
+    fun cppDrawToDirectBufferAsync(
+        pointer: Long,
+        renderContextPointer: Long,
+        surfaceNativePointer: Long,
+        drawKey: Long,
+        artboardHandle: Long,
+        stateMachineHandle: Long,
+        width: Int,
+        height: Int,
+        fit: Byte,
+        alignment: Byte,
+        scaleFactor: Float,
+        clearColor: Int,
+        buffer: ByteBuffer,
+        onComplete: (String?) -> Unit
+    )
+
     fun cppRunOnCommandServer(pointer: Long, work: () -> Unit)
 }
 
 /** Concrete JNI bridge implementation of [CommandQueueBridge]. */
 internal class CommandQueueJNIBridge : CommandQueueBridge {
     external override fun cppConstructor(renderContextPointer: Long): Long
+    external override fun cppConstructorAsync(
+        renderContextPointer: Long,
+        startup: CommandQueueStartup
+    ): Long
     external override fun cppDelete(pointer: Long)
     external override fun cppCreateListeners(pointer: Long, receiver: CommandQueue): Listeners
 
     external override fun cppPollMessages(pointer: Long)
+    external override fun cppSetMessageBuffer(pointer: Long, buffer: ByteBuffer?)
     external override fun cppSetTracingEnabled(pointer: Long, enabled: Boolean)
     external override fun isCurrentThreadCommandServer(pointer: Long): Boolean
 
     external override fun cppLoadFile(pointer: Long, requestID: Long, bytes: ByteArray): Long
+    external override fun cppCopyFileBytes(buffer: ByteBuffer, position: Int, length: Int): Long
+    external override fun cppMapFileBytes(fd: Int, offset: Long, length: Long): Long
+    external override fun cppDeleteFileBytes(fileBytes: Long)
+    external override fun cppLoadFileBytes(pointer: Long, requestID: Long, fileBytes: Long): Long
     external override fun cppDeleteFile(
         pointer: Long,
         requestID: Long,
@@ -594,6 +690,7 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         stateMachineHandle: Long
     )
 
+    @FastNative
     external override fun cppAdvanceStateMachine(
         pointer: Long,
         requestID: Long,
@@ -601,6 +698,15 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         deltaTimeNs: Long
     )
 
+    external override fun cppAdvanceStateMachines(
+        pointer: Long,
+        requestID: Long,
+        handles: LongArray,
+        count: Int,
+        deltaTimeNs: Long,
+        parallel: Boolean
+    )
+
     external override fun cppNamedVMCreateBlankVMI(
         pointer: Long,
         requestID: Long,
@@ -685,6 +791,7 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         viewModelInstanceHandle: Long
     )
 
+    @FastNative
     external override fun cppSetNumberProperty(
         pointer: Long,
         viewModelInstanceHandle: Long,
@@ -713,6 +820,7 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         propertyPath: String
     )
 
+    @FastNative
     external override fun cppSetBooleanProperty(
         pointer: Long,
         viewModelInstanceHandle: Long,
@@ -727,6 +835,7 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         propertyPath: String
     )
 
+    @FastNative
     external override fun cppSetEnumProperty(
         pointer: Long,
         viewModelInstanceHandle: Long,
@@ -741,6 +850,7 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         propertyPath: String
     )
 
+    @FastNative
     external override fun cppSetColorProperty(
         pointer: Long,
         viewModelInstanceHandle: Long,
@@ -755,12 +865,60 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         propertyPath: String
     )
 
+    @FastNative
     external override fun cppFireTriggerProperty(
         pointer: Long,
         viewModelInstanceHandle: Long,
         propertyPath: String
     )
 
+    external override fun cppResolveProperty(
+        pointer: Long,
+        viewModelInstanceHandle: Long,
+        propertyPath: String
+    ): Long
+
+    external override fun cppReleaseProperty(pointer: Long, propertyHandle: Long)
+
+    @FastNative
+    external override fun cppSetNumberPropertyByHandle(
+        pointer: Long,
+        propertyHandle: Long,
+        value: Float
+    )
+
+    external override fun cppSetStringPropertyByHandle(
+        pointer: Long,
+        propertyHandle: Long,
+        value: String
+    )
+
+    @FastNative
+    external override fun cppSetBooleanPropertyByHandle(
+        pointer: Long,
+        propertyHandle: Long,
+        value: Boolean
+    )
+
+    external override fun cppSetEnumPropertyByHandle(
+        pointer: Long,
+        propertyHandle: Long,
+        value: String
+    )
+
+    @FastNative
+    external override fun cppSetColorPropertyByHandle(
+        pointer: Long,
+        propertyHandle: Long,
+        value: Int
+    )
+
+    @FastNative
+    external override fun cppFireTriggerPropertyByHandle(pointer: Long, propertyHandle: Long)
+
+    @FastNative
+    external override fun cppApplyPropertyBatch(pointer: Long, batch: ByteArray, length: Int)
+
     external override fun cppSubscribeToProperty(
         pointer: Long,
         viewModelInstanceHandle: Long,
@@ -860,6 +1018,7 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
     )
 
     external override fun cppUnregisterFont(pointer: Long, name: String)
+    @FastNative
     external override fun cppPointerMove(
         pointer: Long,
         stateMachineHandle: Long,
@@ -873,6 +1032,7 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         y: Float
     )
 
+    @FastNative
     external override fun cppPointerDown(
         pointer: Long,
         stateMachineHandle: Long,
@@ -886,6 +1046,7 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         y: Float
     )
 
+    @FastNative
     external override fun cppPointerUp(
         pointer: Long,
         stateMachineHandle: Long,
@@ -899,6 +1060,7 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         y: Float
     )
 
+    @FastNative
     external override fun cppPointerExit(
         pointer: Long,
         stateMachineHandle: Long,
@@ -912,6 +1074,19 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         y: Float
     )
 
+    @FastNative
+    external override fun cppPointerEvents(
+        pointer: Long,
+        stateMachineHandle: Long,
+        fit: Byte,
+        alignment: Byte,
+        layoutScale: Float,
+        surfaceWidth: Float,
+        surfaceHeight: Float,
+        samples: FloatArray,
+        count: Int
+    )
+
     external override fun cppResizeArtboard(
         pointer: Long,
         artboardHandle: Long,
@@ -945,10 +1120,19 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         fit: Byte,
         alignment: Byte,
         scaleFactor: Float,
-        clearColor: Int
+        clearColor: Int,
+        pipelined: Boolean
+    )
+
+    external override fun cppPresentPendingFrame(
+        pointer: Long,
+        renderContextPointer: Long,
+        surfaceNativePointer: Long
     )
 
     external override fun cppCancelDraw(pointer: Long, drawKey: Long)
+    external override fun cppFrameTimingStats(pointer: Long): LongArray
+    external override fun cppCopyFrameRecords(pointer: Long, records: LongArray): Int
 
     external override fun cppDrawToBuffer(
         pointer: Long,
@@ -966,5 +1150,39 @@ internal class CommandQueueJNIBridge : CommandQueueBridge {
         buffer: ByteArray
     )
 
+    external override fun cppDrawToBufferAsync(
+        pointer: Long,
+        renderContextPointer: Long,
+        surfaceNativePointer: Long,
+        drawKey: Long,
+        artboardHandle: Long,
+        stateMachineHandle: Long,
+        width: Int,
+        height: Int,
+        fit: Byte,
+        alignment: Byte,
+        scaleFactor: Float,
+        clearColor: Int,
+        buffer: ByteArray,
+        onComplete: (String?) -> Unit
+    )
+
+    external override fun cppDrawToDirectBufferAsync(
+        pointer: Long,
+        renderContextPointer: Long,
+        surfaceNativePointer: Long,
+        drawKey: Long,
+        artboardHandle: Long,
+        stateMachineHandle: Long,
+        width: Int,
+        height: Int,
+        fit: Byte,
+        alignment: Byte,
+        scaleFactor: Float,
+        clearColor: Int,
+        buffer: ByteBuffer,
+        onComplete: (String?) -> Unit
+    )
+
     external override fun cppRunOnCommandServer(pointer: Long, work: () -> Unit)
 }
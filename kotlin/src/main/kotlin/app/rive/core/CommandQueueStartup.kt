@@ -0,0 +1,68 @@
+package app.rive.core
+
+import androidx.annotation.Keep
+import app.rive.RiveInitializationException
+
+/**
+ * Receives the result of starting a [CommandQueue] created without waiting for its command server.
+ * See the `startupListener` constructor of [CommandQueue].
+ */
+fun interface CommandQueueStartupListener {
+    /**
+     * Called on the main thread once the command server has started or failed to start.
+     *
+     * @param failure `null` if the command server started, otherwise why it could not.
+     */
+    fun onStartupComplete(failure: RiveInitializationException?)
+}
+
+/**
+ * Pairs a native startup result, reported from the command server thread, with the [CommandQueue]
+ * it belongs to. Either may arrive first: the result can be reported before the command queue's
+ * constructor has finished.
+ *
+ * @param listener The listener to notify once both have arrived.
+ */
+@Keep // Passed to JNI
+class CommandQueueStartup internal constructor(
+    private val listener: CommandQueueStartupListener
+) {
+    private var commandQueue: CommandQueue? = null
+    private var result: Result<Unit>? = null
+
+    /** Attaches the constructed command queue, delivering the result if it has already arrived. */
+    internal fun attach(commandQueue: CommandQueue) = deliverWhenReady {
+        this.commandQueue = commandQueue
+    }
+
+    /**
+     * Called from JNI on the command server thread with the startup result.
+     *
+     * @param success Whether the command server started.
+     * @param errorCode The EGL or Vulkan error code on failure.
+     * @param message A description of the result.
+     */
+    @Keep // Called from JNI
+    @JvmName("onResult")
+    internal fun onResult(success: Boolean, errorCode: Int, message: String) = deliverWhenReady {
+        result = if (success) {
+            Result.success(Unit)
+        } else {
+            Result.failure(
+                RiveInitializationException(
+                    "CommandQueue startup failed (EGL 0x%04x): %s".format(errorCode, message)
+                )
+            )
+        }
+    }
+
+    private fun deliverWhenReady(update: () -> Unit) {
+        val (queue, failure) = synchronized(this) {
+            update()
+            val queue = commandQueue ?: return
+            val result = result ?: return
+            queue to result.exceptionOrNull() as RiveInitializationException?
+        }
+        queue.onStartupComplete(failure, listener)
+    }
+}
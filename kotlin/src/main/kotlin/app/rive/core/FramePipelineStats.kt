@@ -0,0 +1,78 @@
+package app.rive.core
+
+/**
+ * Frame counters for one [RiveSurface], covering both direct and pipelined draws. See the
+ * `pipelined` parameter of [CommandQueue.draw].
+ *
+ * Draw time is the command server's time spent in one draw: recording and flushing, plus
+ * presenting for direct frames. Pipelined frames defer their present to the surface's next draw,
+ * so their mean draw time excludes any time blocked on the display, and [throughputGain] compares
+ * the two. [meanAddedLatencyNanos] is the price: how long pipelined frames waited between their
+ * flush and their present.
+ *
+ * Draws that would repeat the frame the surface already shows are skipped and counted in
+ * [skippedFrames]. See [CommandQueue.draw] for when a scene counts as unchanged.
+ *
+ * @property directFrames Frames drawn and presented in the same draw.
+ * @property directDrawNanos Total command server time in direct draws.
+ * @property pipelinedFrames Frames drawn with their present deferred.
+ * @property pipelinedDrawNanos Total command server time in pipelined draws.
+ * @property presents Frames presented, of either kind.
+ * @property presentNanos Total time the command server was blocked presenting.
+ * @property deferredPresents Pipelined frames presented so far.
+ * @property addedLatencyNanos Total time pipelined frames waited between flush and present.
+ * @property skippedFrames Draws skipped because the surface already showed their frame.
+ */
+data class FramePipelineStats(
+    val directFrames: Long,
+    val directDrawNanos: Long,
+    val pipelinedFrames: Long,
+    val pipelinedDrawNanos: Long,
+    val presents: Long,
+    val presentNanos: Long,
+    val deferredPresents: Long,
+    val addedLatencyNanos: Long,
+    val skippedFrames: Long,
+) {
+    /** The mean command server time of a direct draw. */
+    val meanDirectDrawNanos: Long
+        get() = if (directFrames == 0L) 0L else directDrawNanos / directFrames
+
+    /** The mean command server time of a pipelined draw. */
+    val meanPipelinedDrawNanos: Long
+        get() = if (pipelinedFrames == 0L) 0L else pipelinedDrawNanos / pipelinedFrames
+
+    /** The mean time blocked in one present. */
+    val meanPresentNanos: Long
+        get() = if (presents == 0L) 0L else presentNanos / presents
+
+    /** The mean time a pipelined frame waited between its flush and its present. */
+    val meanAddedLatencyNanos: Long
+        get() = if (deferredPresents == 0L) 0L else addedLatencyNanos / deferredPresents
+
+    /**
+     * How many pipelined frames the command server can draw in the time of one direct frame, or 0
+     * until both kinds have been drawn.
+     */
+    val throughputGain: Double
+        get() = if (meanDirectDrawNanos == 0L || meanPipelinedDrawNanos == 0L) {
+            0.0
+        } else {
+            meanDirectDrawNanos.toDouble() / meanPipelinedDrawNanos
+        }
+
+    internal companion object {
+        /** Matches the order in `cppFramePipelineStats`. */
+        fun fromArray(stats: LongArray) = FramePipelineStats(
+            directFrames = stats[0],
+            directDrawNanos = stats[1],
+            pipelinedFrames = stats[2],
+            pipelinedDrawNanos = stats[3],
+            presents = stats[4],
+            presentNanos = stats[5],
+            deferredPresents = stats[6],
+            addedLatencyNanos = stats[7],
+            skippedFrames = stats[8],
+        )
+    }
+}
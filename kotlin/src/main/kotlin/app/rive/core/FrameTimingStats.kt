@@ -0,0 +1,92 @@
+package app.rive.core
+
+/**
+ * Percentiles of one frame stage's time, in nanoseconds, over recent frames.
+ *
+ * @property p50Nanos The median.
+ * @property p90Nanos The time 90% of frames were at or below.
+ * @property p99Nanos The time 99% of frames were at or below.
+ * @property maxNanos The slowest frame.
+ */
+data class FrameTimePercentiles(
+    val p50Nanos: Long,
+    val p90Nanos: Long,
+    val p99Nanos: Long,
+    val maxNanos: Long,
+)
+
+/**
+ * Per-stage frame times over the most recent [windowFrames] frames drawn, up to
+ * [MAX_RECORDS]. Frames drawn by a [CommandQueue] are counted across all of its surfaces.
+ *
+ * The stages are advancing the scene, recording the draw, flushing it to the GPU, and presenting.
+ * Queue wait is the time between the frame being requested and the render thread starting it.
+ * [total] is the render thread's time in the frame, excluding queue wait.
+ *
+ * For the raw times of each frame, use `copyFrameRecords`, which fills a [LongArray] with
+ * [RECORD_FIELDS] values per frame, at the `FIELD_` offsets.
+ *
+ * @property frames Frames drawn since creation.
+ * @property windowFrames Frames the percentiles cover.
+ * @property advance Time advancing the scene. A [CommandQueue] attributes its advances since the
+ *    previous frame to the next frame drawn.
+ * @property draw Time beginning the frame and recording its draw.
+ * @property flush Time flushing the frame to the GPU.
+ * @property present Time presenting or swapping. A pipelined frame presents the previous one.
+ * @property queueWait Time between the frame being requested and starting.
+ * @property total The sum of advance, draw, flush, and present.
+ * @property meanTotalNanos The mean [total] over the last complete batch of about a second's
+ *    frames, or 0 before the first.
+ * @property stdDevTotalNanos The standard deviation of [total] over the same frames.
+ */
+data class FrameTimingStats(
+    val frames: Long,
+    val windowFrames: Int,
+    val advance: FrameTimePercentiles,
+    val draw: FrameTimePercentiles,
+    val flush: FrameTimePercentiles,
+    val present: FrameTimePercentiles,
+    val queueWait: FrameTimePercentiles,
+    val total: FrameTimePercentiles,
+    val meanTotalNanos: Long,
+    val stdDevTotalNanos: Long,
+) {
+    companion object {
+        /** The most frame records kept, and so the most `copyFrameRecords` returns. */
+        const val MAX_RECORDS = 256
+
+        /** Values per frame record in a `copyFrameRecords` array. */
+        const val RECORD_FIELDS = 5
+
+        const val FIELD_ADVANCE = 0
+        const val FIELD_DRAW = 1
+        const val FIELD_FLUSH = 2
+        const val FIELD_PRESENT = 3
+        const val FIELD_QUEUE_WAIT = 4
+
+        /** Matches the order in `rive_android::FrameStatsSummaryToJava`. */
+        internal fun fromArray(stats: LongArray): FrameTimingStats {
+            fun percentiles(row: Int): FrameTimePercentiles {
+                val offset = 2 + row * 4
+                return FrameTimePercentiles(
+                    p50Nanos = stats[offset],
+                    p90Nanos = stats[offset + 1],
+                    p99Nanos = stats[offset + 2],
+                    maxNanos = stats[offset + 3],
+                )
+            }
+            return FrameTimingStats(
+                frames = stats[0],
+                windowFrames = stats[1].toInt(),
+                advance = percentiles(FIELD_ADVANCE),
+                draw = percentiles(FIELD_DRAW),
+                flush = percentiles(FIELD_FLUSH),
+                present = percentiles(FIELD_PRESENT),
+                queueWait = percentiles(FIELD_QUEUE_WAIT),
+                total = percentiles(RECORD_FIELDS),
+                meanTotalNanos = stats[2 + (RECORD_FIELDS + 1) * 4],
+                stdDevTotalNanos = stats[3 + (RECORD_FIELDS + 1) * 4],
+            )
+        }
+    }
+}
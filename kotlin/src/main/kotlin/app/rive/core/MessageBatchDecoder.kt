@@ -0,0 +1,187 @@
+package app.rive.core
+
+import app.rive.RiveLog
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
+/**
+ * Decodes command queue messages that native code packs into a shared direct [ByteBuffer] when
+ * message batching is enabled with [CommandQueue.setMessageBatchingEnabled].
+ *
+ * Instead of one JNI upcall per message, the native listeners append tagged records to [buffer]
+ * and deliver them with a single `onMessageBatch` upcall. Each record is a one byte tag followed by
+ * its fields in native byte order without padding: request IDs and handles as 8 byte longs, floats
+ * and ints as 4 bytes, booleans as 1 byte, and strings as a 4 byte length followed by UTF-8 bytes.
+ *
+ * Only messages made up of scalars and strings are batched. Messages carrying lists are still
+ * delivered through their own callbacks, after any batched messages that preceded them.
+ *
+ * The tags are the ordinals of `JCommandQueue::Callback` in `bindings_command_queue.cpp` and the
+ * layout matches `helpers/message_batch.hpp`. Both must be kept in sync with this class.
+ *
+ * @param capacity Size of [buffer] in bytes. Messages that do not fit, such as very long strings,
+ *    fall back to individual callbacks.
+ */
+internal class MessageBatchDecoder(capacity: Int = DEFAULT_CAPACITY) {
+    /** The buffer shared with native code. Only read during [decode]. */
+    val buffer: ByteBuffer = ByteBuffer.allocateDirect(capacity).order(ByteOrder.nativeOrder())
+
+    /** Reused for string decoding to avoid a temporary array per string. */
+    private var scratch = ByteArray(SCRATCH_INITIAL_SIZE)
+
+    /**
+     * Decodes all records in the first [size] bytes of [buffer], dispatching each to the matching
+     * callback on [receiver]. Runs on the polling thread, within [CommandQueue.pollMessages].
+     *
+     * @param size Number of bytes written by native code.
+     * @param receiver The command queue whose callbacks should receive the messages.
+     */
+    fun decode(size: Int, receiver: CommandQueue) {
+        buffer.clear()
+        buffer.limit(size)
+        while (buffer.hasRemaining()) {
+            when (val tag = buffer.get().toInt()) {
+                TAG_FILE_ERROR -> receiver.onFileError(buffer.long, string())
+                TAG_ARTBOARD_INSTANTIATED ->
+                    receiver.onArtboardInstantiated(buffer.long, ArtboardHandle(buffer.long))
+
+                TAG_VIEW_MODEL_INSTANCE_INSTANTIATED ->
+                    receiver.onViewModelInstanceInstantiated(
+                        buffer.long,
+                        ViewModelInstanceHandle(buffer.long)
+                    )
+
+                TAG_FILE_LOADED -> receiver.onFileLoaded(buffer.long, FileHandle(buffer.long))
+                TAG_ARTBOARD_ERROR -> receiver.onArtboardError(buffer.long, string())
+                TAG_STATE_MACHINE_INSTANTIATED ->
+                    receiver.onStateMachineInstantiated(
+                        buffer.long,
+                        StateMachineHandle(buffer.long)
+                    )
+
+                TAG_ARTBOARD_VOLUME_RECEIVED ->
+                    receiver.onArtboardVolumeReceived(buffer.long, buffer.float)
+
+                TAG_DEFAULT_VIEW_MODEL_INFO_RECEIVED ->
+                    receiver.onDefaultViewModelInfoReceived(buffer.long, string(), string())
+
+                TAG_STATE_MACHINE_ERROR -> receiver.onStateMachineError(buffer.long, string())
+                TAG_STATE_MACHINE_SETTLED ->
+                    receiver.onStateMachineSettled(buffer.long, StateMachineHandle(buffer.long))
+
+                TAG_VIEW_MODEL_INSTANCE_ERROR ->
+                    receiver.onViewModelInstanceError(buffer.long, string())
+
+                TAG_VIEW_MODEL_INSTANCE_VIEW_MODEL_NAME_RECEIVED ->
+                    receiver.onViewModelInstanceViewModelNameReceived(buffer.long, string())
+
+                TAG_VIEW_MODEL_INSTANCE_NAME_RECEIVED ->
+                    receiver.onViewModelInstanceNameReceived(buffer.long, string())
+
+                TAG_NUMBER_PROPERTY_UPDATED -> receiver.onNumberPropertyUpdated(
+                    buffer.long,
+                    ViewModelInstanceHandle(buffer.long),
+                    string(),
+                    buffer.float
+                )
+
+                TAG_STRING_PROPERTY_UPDATED -> receiver.onStringPropertyUpdated(
+                    buffer.long,
+                    ViewModelInstanceHandle(buffer.long),
+                    string(),
+                    string()
+                )
+
+                TAG_BOOLEAN_PROPERTY_UPDATED -> receiver.onBooleanPropertyUpdated(
+                    buffer.long,
+                    ViewModelInstanceHandle(buffer.long),
+                    string(),
+                    buffer.get() != 0.toByte()
+                )
+
+                TAG_ENUM_PROPERTY_UPDATED -> receiver.onEnumPropertyUpdated(
+                    buffer.long,
+                    ViewModelInstanceHandle(buffer.long),
+                    string(),
+                    string()
+                )
+
+                TAG_COLOR_PROPERTY_UPDATED -> receiver.onColorPropertyUpdated(
+                    buffer.long,
+                    ViewModelInstanceHandle(buffer.long),
+                    string(),
+                    buffer.int
+                )
+
+                TAG_TRIGGER_PROPERTY_UPDATED -> receiver.onTriggerPropertyUpdated(
+                    buffer.long,
+                    ViewModelInstanceHandle(buffer.long),
+                    string()
+                )
+
+                TAG_VIEW_MODEL_LIST_SIZE_RECEIVED ->
+                    receiver.onViewModelListSizeReceived(buffer.long, buffer.int)
+
+                TAG_IMAGE_DECODED -> receiver.onImageDecoded(buffer.long, ImageHandle(buffer.long))
+                TAG_IMAGE_ERROR -> receiver.onImageError(buffer.long, string())
+                TAG_AUDIO_DECODED -> receiver.onAudioDecoded(buffer.long, AudioHandle(buffer.long))
+                TAG_AUDIO_ERROR -> receiver.onAudioError(buffer.long, string())
+                TAG_FONT_DECODED -> receiver.onFontDecoded(buffer.long, FontHandle(buffer.long))
+                TAG_FONT_ERROR -> receiver.onFontError(buffer.long, string())
+                else -> {
+                    // The layout of an unknown record is unknown, so the rest of the batch cannot
+                    // be decoded either.
+                    RiveLog.e(COMMAND_QUEUE_TAG) {
+                        "Unknown batched message tag $tag, dropping the remaining " +
+                                "${buffer.remaining()} bytes"
+                    }
+                    return
+                }
+            }
+        }
+    }
+
+    /** Reads a length-prefixed UTF-8 string at the current position. */
+    private fun string(): String {
+        val length = buffer.int
+        if (length > scratch.size) {
+            scratch = ByteArray(maxOf(length, scratch.size * 2))
+        }
+        buffer.get(scratch, 0, length)
+        return String(scratch, 0, length, Charsets.UTF_8)
+    }
+
+    internal companion object {
+        /** Large enough for a few thousand property updates per poll. */
+        const val DEFAULT_CAPACITY = 64 * 1024
+        private const val SCRATCH_INITIAL_SIZE = 256
+
+        // Ordinals of JCommandQueue::Callback. List callbacks (4-9 and 12) are never batched.
+        const val TAG_FILE_ERROR = 0
+        const val TAG_ARTBOARD_INSTANTIATED = 1
+        const val TAG_VIEW_MODEL_INSTANCE_INSTANTIATED = 2
+        const val TAG_FILE_LOADED = 3
+        const val TAG_ARTBOARD_ERROR = 10
+        const val TAG_STATE_MACHINE_INSTANTIATED = 11
+        const val TAG_ARTBOARD_VOLUME_RECEIVED = 13
+        const val TAG_DEFAULT_VIEW_MODEL_INFO_RECEIVED = 14
+        const val TAG_STATE_MACHINE_ERROR = 15
+        const val TAG_STATE_MACHINE_SETTLED = 16
+        const val TAG_VIEW_MODEL_INSTANCE_ERROR = 17
+        const val TAG_VIEW_MODEL_INSTANCE_VIEW_MODEL_NAME_RECEIVED = 18
+        const val TAG_VIEW_MODEL_INSTANCE_NAME_RECEIVED = 19
+        const val TAG_NUMBER_PROPERTY_UPDATED = 20
+        const val TAG_STRING_PROPERTY_UPDATED = 21
+        const val TAG_BOOLEAN_PROPERTY_UPDATED = 22
+        const val TAG_ENUM_PROPERTY_UPDATED = 23
+        const val TAG_COLOR_PROPERTY_UPDATED = 24
+        const val TAG_TRIGGER_PROPERTY_UPDATED = 25
+        const val TAG_VIEW_MODEL_LIST_SIZE_RECEIVED = 26
+        const val TAG_IMAGE_DECODED = 27
+        const val TAG_IMAGE_ERROR = 28
+        const val TAG_AUDIO_DECODED = 29
+        const val TAG_AUDIO_ERROR = 30
+        const val TAG_FONT_DECODED = 31
+        const val TAG_FONT_ERROR = 32
+    }
+}
@@ -0,0 +1,76 @@
+package app.rive.core
+
+/**
+ * A reusable, ordered list of pointer events to submit with [CommandQueue.pointerEvents].
+ *
+ * Events are packed as `(pointerID, x, y, action)` float quadruples so the whole batch crosses JNI
+ * as one array and is replayed as one command on the command server. Coordinates are in surface
+ * space, the same as the single-event calls such as [CommandQueue.pointerMove].
+ *
+ * Intended to be kept as a member and [clear]ed between input events, e.g. by adding every
+ * historical sample of a `MotionEvent`, so that steady-state input does not allocate.
+ *
+ * Not thread-safe. Fill and submit the batch from one thread.
+ *
+ * @param initialCapacity The number of events to reserve space for.
+ */
+class PointerEventBatch(initialCapacity: Int = DEFAULT_CAPACITY) {
+    internal companion object {
+        // Values must match PointerAction in bindings_command_queue.cpp.
+        const val ACTION_MOVE = 0f
+        const val ACTION_DOWN = 1f
+        const val ACTION_UP = 2f
+        const val ACTION_EXIT = 3f
+
+        /** The number of floats per packed event. */
+        const val STRIDE = 4
+
+        private const val DEFAULT_CAPACITY = 16
+    }
+
+    init {
+        require(initialCapacity > 0) { "initialCapacity must be positive, got $initialCapacity" }
+    }
+
+    /** The packed events. Only the first [size] × [STRIDE] floats are valid. */
+    internal var samples = FloatArray(initialCapacity * STRIDE)
+        private set
+
+    /** The number of events in the batch. */
+    var size: Int = 0
+        private set
+
+    /** Whether the batch has no events. */
+    val isEmpty: Boolean
+        get() = size == 0
+
+    /** Append a pointer move to [x], [y] for [pointerID]. */
+    fun move(pointerID: Int, x: Float, y: Float) = add(ACTION_MOVE, pointerID, x, y)
+
+    /** Append a pointer down at [x], [y] for [pointerID]. */
+    fun down(pointerID: Int, x: Float, y: Float) = add(ACTION_DOWN, pointerID, x, y)
+
+    /** Append a pointer up at [x], [y] for [pointerID]. */
+    fun up(pointerID: Int, x: Float, y: Float) = add(ACTION_UP, pointerID, x, y)
+
+    /** Append a pointer exit at [x], [y] for [pointerID]. */
+    fun exit(pointerID: Int, x: Float, y: Float) = add(ACTION_EXIT, pointerID, x, y)
+
+    /** Remove all events, keeping the allocated capacity for reuse. */
+    fun clear() {
+        size = 0
+    }
+
+    private fun add(action: Float, pointerID: Int, x: Float, y: Float) {
+        val offset = size * STRIDE
+        if (offset + STRIDE > samples.size) {
+            samples = samples.copyOf(samples.size * 2)
+        }
+        // Pointer IDs are small, so they are represented exactly as floats.
+        samples[offset] = pointerID.toFloat()
+        samples[offset + 1] = x
+        samples[offset + 2] = y
+        samples[offset + 3] = action
+        size++
+    }
+}
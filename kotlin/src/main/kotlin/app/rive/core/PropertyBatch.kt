@@ -0,0 +1,121 @@
+package app.rive.core
+
+import androidx.annotation.ColorInt
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
+/**
+ * A reusable set of view model property updates to apply together with
+ * [CommandQueue.applyPropertyBatch].
+ *
+ * The whole batch is sent as one command and applied in order within a single CommandServer step,
+ * so no advance or draw observes only part of it. Properties are addressed by [PropertyHandle]s
+ * from [CommandQueue.resolveProperty].
+ *
+ * Each update is packed as a one byte tag, the 8 byte property handle, and the value in native
+ * byte order without padding: numbers, colors, and enum indices as 4 bytes, booleans as 1 byte,
+ * strings as a 4 byte length followed by UTF-8 bytes, and triggers with no value. The tags and
+ * layout must be kept in sync with `applyPropertyBatch` in `bindings_command_queue.cpp`.
+ *
+ * Intended to be kept as a member and [clear]ed between updates, so that steady-state updates do
+ * not allocate beyond the string values themselves.
+ *
+ * Not thread-safe. Fill and submit the batch from one thread.
+ *
+ * @param initialCapacity The number of bytes to reserve.
+ */
+class PropertyBatch(initialCapacity: Int = DEFAULT_CAPACITY) {
+    internal companion object {
+        // Values must match PropertyBatchTag in bindings_command_queue.cpp.
+        const val TAG_NUMBER: Byte = 0
+        const val TAG_BOOLEAN: Byte = 1
+        const val TAG_COLOR: Byte = 2
+        const val TAG_ENUM_INDEX: Byte = 3
+        const val TAG_STRING: Byte = 4
+        const val TAG_TRIGGER: Byte = 5
+
+        /** Tag and property handle. */
+        private const val HEADER_SIZE = 1 + Long.SIZE_BYTES
+
+        private const val DEFAULT_CAPACITY = 256
+    }
+
+    init {
+        require(initialCapacity > 0) { "initialCapacity must be positive, got $initialCapacity" }
+    }
+
+    private var buffer = ByteBuffer.allocate(initialCapacity).order(ByteOrder.nativeOrder())
+
+    /** The packed updates. Only the first [byteSize] bytes are valid. */
+    internal val bytes: ByteArray
+        get() = buffer.array()
+
+    /** The number of packed bytes. */
+    internal val byteSize: Int
+        get() = buffer.position()
+
+    /** The number of updates in the batch. */
+    var size: Int = 0
+        private set
+
+    /** Whether the batch has no updates. */
+    val isEmpty: Boolean
+        get() = size == 0
+
+    /** Set a number property. */
+    fun setNumber(property: PropertyHandle, value: Float) {
+        header(TAG_NUMBER, property, Float.SIZE_BYTES).putFloat(value)
+    }
+
+    /** Set a boolean property. */
+    fun setBoolean(property: PropertyHandle, value: Boolean) {
+        header(TAG_BOOLEAN, property, 1).put((if (value) 1 else 0).toByte())
+    }
+
+    /** Set a color property to an AARRGGBB [ColorInt]. */
+    fun setColor(property: PropertyHandle, @ColorInt value: Int) {
+        header(TAG_COLOR, property, Int.SIZE_BYTES).putInt(value)
+    }
+
+    /**
+     * Set an enum property by the index of its value, avoiding a string for each update.
+     *
+     * @param index The index of the value within the enum's values.
+     */
+    fun setEnumIndex(property: PropertyHandle, index: Int) {
+        require(index >= 0) { "Enum index must not be negative, got $index" }
+        header(TAG_ENUM_INDEX, property, Int.SIZE_BYTES).putInt(index)
+    }
+
+    /** Set a string property. */
+    fun setString(property: PropertyHandle, value: String) {
+        val utf8 = value.encodeToByteArray()
+        header(TAG_STRING, property, Int.SIZE_BYTES + utf8.size).putInt(utf8.size).put(utf8)
+    }
+
+    /** Fire a trigger property. */
+    fun fireTrigger(property: PropertyHandle) {
+        header(TAG_TRIGGER, property, 0)
+    }
+
+    /** Remove all updates, keeping the allocated capacity for reuse. */
+    fun clear() {
+        buffer.clear()
+        size = 0
+    }
+
+    /** Reserve room for an update with [valueSize] bytes of value and write its header. */
+    private fun header(tag: Byte, property: PropertyHandle, valueSize: Int): ByteBuffer {
+        val needed = HEADER_SIZE + valueSize
+        if (buffer.remaining() < needed) {
+            val grown = ByteBuffer
+                .allocate(maxOf(buffer.capacity() * 2, buffer.position() + needed))
+                .order(ByteOrder.nativeOrder())
+            buffer.flip()
+            grown.put(buffer)
+            buffer = grown
+        }
+        size++
+        return buffer.put(tag).putLong(property.handle)
+    }
+}
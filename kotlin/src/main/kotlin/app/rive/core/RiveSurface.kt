@@ -61,6 +61,9 @@ abstract class RiveSurface internal constructor(
         @JvmStatic
         private external fun cppDeleteSurfaceNative(pointer: Long)
 
+        @JvmStatic
+        private external fun cppFramePipelineStats(surfacePointer: Long): LongArray
+
         @JvmStatic
         @WorkerThread
         private external fun cppResizeSurface(
@@ -113,6 +116,17 @@ abstract class RiveSurface internal constructor(
     override val closed: Boolean
         get() = closer.closed || nativePointer.closed
 
+    /**
+     * Frame counters for draws to this surface, including the latency and throughput effect of
+     * pipelined draws and the draws skipped while the scene was unchanged. The counters are
+     * updated by the command server as frames are drawn.
+     *
+     * @throws RiveResourceClosedException If this surface has been closed.
+     */
+    val framePipelineStats: FramePipelineStats
+        @Throws(RiveResourceClosedException::class)
+        get() = FramePipelineStats.fromArray(cppFramePipelineStats(requireNativePointer()))
+
     /**
      * Ensures this surface and its native pointer have not been closed.
      *
@@ -0,0 +1,207 @@
+package app.rive.core
+
+import android.content.res.Resources
+import androidx.annotation.VisibleForTesting
+import androidx.lifecycle.Lifecycle
+import app.rive.RenderBackend
+import app.rive.RiveFile
+import app.rive.RiveFileException
+import app.rive.RiveFileSource
+import app.rive.RiveInitializationException
+import app.rive.RiveLog
+import app.rive.RiveResourceClosedException
+import kotlinx.coroutines.coroutineScope
+import kotlinx.coroutines.launch
+import java.io.IOException
+import kotlin.coroutines.cancellation.CancellationException
+
+const val SHARDED_COMMAND_QUEUE_TAG = "Rive/ShardedCQ"
+
+/**
+ * A set of [CommandQueue]s, each with its own command server thread and render context, behind one
+ * facade that spreads Rive files across them.
+ *
+ * A single command queue runs every file's advancing and drawing on one thread. With several heavy,
+ * independent animations on screen, such as a feed of large files, that thread becomes the
+ * bottleneck while other cores sit idle. Sharding assigns each file to one of [shardCount] command
+ * queues so that unrelated files advance and draw concurrently.
+ *
+ * Routing is by file. [loadFile] assigns the file to the least loaded shard, and the returned
+ * [RiveFile] keeps that shard as its [RiveFile.riveWorker]. Artboards, state machines, and view
+ * model instances created from the file, and the surfaces that draw them, go through the same
+ * shard, so commands for one file stay ordered on one thread. Resources on different shards
+ * cannot be mixed, for example binding a view model instance from one file's shard to an artboard
+ * on another, just as with separate command queues. Assets such as images and fonts must likewise
+ * be registered on each shard that uses them, via [shards].
+ *
+ * The sharded queue holds one reference to each shard, released by [close]. Each shard fully
+ * disposes once the files and other resources created on it are also closed.
+ *
+ * @param shards The command queues to spread files across. Ownership of one reference to each is
+ *    transferred to this instance.
+ */
+class ShardedCommandQueue @VisibleForTesting internal constructor(
+    val shards: List<CommandQueue>
+) : CheckableAutoCloseable {
+    /**
+     * Creates a sharded command queue, starting [shardCount] command queues.
+     *
+     * @param shardCount The number of command queues, each with its own thread. Defaults to one
+     *    fewer than the number of cores, leaving a core for the main thread, between 1 and
+     *    [MAX_DEFAULT_SHARDS].
+     * @param renderBackend Preferred render backend for every shard, with the same fallback as
+     *    [CommandQueue].
+     * @param tracingEnabled Whether native command server tracing should start enabled.
+     * @throws RiveInitializationException If any shard cannot be created. Shards already created
+     *    are released.
+     */
+    @Throws(RiveInitializationException::class)
+    constructor(
+        shardCount: Int = defaultShardCount(),
+        renderBackend: RenderBackend = RenderBackend.OpenGL,
+        tracingEnabled: Boolean = false,
+    ) : this(createShards(shardCount) { CommandQueue(renderBackend, tracingEnabled) })
+
+    companion object {
+        /** The most shards created by default, regardless of core count. */
+        const val MAX_DEFAULT_SHARDS = 4
+
+        /**
+         * The default number of shards for this device: one fewer than the number of cores,
+         * between 1 and [MAX_DEFAULT_SHARDS].
+         */
+        fun defaultShardCount(): Int =
+            (Runtime.getRuntime().availableProcessors() - 1).coerceIn(1, MAX_DEFAULT_SHARDS)
+
+        /**
+         * Creates [shardCount] command queues with [factory], releasing any already created if a
+         * later one fails.
+         */
+        @VisibleForTesting
+        internal fun createShards(
+            shardCount: Int,
+            factory: () -> CommandQueue
+        ): List<CommandQueue> {
+            require(shardCount > 0) { "shardCount must be positive, got $shardCount" }
+            val shards = ArrayList<CommandQueue>(shardCount)
+            try {
+                repeat(shardCount) { shards.add(factory()) }
+            } catch (failure: Throwable) {
+                shards.forEach { it.release(SHARDED_COMMAND_QUEUE_TAG, "Shard startup failed") }
+                throw failure
+            }
+            return shards
+        }
+    }
+
+    init {
+        require(shards.isNotEmpty()) { "A sharded command queue needs at least one shard" }
+        RiveLog.d(SHARDED_COMMAND_QUEUE_TAG) { "Creating ${shards.size} command queue shards" }
+    }
+
+    private val closer = CloseOnce("ShardedCommandQueue") {
+        shards.forEach { it.release(SHARDED_COMMAND_QUEUE_TAG, "ShardedCommandQueue closed") }
+    }
+    override val closed: Boolean
+        get() = closer.closed
+
+    override fun close() = closer.close()
+
+    /** Rotates the starting shard between ties, so equally loaded shards take turns. */
+    private var nextTieBreak = 0
+
+    /** The number of shards. */
+    val shardCount: Int
+        get() = shards.size
+
+    /**
+     * Picks the shard for a new file: the one with the fewest outstanding references, as each
+     * file, artboard, state machine, and surface holds one. Ties rotate between shards.
+     *
+     * @return The chosen shard.
+     * @throws RiveResourceClosedException If this sharded queue has been closed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun nextShard(): CommandQueue {
+        closer.checkOpen()
+        synchronized(this) {
+            val start = nextTieBreak
+            nextTieBreak = (nextTieBreak + 1) % shards.size
+            var best = shards[start]
+            for (offset in 1 until shards.size) {
+                val shard = shards[(start + offset) % shards.size]
+                if (shard.refCount < best.refCount) {
+                    best = shard
+                }
+            }
+            return best
+        }
+    }
+
+    /**
+     * Loads a [RiveFile] from the given [source] on the least loaded shard.
+     *
+     * ⚠️ The lifetime of the [RiveFile] is managed by the caller, as with [RiveFile.load].
+     *
+     * @param source The source of the Rive file.
+     * @return The loaded Rive file, owned by the chosen shard.
+     * @throws RiveFileException If the file cannot be loaded.
+     * @throws RiveResourceClosedException If this sharded queue has been closed.
+     * @throws Resources.NotFoundException If a raw resource source cannot be found.
+     * @throws IOException If a raw resource source cannot be read.
+     * @throws CancellationException If the coroutine is cancelled before loading completes.
+     */
+    @Throws(
+        RiveFileException::class,
+        RiveResourceClosedException::class,
+        Resources.NotFoundException::class,
+        IOException::class,
+        CancellationException::class
+    )
+    suspend fun loadFile(source: RiveFileSource): RiveFile = RiveFile.load(source, nextShard())
+
+    /**
+     * Polls every shard for messages while [lifecycle] is RESUMED, as [CommandQueue.beginPolling]
+     * does for one command queue.
+     *
+     * @param lifecycle The lifecycle bounding the polling.
+     * @param ticker The frame ticker to use for polling.
+     * @throws RiveResourceClosedException If this sharded queue has been closed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    suspend fun beginPolling(
+        lifecycle: Lifecycle,
+        ticker: FrameTicker = ChoreographerFrameTicker
+    ) {
+        closer.checkOpen()
+        coroutineScope {
+            shards.forEach { shard ->
+                launch { shard.beginPolling(lifecycle, ticker) }
+            }
+        }
+    }
+
+    /**
+     * Polls every shard for messages once.
+     *
+     * @throws RiveResourceClosedException If this sharded queue has been closed.
+     * @see CommandQueue.pollMessages
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun pollMessages() {
+        closer.checkOpen()
+        shards.forEach { it.pollMessages() }
+    }
+
+    /**
+     * Enables or disables native command server tracing on every shard.
+     *
+     * @param enabled Whether tracing should be enabled.
+     * @throws RiveResourceClosedException If this sharded queue has been closed.
+     */
+    @Throws(RiveResourceClosedException::class)
+    fun setTracingEnabled(enabled: Boolean) {
+        closer.checkOpen()
+        shards.forEach { it.setTracingEnabled(enabled) }
+    }
+}
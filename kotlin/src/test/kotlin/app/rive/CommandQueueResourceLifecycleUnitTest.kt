@@ -1,5 +1,6 @@
 package app.rive
 
+import android.os.ParcelFileDescriptor
 import app.rive.core.ArtboardHandle
 import app.rive.core.AudioHandle
 import app.rive.core.CommandQueue
@@ -17,10 +18,12 @@ import io.kotest.matchers.shouldBe
 import io.kotest.matchers.string.shouldContain
 import io.mockk.every
 import io.mockk.just
+import io.mockk.mockk
 import io.mockk.runs
 import io.mockk.slot
 import io.mockk.spyk
 import io.mockk.verify
+import java.nio.ByteBuffer
 import java.util.concurrent.CountDownLatch
 import java.util.concurrent.TimeUnit
 import java.util.concurrent.atomic.AtomicReference
@@ -41,6 +44,7 @@ private const val CONFIRMED_VMI_HANDLE = 400L
 private const val CONFIRMED_IMAGE_HANDLE = 500L
 private const val CONFIRMED_AUDIO_HANDLE = 600L
 private const val CONFIRMED_FONT_HANDLE = 700L
+private const val PREPARED_FILE_BYTES = 800L
 
 /** Tests creation, cancellation cleanup, and deletion for command-queue-owned resources. */
 @OptIn(ExperimentalCoroutinesApi::class)
@@ -202,6 +206,77 @@ class CommandQueueResourceLifecycleUnitTest : FunSpec({
         }
     }
 
+    test("File creation from a direct buffer submits the prepared bytes") {
+        val queue = CommandQueue(renderContext, bridge)
+        val buffer = ByteBuffer.allocateDirect(FILE_BYTES.size).put(FILE_BYTES)
+        buffer.flip()
+        val requestID = slot<Long>()
+        val expected = FileHandle(CONFIRMED_FILE_HANDLE)
+        every {
+            bridge.cppCopyFileBytes(buffer, 0, FILE_BYTES.size)
+        } returns PREPARED_FILE_BYTES
+        every {
+            bridge.cppLoadFileBytes(COMMAND_QUEUE_ADDR, capture(requestID), PREPARED_FILE_BYTES)
+        } answers {
+            queue.onFileLoaded(requestID.captured, expected)
+            expected.handle
+        }
+
+        queue.loadFile(buffer) shouldBe expected
+        buffer.position() shouldBe 0
+        // The command queue owns the bytes once submitted.
+        verify(exactly = 0) { bridge.cppDeleteFileBytes(any()) }
+    }
+
+    test("File creation rejects a heap buffer") {
+        val queue = CommandQueue(renderContext, bridge)
+
+        shouldThrow<IllegalArgumentException> {
+            queue.loadFile(ByteBuffer.wrap(FILE_BYTES))
+        }
+        verify(exactly = 0) { bridge.cppCopyFileBytes(any(), any(), any()) }
+    }
+
+    test("File creation from a file descriptor reports mapping failure") {
+        val queue = CommandQueue(renderContext, bridge)
+        val fileDescriptor = mockk<ParcelFileDescriptor> {
+            every { fd } returns 3
+        }
+        every { bridge.cppMapFileBytes(3, 16L, 64L) } returns 0L
+
+        shouldThrow<RiveFileException> {
+            queue.loadFile(fileDescriptor, offset = 16L, length = 64L)
+        }
+        verify(exactly = 0) { bridge.cppLoadFileBytes(any(), any(), any()) }
+    }
+
+    test("Prepared file bytes are freed when the caller is cancelled before submission") {
+        coroutineScope {
+            val mainDispatcher = StandardTestDispatcher()
+            Dispatchers.setMain(mainDispatcher)
+            val queue = CommandQueue(renderContext, bridge)
+            val buffer = ByteBuffer.allocateDirect(FILE_BYTES.size).put(FILE_BYTES)
+            buffer.flip()
+            val cancelled = CountDownLatch(1)
+            every { bridge.cppCopyFileBytes(buffer, 0, FILE_BYTES.size) } answers {
+                cancelled.await(5, TimeUnit.SECONDS)
+                PREPARED_FILE_BYTES
+            }
+            every { bridge.cppDeleteFileBytes(PREPARED_FILE_BYTES) } just runs
+
+            val load = async(start = CoroutineStart.UNDISPATCHED) {
+                queue.loadFile(buffer)
+            }
+            load.cancel()
+            cancelled.countDown()
+            load.join()
+            mainDispatcher.scheduler.advanceUntilIdle()
+
+            verify(exactly = 1) { bridge.cppDeleteFileBytes(PREPARED_FILE_BYTES) }
+            verify(exactly = 0) { bridge.cppLoadFileBytes(any(), any(), any()) }
+        }
+    }
+
     test("File deletion invokes native") {
         val queue = CommandQueue(renderContext, bridge)
         val requestID = slot<Long>()
@@ -3,13 +3,18 @@ package app.rive
 import android.os.Build
 import androidx.lifecycle.Lifecycle
 import androidx.lifecycle.LifecycleOwner
+import app.rive.core.AdvanceBatch
 import app.rive.core.ArtboardHandle
 import app.rive.core.CommandQueue
+import app.rive.core.CommandQueueStartup
 import app.rive.core.DefaultViewModelInfo
 import app.rive.core.DrawKey
 import app.rive.core.FileHandle
 import app.rive.core.FrameTicker
 import app.rive.core.ImageHandle
+import app.rive.core.MessageBatchDecoder
+import app.rive.core.PointerEventBatch
+import app.rive.core.PropertyBatch
 import app.rive.core.RenderContext
 import app.rive.core.RiveSurface
 import app.rive.core.StateMachineHandle
@@ -19,6 +24,7 @@ import io.kotest.core.spec.style.FunSpec
 import io.kotest.matchers.collections.shouldHaveSize
 import io.kotest.matchers.shouldBe
 import io.kotest.matchers.string.shouldContain
+import io.mockk.captureNullable
 import io.mockk.every
 import io.mockk.just
 import io.mockk.mockk
@@ -29,7 +35,10 @@ import io.mockk.verifyOrder
 import kotlinx.coroutines.CoroutineStart
 import kotlinx.coroutines.async
 import kotlinx.coroutines.coroutineScope
+import kotlinx.coroutines.flow.first
 import kotlinx.coroutines.withTimeout
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
 import java.util.concurrent.CountDownLatch
 import java.util.concurrent.TimeUnit
 import kotlin.coroutines.cancellation.CancellationException
@@ -39,8 +48,10 @@ const val VULKAN_RENDER_CONTEXT_ADDR = 3L
 const val OPENGL_RENDER_CONTEXT_ADDR = 4L
 const val IMAGE_HANDLE_NUM = 654L
 const val VALUE_HANDLE_NUM = 789L
+private const val PROPERTY_HANDLE_NUM = 42L
 val FILE_BYTES = byteArrayOf(0, 1, 2)
 private const val TEST_FINAL_RELEASE_SOURCE = "Test final release"
+private const val SUBSCRIPTION_REQUEST_ID = -1L
 
 // TODO: Split the remaining tests by functional area:
 // - CommandQueueLifecycleUnitTest: construction, backend fallback, tracing, release, and polling.
@@ -199,6 +210,79 @@ class CommandQueueUnitTest : FunSpec({
         verify(exactly = 1) { openGLRenderContextMock.close() }
     }
 
+    test("Async constructor returns before startup and notifies the listener on success") {
+        val startup = slot<CommandQueueStartup>()
+        every {
+            commandQueueBridgeMock.cppConstructorAsync(RENDER_CONTEXT_ADDR, capture(startup))
+        } returns COMMAND_QUEUE_ADDR
+        val results = mutableListOf<RiveInitializationException?>()
+
+        val commandQueue = CommandQueue(
+            renderBackend = RenderBackend.OpenGL,
+            bridge = commandQueueBridgeMock,
+            startupListener = { results.add(it) },
+            renderContextFactory = { renderContextMock }
+        )
+
+        commandQueue.refCount shouldBe 1
+        results shouldBe emptyList()
+        startup.captured.onResult(true, 0x3000, "Command Server started successfully")
+        results shouldBe listOf(null)
+        verify(exactly = 0) { commandQueueBridgeMock.cppConstructor(any()) }
+    }
+
+    test("Async startup reported before construction finishes is delivered once") {
+        every {
+            commandQueueBridgeMock.cppConstructorAsync(RENDER_CONTEXT_ADDR, any())
+        } answers {
+            secondArg<CommandQueueStartup>().onResult(true, 0x3000, "Started")
+            COMMAND_QUEUE_ADDR
+        }
+        val results = mutableListOf<RiveInitializationException?>()
+
+        CommandQueue(
+            renderBackend = RenderBackend.OpenGL,
+            bridge = commandQueueBridgeMock,
+            startupListener = { results.add(it) },
+            renderContextFactory = { renderContextMock }
+        )
+
+        results shouldBe listOf(null)
+    }
+
+    test("Async startup failure fails pending and later requests") {
+        val startup = slot<CommandQueueStartup>()
+        every {
+            commandQueueBridgeMock.cppConstructorAsync(RENDER_CONTEXT_ADDR, capture(startup))
+        } returns COMMAND_QUEUE_ADDR
+        every {
+            commandQueueBridgeMock.cppGetArtboardNames(COMMAND_QUEUE_ADDR, any(), HANDLE_NUM)
+        } just runs
+        val results = mutableListOf<RiveInitializationException?>()
+        val commandQueue = CommandQueue(
+            renderBackend = RenderBackend.OpenGL,
+            bridge = commandQueueBridgeMock,
+            startupListener = { results.add(it) },
+            renderContextFactory = { renderContextMock }
+        )
+
+        coroutineScope {
+            val pending = async(start = CoroutineStart.UNDISPATCHED) {
+                runCatching { commandQueue.getArtboardNames(FileHandle(HANDLE_NUM)) }
+            }
+            startup.captured.onResult(false, 0x3003, "Failed to create PBuffer")
+
+            pending.await().exceptionOrNull() shouldBe results.single()
+        }
+        results.single()!!.message shouldContain "0x3003"
+        shouldThrow<RiveInitializationException> {
+            commandQueue.getArtboardNames(FileHandle(HANDLE_NUM))
+        } shouldBe results.single()
+        verify(exactly = 1) {
+            commandQueueBridgeMock.cppGetArtboardNames(COMMAND_QUEUE_ADDR, any(), HANDLE_NUM)
+        }
+    }
+
     test("Constructor propagates tracing enabled when requested") {
         CommandQueue(renderContextMock, commandQueueBridgeMock, tracingEnabled = true)
 
@@ -398,6 +482,77 @@ class CommandQueueUnitTest : FunSpec({
         verify(exactly = 0) { commandQueueBridgeMock.cppPollMessages(any()) }
     }
 
+    test("setMessageBatchingEnabled shares a direct buffer and clears it when disabled") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        val buffers = mutableListOf<ByteBuffer?>()
+        every {
+            commandQueueBridgeMock.cppSetMessageBuffer(COMMAND_QUEUE_ADDR, captureNullable(buffers))
+        } just runs
+
+        commandQueue.setMessageBatchingEnabled(true)
+        commandQueue.setMessageBatchingEnabled(true)
+        commandQueue.setMessageBatchingEnabled(false)
+
+        buffers shouldHaveSize 3
+        buffers[0]!!.isDirect shouldBe true
+        buffers[1] shouldBe buffers[0]
+        buffers[2] shouldBe null
+    }
+
+    test("Batched messages are decoded in order to their callbacks") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        val buffer = slot<ByteBuffer>()
+        val requestID = slot<Long>()
+        every {
+            commandQueueBridgeMock.cppSetMessageBuffer(COMMAND_QUEUE_ADDR, capture(buffer))
+        } just runs
+        every {
+            commandQueueBridgeMock.cppGetDefaultViewModelInfo(
+                COMMAND_QUEUE_ADDR,
+                capture(requestID),
+                HANDLE_NUM,
+                ARTBOARD_HANDLE_NUM
+            )
+        } answers {
+            // Mirrors the native MessageBatch layout: tag, then fields in native byte order.
+            val out = buffer.captured.duplicate().order(ByteOrder.nativeOrder())
+            fun putString(value: String) {
+                val bytes = value.toByteArray(Charsets.UTF_8)
+                out.putInt(bytes.size)
+                out.put(bytes)
+            }
+            out.put(MessageBatchDecoder.TAG_NUMBER_PROPERTY_UPDATED.toByte())
+            out.putLong(SUBSCRIPTION_REQUEST_ID)
+            out.putLong(HANDLE_NUM)
+            putString("speed")
+            out.putFloat(2.5f)
+            out.put(MessageBatchDecoder.TAG_DEFAULT_VIEW_MODEL_INFO_RECEIVED.toByte())
+            out.putLong(requestID.captured)
+            putString("Test Äll")
+            putString("default")
+            commandQueue.onMessageBatch(out.position())
+        }
+        commandQueue.setMessageBatchingEnabled(true)
+
+        val result = coroutineScope {
+            val update = async(start = CoroutineStart.UNDISPATCHED) {
+                commandQueue.numberPropertyFlow.first()
+            }
+            val info = commandQueue.getDefaultViewModelInfo(
+                FileHandle(HANDLE_NUM),
+                ArtboardHandle(ARTBOARD_HANDLE_NUM)
+            )
+            update.await() shouldBe CommandQueue.PropertyUpdate(
+                ViewModelInstanceHandle(HANDLE_NUM),
+                "speed",
+                2.5f
+            )
+            info
+        }
+
+        result shouldBe DefaultViewModelInfo("Test Äll", "default")
+    }
+
     test("File query failure throws file error") {
         val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
         val requestID = slot<Long>()
@@ -873,6 +1028,244 @@ class CommandQueueUnitTest : FunSpec({
         }
     }
 
+    test("Resolved property sets are sent by handle") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        val instanceHandle = ViewModelInstanceHandle(HANDLE_NUM)
+        val propertyPath = "nested/number"
+        every {
+            commandQueueBridgeMock.cppResolveProperty(COMMAND_QUEUE_ADDR, HANDLE_NUM, propertyPath)
+        } returns PROPERTY_HANDLE_NUM
+        every {
+            commandQueueBridgeMock.cppSetNumberPropertyByHandle(any(), any(), any())
+        } just runs
+        every { commandQueueBridgeMock.cppReleaseProperty(any(), any()) } just runs
+
+        val property = commandQueue.resolveProperty(instanceHandle, propertyPath)
+        commandQueue.setNumberProperty(property, 1f)
+        commandQueue.setNumberProperty(property, 2f)
+        commandQueue.releaseProperty(property)
+
+        property.viewModelInstanceHandle shouldBe instanceHandle
+        property.path shouldBe propertyPath
+        verifyOrder {
+            commandQueueBridgeMock.cppSetNumberPropertyByHandle(
+                COMMAND_QUEUE_ADDR,
+                PROPERTY_HANDLE_NUM,
+                1f
+            )
+            commandQueueBridgeMock.cppSetNumberPropertyByHandle(
+                COMMAND_QUEUE_ADDR,
+                PROPERTY_HANDLE_NUM,
+                2f
+            )
+            commandQueueBridgeMock.cppReleaseProperty(COMMAND_QUEUE_ADDR, PROPERTY_HANDLE_NUM)
+        }
+        verify(exactly = 1) { commandQueueBridgeMock.cppResolveProperty(any(), any(), any()) }
+        verify(exactly = 0) {
+            commandQueueBridgeMock.cppSetNumberProperty(any(), any(), any(), any())
+        }
+    }
+
+    test("Resolved property gets are requested by path") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        val instanceHandle = ViewModelInstanceHandle(HANDLE_NUM)
+        val propertyPath = "number"
+        val requestID = slot<Long>()
+        every {
+            commandQueueBridgeMock.cppResolveProperty(COMMAND_QUEUE_ADDR, HANDLE_NUM, propertyPath)
+        } returns PROPERTY_HANDLE_NUM
+        every {
+            commandQueueBridgeMock.cppGetNumberProperty(
+                COMMAND_QUEUE_ADDR,
+                capture(requestID),
+                HANDLE_NUM,
+                propertyPath
+            )
+        } answers {
+            commandQueue.onNumberPropertyUpdated(
+                requestID.captured,
+                instanceHandle,
+                propertyPath,
+                3f
+            )
+        }
+
+        val property = commandQueue.resolveProperty(instanceHandle, propertyPath)
+
+        commandQueue.getNumberProperty(property) shouldBe 3f
+    }
+
+    test("Property batch is packed and applied in one native call") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        every { commandQueueBridgeMock.cppResolveProperty(any(), any(), any()) } returnsMany
+                listOf(PROPERTY_HANDLE_NUM, PROPERTY_HANDLE_NUM + 1)
+        val packed = slot<ByteArray>()
+        val length = slot<Int>()
+        every {
+            commandQueueBridgeMock.cppApplyPropertyBatch(
+                COMMAND_QUEUE_ADDR,
+                capture(packed),
+                capture(length)
+            )
+        } just runs
+
+        val instanceHandle = ViewModelInstanceHandle(HANDLE_NUM)
+        val number = commandQueue.resolveProperty(instanceHandle, "number")
+        val label = commandQueue.resolveProperty(instanceHandle, "label")
+        // A small capacity forces the batch to grow while preserving earlier updates.
+        val batch = PropertyBatch(initialCapacity = 1).apply {
+            setNumber(number, 1.5f)
+            setString(label, "hé")
+            fireTrigger(number)
+        }
+        commandQueue.applyPropertyBatch(batch)
+        commandQueue.applyPropertyBatch(PropertyBatch())
+
+        batch.size shouldBe 3
+        verify(exactly = 1) { commandQueueBridgeMock.cppApplyPropertyBatch(any(), any(), any()) }
+        val bytes = ByteBuffer.wrap(packed.captured, 0, length.captured)
+            .order(ByteOrder.nativeOrder())
+        bytes.get() shouldBe 0.toByte()
+        bytes.long shouldBe PROPERTY_HANDLE_NUM
+        bytes.float shouldBe 1.5f
+        bytes.get() shouldBe 4.toByte()
+        bytes.long shouldBe PROPERTY_HANDLE_NUM + 1
+        bytes.int shouldBe 3
+        ByteArray(3).also { bytes.get(it) }.decodeToString() shouldBe "hé"
+        bytes.get() shouldBe 5.toByte()
+        bytes.long shouldBe PROPERTY_HANDLE_NUM
+        bytes.hasRemaining() shouldBe false
+    }
+
+    test("Pointer events submit the whole batch in one native call") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        val fit = Fit.Contain()
+        val samples = slot<FloatArray>()
+        every {
+            commandQueueBridgeMock.cppPointerEvents(
+                COMMAND_QUEUE_ADDR,
+                HANDLE_NUM,
+                fit.nativeMapping,
+                fit.alignment.nativeMapping,
+                fit.scaleFactor,
+                100f,
+                200f,
+                capture(samples),
+                any()
+            )
+        } just runs
+
+        // A capacity of one forces the batch to grow while preserving earlier events.
+        val batch = PointerEventBatch(initialCapacity = 1).apply {
+            down(1, 10f, 20f)
+            move(1, 11f, 21f)
+            up(1, 12f, 22f)
+            exit(1, 12f, 22f)
+        }
+        commandQueue.pointerEvents(StateMachineHandle(HANDLE_NUM), fit, 100f, 200f, batch)
+
+        verify(exactly = 1) {
+            commandQueueBridgeMock.cppPointerEvents(
+                COMMAND_QUEUE_ADDR,
+                HANDLE_NUM,
+                fit.nativeMapping,
+                fit.alignment.nativeMapping,
+                fit.scaleFactor,
+                100f,
+                200f,
+                any(),
+                4
+            )
+        }
+        samples.captured.copyOf(16).toList() shouldBe listOf(
+            1f, 10f, 20f, 1f,
+            1f, 11f, 21f, 0f,
+            1f, 12f, 22f, 2f,
+            1f, 12f, 22f, 3f
+        )
+    }
+
+    test("Empty pointer batch skips native but still rejects a disposed worker") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        val batch = PointerEventBatch()
+
+        commandQueue.pointerEvents(StateMachineHandle(HANDLE_NUM), Fit.Contain(), 1f, 1f, batch)
+
+        verify(exactly = 0) {
+            commandQueueBridgeMock.cppPointerEvents(
+                any(), any(), any(), any(), any(), any(), any(), any(), any()
+            )
+        }
+
+        commandQueue.release(TEST_FINAL_RELEASE_SOURCE)
+        shouldThrow<RiveResourceClosedException> {
+            commandQueue.pointerEvents(
+                StateMachineHandle(HANDLE_NUM),
+                Fit.Contain(),
+                1f,
+                1f,
+                batch
+            )
+        }
+    }
+
+    test("State machine advances submit the whole batch in one native call") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        val handles = slot<LongArray>()
+        every {
+            commandQueueBridgeMock.cppAdvanceStateMachines(
+                COMMAND_QUEUE_ADDR,
+                any(),
+                capture(handles),
+                any(),
+                any(),
+                any()
+            )
+        } just runs
+
+        // A capacity of one forces the batch to grow while preserving earlier pairs.
+        val batch = AdvanceBatch(initialCapacity = 1).apply {
+            add(ArtboardHandle(ARTBOARD_HANDLE_NUM), StateMachineHandle(HANDLE_NUM))
+            add(ArtboardHandle(ARTBOARD_HANDLE_NUM + 1), StateMachineHandle(HANDLE_NUM + 1))
+            add(ArtboardHandle(ARTBOARD_HANDLE_NUM), StateMachineHandle(HANDLE_NUM + 2))
+        }
+        commandQueue.advanceStateMachines(batch, 16.milliseconds, parallel = true)
+
+        verify(exactly = 1) {
+            commandQueueBridgeMock.cppAdvanceStateMachines(
+                COMMAND_QUEUE_ADDR,
+                any(),
+                any(),
+                3,
+                16_000_000L,
+                true
+            )
+        }
+        handles.captured.copyOf(6).toList() shouldBe listOf(
+            ARTBOARD_HANDLE_NUM, HANDLE_NUM,
+            ARTBOARD_HANDLE_NUM + 1, HANDLE_NUM + 1,
+            ARTBOARD_HANDLE_NUM, HANDLE_NUM + 2
+        )
+    }
+
+    test("Empty advance batch skips native but still rejects a disposed worker") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        val batch = AdvanceBatch()
+
+        commandQueue.advanceStateMachines(batch, 16.milliseconds)
+
+        verify(exactly = 0) {
+            commandQueueBridgeMock.cppAdvanceStateMachines(
+                any(), any(), any(), any(), any(), any()
+            )
+        }
+
+        commandQueue.release(TEST_FINAL_RELEASE_SOURCE)
+        shouldThrow<RiveResourceClosedException> {
+            commandQueue.advanceStateMachines(batch, 16.milliseconds)
+        }
+    }
+
     test("RiveSurface resize updates dimensions and invalidates render target after canceling draw") {
         val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
         val surface = TestRiveSurface(commandQueue, width = 100, height = 200)
@@ -1004,7 +1397,8 @@ class CommandQueueUnitTest : FunSpec({
         }
         verify(exactly = 0) {
             commandQueueBridgeMock.cppDraw(
-                any(), any(), any(), any(), any(), any(), any(), any(), any(), any(), any(), any()
+                any(), any(), any(), any(), any(), any(), any(), any(), any(), any(), any(), any(),
+                any()
             )
         }
         verify(exactly = 0) {
@@ -1051,7 +1445,8 @@ class CommandQueueUnitTest : FunSpec({
         }
         verify(exactly = 0) {
             commandQueueBridgeMock.cppDraw(
-                any(), any(), any(), any(), any(), any(), any(), any(), any(), any(), any(), any()
+                any(), any(), any(), any(), any(), any(), any(), any(), any(), any(), any(), any(),
+                any()
             )
         }
         verify(exactly = 0) {
@@ -1062,6 +1457,121 @@ class CommandQueueUnitTest : FunSpec({
         }
     }
 
+    test("drawToBufferAsync reports native failures as RiveDrawToBufferException") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        val surface = TestRiveSurface(commandQueue, width = 1, height = 1)
+        val onComplete = slot<(String?) -> Unit>()
+        every {
+            commandQueueBridgeMock.cppDrawToBufferAsync(
+                COMMAND_QUEUE_ADDR, RENDER_CONTEXT_ADDR, 30L, 20L, any(), any(), 1, 1, any(),
+                any(), any(), any(), any(), capture(onComplete)
+            )
+        } just runs
+
+        val results = mutableListOf<RiveDrawToBufferException?>()
+        commandQueue.drawToBufferAsync(
+            ArtboardHandle(ARTBOARD_HANDLE_NUM),
+            StateMachineHandle(HANDLE_NUM),
+            surface,
+            ByteArray(4),
+            1,
+            1,
+        ) { results.add(it) }
+        onComplete.captured.invoke(null)
+        onComplete.captured.invoke("Failed to draw into buffer: render target is unavailable")
+
+        results shouldHaveSize 2
+        results[0] shouldBe null
+        results[1]!!.message shouldBe "Failed to draw into buffer: render target is unavailable"
+    }
+
+    test("drawToBufferAsync with a ByteBuffer passes it to the direct buffer bridge") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        val surface = TestRiveSurface(commandQueue, width = 1, height = 1)
+        val buffer = ByteBuffer.allocateDirect(4)
+        val onComplete = slot<(String?) -> Unit>()
+        every {
+            commandQueueBridgeMock.cppDrawToDirectBufferAsync(
+                COMMAND_QUEUE_ADDR, RENDER_CONTEXT_ADDR, 30L, 20L, any(), any(), 1, 1, any(),
+                any(), any(), any(), buffer, capture(onComplete)
+            )
+        } just runs
+
+        val results = mutableListOf<RiveDrawToBufferException?>()
+        commandQueue.drawToBufferAsync(
+            ArtboardHandle(ARTBOARD_HANDLE_NUM),
+            StateMachineHandle(HANDLE_NUM),
+            surface,
+            buffer,
+            1,
+            1,
+        ) { results.add(it) }
+        onComplete.captured.invoke(null)
+
+        results shouldBe listOf(null)
+    }
+
+    test("Pipelined frames are presented once their surface stops drawing") {
+        val commandQueue = CommandQueue(renderContextMock, commandQueueBridgeMock)
+        val surface = TestRiveSurface(commandQueue, width = 100, height = 200)
+        every { commandQueueBridgeMock.cppPollMessages(COMMAND_QUEUE_ADDR) } just runs
+        every {
+            commandQueueBridgeMock.cppDraw(
+                any(), any(), any(), any(), any(), any(), any(), any(), any(), any(), any(), any(),
+                any()
+            )
+        } just runs
+        every {
+            commandQueueBridgeMock.cppPresentPendingFrame(
+                COMMAND_QUEUE_ADDR,
+                RENDER_CONTEXT_ADDR,
+                30L
+            )
+        } just runs
+        fun drawPipelined() = commandQueue.draw(
+            ArtboardHandle(ARTBOARD_HANDLE_NUM),
+            StateMachineHandle(HANDLE_NUM),
+            surface,
+            Fit.Contain(),
+            pipelined = true
+        )
+
+        // While the surface keeps drawing, each draw presents the previous frame natively.
+        drawPipelined()
+        commandQueue.pollMessages()
+        drawPipelined()
+        commandQueue.pollMessages()
+        verify(exactly = 0) { commandQueueBridgeMock.cppPresentPendingFrame(any(), any(), any()) }
+        verify(exactly = 2) {
+            commandQueueBridgeMock.cppDraw(
+                COMMAND_QUEUE_ADDR,
+                RENDER_CONTEXT_ADDR,
+                30L,
+                20L,
+                ARTBOARD_HANDLE_NUM,
+                HANDLE_NUM,
+                100,
+                200,
+                any(),
+                any(),
+                any(),
+                any(),
+                true
+            )
+        }
+
+        // A poll without a draw since the last presents the final frame, once.
+        commandQueue.pollMessages()
+        commandQueue.pollMessages()
+        verify(exactly = 1) {
+            commandQueueBridgeMock.cppPresentPendingFrame(
+                COMMAND_QUEUE_ADDR,
+                RENDER_CONTEXT_ADDR,
+                30L
+            )
+        }
+    }
+
 })
 
 internal class TestRiveSurface(
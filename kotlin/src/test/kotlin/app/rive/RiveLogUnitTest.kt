@@ -0,0 +1,36 @@
+package app.rive
+
+import android.util.Log
+import io.kotest.core.spec.style.FunSpec
+import io.kotest.matchers.shouldBe
+
+/** Tests the priority native code filters log messages by. */
+class RiveLogUnitTest : FunSpec({
+    val originalLogger = RiveLog.logger
+    val originalLevel = RiveLog.nativeLevel
+
+    afterTest {
+        RiveLog.logger = originalLogger
+        RiveLog.nativeLevel = originalLevel
+    }
+
+    test("Native messages are discarded while the logger is the no-op logger") {
+        RiveLog.logger = RiveLog.NoOpLogger
+
+        RiveLog.nativeLevel = RiveLog.Level.VERBOSE
+        RiveLog.nativePriority() shouldBe RiveLog.Level.NONE.priority
+        RiveLog.nativeLevel = RiveLog.Level.WARN
+        RiveLog.nativePriority() shouldBe RiveLog.Level.NONE.priority
+    }
+
+    test("Native messages follow the native level with any other logger") {
+        RiveLog.logger = object : RiveLog.Logger {}
+
+        RiveLog.nativeLevel = RiveLog.Level.VERBOSE
+        RiveLog.nativePriority() shouldBe Log.VERBOSE
+        RiveLog.nativeLevel = RiveLog.Level.WARN
+        RiveLog.nativePriority() shouldBe Log.WARN
+        RiveLog.nativeLevel = RiveLog.Level.NONE
+        RiveLog.nativePriority() shouldBe RiveLog.Level.NONE.priority
+    }
+})
@@ -0,0 +1,68 @@
+package app.rive
+
+import app.rive.core.CommandQueue
+import app.rive.core.ShardedCommandQueue
+import io.kotest.assertions.throwables.shouldThrow
+import io.kotest.core.spec.style.FunSpec
+import io.kotest.matchers.shouldBe
+import io.kotest.matchers.types.shouldBeSameInstanceAs
+
+/** Tests shard assignment and ownership for [ShardedCommandQueue]. */
+class ShardedCommandQueueUnitTest : FunSpec({
+    val fixture = installCommandQueueTestFixture()
+
+    fun createShard() = CommandQueue(fixture.renderContextMock, fixture.commandQueueBridgeMock)
+
+    test("Files are assigned to the least referenced shard") {
+        val shards = List(3) { createShard() }
+        val sharded = ShardedCommandQueue(shards)
+        shards[0].acquire("Test")
+        shards[2].acquire("Test")
+
+        sharded.nextShard() shouldBeSameInstanceAs shards[1]
+
+        sharded.close()
+        shards[0].release("Test")
+        shards[2].release("Test")
+    }
+
+    test("Equally referenced shards take turns") {
+        val shards = List(3) { createShard() }
+        val sharded = ShardedCommandQueue(shards)
+
+        List(4) { sharded.nextShard() } shouldBe listOf(shards[0], shards[1], shards[2], shards[0])
+
+        sharded.close()
+    }
+
+    test("Close releases each shard once and rejects further use") {
+        val shards = List(2) { createShard() }
+        val sharded = ShardedCommandQueue(shards)
+        // A file keeps its shard alive past the sharded queue.
+        shards[1].acquire("File")
+
+        sharded.close()
+        sharded.close()
+
+        shards[0].isDisposed shouldBe true
+        shards[1].refCount shouldBe 1
+        shouldThrow<RiveResourceClosedException> { sharded.nextShard() }
+        shards[1].release("File")
+    }
+
+    test("Shards already created are released when a later shard fails to start") {
+        val created = mutableListOf<CommandQueue>()
+
+        shouldThrow<RiveInitializationException> {
+            ShardedCommandQueue.createShards(3) {
+                if (created.size == 2) {
+                    throw RiveInitializationException("No GPU")
+                }
+                createShard().also { created.add(it) }
+            }
+        }
+
+        created.size shouldBe 2
+        created.forEach { it.isDisposed shouldBe true }
+    }
+})
@@ -0,0 +1,570 @@
+#!/usr/bin/env python3
+"""Generates the table of native methods registered in JNI_OnLoad.
+
+librive-android registers every native method explicitly with RegisterNatives
+instead of letting the JVM find them by exported symbol name. This script keeps
+that table in sync with the code: it collects every `Java_...` function defined
+in the native sources, decodes the Java class and method from its name, and
+derives the JNI signature from the C++ parameter types. Object types, which the
+C++ side only sees as `jobject`, are resolved from the matching Kotlin
+`external fun` declaration. Every other parameter is cross-checked against the
+Kotlin declaration, so a binding whose two sides disagree fails generation
+instead of failing registration at runtime.
+
+Run from the repository root after adding, removing or changing a binding:
+
+    python3 tools/jni/generate_native_table.py
+
+Pass --check to fail instead of writing when the table is out of date.
+"""
+
+import argparse
+import pathlib
+import re
+import sys
+
+ROOT = pathlib.Path(__file__).resolve().parents[2]
+CPP_SOURCES = ROOT / "kotlin/src/main/cpp/src"
+KOTLIN_SOURCES = [
+    ROOT / "kotlin/src/main/java",
+    ROOT / "kotlin/src/main/kotlin",
+    # Test-only bindings are compiled into the library; their classes are
+    # skipped at registration when the test APK is not loaded.
+    ROOT / "kotlin/src/androidTest/kotlin",
+]
+OUTPUT = CPP_SOURCES / "jni_native_table.cpp"
+
+JNI_PRIMITIVES = {
+    "void": "V",
+    "jboolean": "Z",
+    "jbyte": "B",
+    "jchar": "C",
+    "jshort": "S",
+    "jint": "I",
+    "jlong": "J",
+    "jfloat": "F",
+    "float": "F",
+    "jdouble": "D",
+    "jstring": "Ljava/lang/String;",
+    "jbyteArray": "[B",
+    "jcharArray": "[C",
+    "jshortArray": "[S",
+    "jintArray": "[I",
+    "jlongArray": "[J",
+    "jfloatArray": "[F",
+    "jdoubleArray": "[D",
+    "jbooleanArray": "[Z",
+}
+JNI_OBJECTS = {"jobject", "jobjectArray", "jclass", "jthrowable"}
+
+KOTLIN_TYPES = {
+    "Unit": "V",
+    "Boolean": "Z",
+    "Byte": "B",
+    "Char": "C",
+    "Short": "S",
+    "Int": "I",
+    "Long": "J",
+    "Float": "F",
+    "Double": "D",
+    "String": "Ljava/lang/String;",
+    "Any": "Ljava/lang/Object;",
+    "BooleanArray": "[Z",
+    "ByteArray": "[B",
+    "CharArray": "[C",
+    "ShortArray": "[S",
+    "IntArray": "[I",
+    "LongArray": "[J",
+    "FloatArray": "[F",
+    "DoubleArray": "[D",
+    "List": "Ljava/util/List;",
+    "MutableList": "Ljava/util/List;",
+    "Map": "Ljava/util/Map;",
+    "MutableMap": "Ljava/util/Map;",
+    "Set": "Ljava/util/Set;",
+    "MutableSet": "Ljava/util/Set;",
+    "Collection": "Ljava/util/Collection;",
+    "HashMap": "Ljava/util/HashMap;",
+    "ArrayList": "Ljava/util/ArrayList;",
+}
+KOTLIN_BOXED = {
+    "Boolean": "Ljava/lang/Boolean;",
+    "Byte": "Ljava/lang/Byte;",
+    "Char": "Ljava/lang/Character;",
+    "Short": "Ljava/lang/Short;",
+    "Int": "Ljava/lang/Integer;",
+    "Long": "Ljava/lang/Long;",
+    "Float": "Ljava/lang/Float;",
+    "Double": "Ljava/lang/Double;",
+}
+
+JNI_FUNCTION = re.compile(
+    r"JNIEXPORT\s+(?:JNICALL\s+)?([\w\s]+?)\s+JNICALL\s+(Java_\w+)\s*\(([^)]*)\)",
+    re.S,
+)
+KOTLIN_DECLARATION = re.compile(
+    r"^(\s*)(?:@\w+(?:\([^)]*\))?\s+)*"
+    r"(?:(?:public|private|internal|protected|open|abstract|sealed|data|enum|"
+    r"inner|annotation|value|final)\s+)*"
+    r"(?:(companion)\s+object(?:\s+(\w+))?|(?:class|interface|object)\s+(\w+))"
+)
+KOTLIN_EXTERNAL = re.compile(r"\bexternal\s+(?:override\s+)?fun\s+(\w+)\s*\(")
+
+
+class GenerationError(Exception):
+    pass
+
+
+def decode_jni_name(symbol):
+    """Splits a Java_ symbol into a class binary name and a method name."""
+    body = symbol[len("Java_"):]
+    if "__" in body:
+        raise GenerationError(f"{symbol}: overloaded symbols are not supported")
+    parts = []
+    current = ""
+    i = 0
+    while i < len(body):
+        c = body[i]
+        if c != "_":
+            current += c
+            i += 1
+            continue
+        escape = body[i + 1] if i + 1 < len(body) else ""
+        if escape == "1":
+            current += "_"
+            i += 2
+        elif escape == "0":
+            current += chr(int(body[i + 2:i + 6], 16))
+            i += 6
+        else:
+            parts.append(current)
+            current = ""
+            i += 1
+    parts.append(current)
+    return "/".join(parts[:-1]), parts[-1]
+
+
+PREPROCESSOR = re.compile(r"^\s*#\s*(ifdef|ifndef|if|elif|else|endif)\b(.*)$", re.M)
+
+
+def preprocessor_guard(text, offset):
+    """Returns the #if condition that a definition at offset is compiled under.
+
+    Conditions on __cplusplus only select the `extern "C"` linkage and are
+    ignored. An empty string means the definition is always compiled.
+    """
+    stack = []
+    for match in PREPROCESSOR.finditer(text, 0, offset):
+        directive, argument = match.group(1), match.group(2).split("//")[0].strip()
+        if directive == "ifdef":
+            stack.append(f"defined({argument})")
+        elif directive == "ifndef":
+            stack.append(f"!defined({argument})")
+        elif directive == "if":
+            stack.append(argument)
+        elif directive == "elif":
+            stack[-1] = f"!({stack[-1]}) && ({argument})"
+        elif directive == "else":
+            stack[-1] = f"!({stack[-1]})"
+        else:
+            stack.pop()
+    return " && ".join(c for c in stack if "__cplusplus" not in c)
+
+
+def parse_cpp_functions():
+    functions = []
+    for path in sorted(CPP_SOURCES.rglob("*.cpp")):
+        if path == OUTPUT:
+            continue
+        text = path.read_text()
+        for match in JNI_FUNCTION.finditer(text):
+            ret, symbol, params = match.groups()
+            types = []
+            for param in params.split(","):
+                tokens = param.split()
+                # Drop the parameter name, keeping pointer declarators.
+                if len(tokens) > 1 and re.fullmatch(r"\w+", tokens[-1]):
+                    tokens = tokens[:-1]
+                types.append(" ".join(tokens))
+            class_name, method = decode_jni_name(symbol)
+            functions.append(
+                {
+                    "symbol": symbol,
+                    "return": " ".join(ret.split()),
+                    "params": types,
+                    "class": class_name,
+                    "method": method,
+                    "source": path.relative_to(ROOT),
+                    "guard": preprocessor_guard(text, match.start()),
+                }
+            )
+    return functions
+
+
+def strip_comments_and_strings(text):
+    """Blanks out comments and string contents, preserving line structure."""
+    out = []
+    i = 0
+    n = len(text)
+    while i < n:
+        if text.startswith("//", i):
+            end = text.find("\n", i)
+            end = n if end == -1 else end
+            out.append(" " * (end - i))
+            i = end
+        elif text.startswith("/*", i):
+            end = text.find("*/", i + 2)
+            end = n if end == -1 else end + 2
+            out.append(re.sub(r"[^\n]", " ", text[i:end]))
+            i = end
+        elif text.startswith('"""', i):
+            end = text.find('"""', i + 3)
+            end = n if end == -1 else end + 3
+            out.append('""' + re.sub(r"[^\n]", " ", text[i + 2:end - 1]) + '"')
+            i = end
+        elif text[i] == '"':
+            j = i + 1
+            while j < n and text[j] != '"':
+                j += 2 if text[j] == "\\" else 1
+            out.append('"' + " " * (j - i - 1) + '"')
+            i = j + 1
+        elif text[i] == "'" and i + 2 < n and (text[i + 2] == "'" or text[i + 1] == "\\"):
+            j = text.find("'", i + 2 if text[i + 1] == "\\" else i + 1)
+            out.append("'" + " " * (j - i - 1) + "'")
+            i = j + 1
+        else:
+            out.append(text[i])
+            i += 1
+    return "".join(out)
+
+
+def split_top_level(text, separator=","):
+    parts, depth, current = [], 0, ""
+    for c in text:
+        if c in "(<[":
+            depth += 1
+        elif c in ")>]":
+            depth -= 1
+        if c == separator and depth == 0:
+            parts.append(current)
+            current = ""
+        else:
+            current += c
+    if current.strip():
+        parts.append(current)
+    return parts
+
+
+def enclosing_classes(lines, line_index):
+    """Returns the names of the classes enclosing a line, outermost first."""
+    names = []
+    indent = len(lines[line_index]) - len(lines[line_index].lstrip())
+    i = line_index - 1
+    while i >= 0 and indent > 0:
+        line = lines[i]
+        if line.strip():
+            line_indent = len(line) - len(line.lstrip())
+            if line_indent < indent:
+                match = KOTLIN_DECLARATION.match(line)
+                if match:
+                    if match.group(2):
+                        names.append(match.group(3) or "Companion")
+                    else:
+                        names.append(match.group(4))
+                    indent = line_indent
+                elif line.lstrip().startswith(")"):
+                    # The end of a multi-line class header; keep looking up
+                    # for its start at the same indentation.
+                    pass
+                else:
+                    indent = line_indent
+        i -= 1
+    return list(reversed(names))
+
+
+def parse_kotlin_type_aliases():
+    """Collects type aliases that name a plain type, such as `FontBytes`."""
+    aliases = {}
+    for source_root in KOTLIN_SOURCES:
+        for path in sorted(source_root.rglob("*.kt")):
+            for match in re.finditer(r"^\s*(?:\w+\s+)*typealias\s+(\w+)\s*=\s*([\w.]+)\s*$",
+                                     path.read_text(), re.M):
+                aliases[match.group(1)] = match.group(2)
+    return aliases
+
+
+TYPE_ALIASES = {}
+# Fully qualified names of the top-level classes declared in KOTLIN_SOURCES.
+KOTLIN_CLASSES = set()
+
+
+def parse_kotlin_classes():
+    classes = set()
+    for source_root in KOTLIN_SOURCES:
+        for path in sorted(source_root.rglob("*.kt")):
+            text = path.read_text()
+            package_match = re.search(r"^package\s+([\w.]+)", text, re.M)
+            package = package_match.group(1) if package_match else ""
+            for line in text.split("\n"):
+                match = KOTLIN_DECLARATION.match(line)
+                if match and not match.group(1) and match.group(4):
+                    classes.add(f"{package}.{match.group(4)}")
+    return classes
+
+
+def parse_kotlin_externals():
+    externals = {}
+    for source_root in KOTLIN_SOURCES:
+        for path in sorted(source_root.rglob("*.kt")):
+            raw = path.read_text()
+            if "external " not in raw:
+                continue
+            text = strip_comments_and_strings(raw)
+            package_match = re.search(r"^package\s+([\w.]+)", text, re.M)
+            package = package_match.group(1) if package_match else ""
+            imports = {}
+            for match in re.finditer(r"^import\s+([\w.]+)(?:\s+as\s+(\w+))?", text, re.M):
+                full = match.group(1)
+                imports[match.group(2) or full.rsplit(".", 1)[-1]] = full
+            lines = text.split("\n")
+            offsets = [0]
+            for line in lines:
+                offsets.append(offsets[-1] + len(line) + 1)
+            for match in KOTLIN_EXTERNAL.finditer(text):
+                line_index = next(i for i in range(len(lines)) if offsets[i + 1] > match.start())
+                # Read the balanced parameter list.
+                depth, j = 1, match.end()
+                while depth:
+                    depth += {"(": 1, ")": -1}.get(text[j], 0)
+                    j += 1
+                params = text[match.end():j - 1]
+                rest = text[j:].split("\n", 1)[0]
+                return_match = re.match(r"\s*:\s*([\w.<>?, *]+?)\s*(?:=|\{|$)", rest)
+                return_type = return_match.group(1) if return_match else "Unit"
+                classes = enclosing_classes(lines, line_index)
+                # A @JvmStatic companion member is a static method of the
+                # outer class.
+                annotations = text[offsets[line_index]:match.start()]
+                k = line_index - 1
+                while k >= 0 and lines[k].strip().startswith("@"):
+                    annotations += lines[k]
+                    k -= 1
+                if classes and classes[-1] == "Companion" and "@JvmStatic" in annotations:
+                    classes.pop()
+                if not classes:
+                    classes = [path.stem + "Kt"]
+                class_name = "/".join(package.split(".")) + "/" + "$".join(classes)
+                param_types = []
+                for param in split_top_level(params):
+                    param = param.split("=", 1)[0]
+                    param_types.append(param.split(":", 1)[1].strip())
+                key = (class_name, match.group(1))
+                if key in externals:
+                    raise GenerationError(f"{path}: overloaded external {key} is not supported")
+                externals[key] = {
+                    "params": param_types,
+                    "return": return_type.strip(),
+                    "package": package,
+                    "imports": imports,
+                    "path": path.relative_to(ROOT),
+                }
+    return externals
+
+
+def kotlin_descriptor(kotlin_type, external):
+    nullable = kotlin_type.endswith("?")
+    kotlin_type = kotlin_type.rstrip("?").strip()
+    kotlin_type = TYPE_ALIASES.get(kotlin_type, kotlin_type)
+    function_type = re.match(r"\((.*)\)\s*->", kotlin_type)
+    if function_type:
+        arity = len(split_top_level(function_type.group(1)))
+        return f"Lkotlin/jvm/functions/Function{arity};"
+    generic = re.match(r"([\w.]+)\s*<(.*)>$", kotlin_type)
+    if generic and generic.group(1) == "Array":
+        return "[" + kotlin_descriptor(generic.group(2).strip(), external)
+    if generic:
+        kotlin_type = generic.group(1)
+    if nullable and kotlin_type in KOTLIN_BOXED:
+        return KOTLIN_BOXED[kotlin_type]
+    if kotlin_type in KOTLIN_TYPES:
+        return KOTLIN_TYPES[kotlin_type]
+    first, *nested = kotlin_type.split(".")
+    if first in external["imports"]:
+        outer = external["imports"][first]
+    elif first[0].islower():
+        # Already fully qualified.
+        segments = kotlin_type.split(".")
+        index = next(i for i, s in enumerate(segments) if s[0].isupper())
+        outer = ".".join(segments[:index + 1])
+        nested = segments[index + 1:]
+    else:
+        outer = f"{external['package']}.{first}"
+    if outer.startswith("app.rive.") and outer not in KOTLIN_CLASSES:
+        raise GenerationError(f"{external['path']}: cannot resolve Kotlin type {kotlin_type}")
+    return "L" + outer.replace(".", "/") + "".join("$" + n for n in nested) + ";"
+
+
+def jni_descriptor(jni_type, kotlin_type, external, where):
+    if jni_type in JNI_PRIMITIVES:
+        expected = JNI_PRIMITIVES[jni_type]
+        actual = kotlin_descriptor(kotlin_type, external)
+        if expected != actual:
+            raise GenerationError(
+                f"{where}: C++ {jni_type} does not match Kotlin {kotlin_type}"
+            )
+        return expected
+    if jni_type in JNI_OBJECTS:
+        actual = kotlin_descriptor(kotlin_type, external)
+        if actual[0] not in "L[":
+            raise GenerationError(
+                f"{where}: C++ {jni_type} does not match Kotlin {kotlin_type}"
+            )
+        return actual
+    raise GenerationError(f"{where}: unsupported JNI type {jni_type}")
+
+
+def build_table():
+    functions = parse_cpp_functions()
+    externals = parse_kotlin_externals()
+    TYPE_ALIASES.update(parse_kotlin_type_aliases())
+    KOTLIN_CLASSES.update(parse_kotlin_classes())
+    classes = {}
+    for function in functions:
+        key = (function["class"], function["method"])
+        where = f"{function['source']}: {function['symbol']}"
+        external = externals.get(key)
+        if external is None:
+            # Registering a method the class does not declare would fail, so
+            # leave unused bindings out of the table.
+            print(f"warning: {where}: no matching Kotlin external fun, skipped",
+                  file=sys.stderr)
+            continue
+        jni_params = function["params"][2:]
+        if len(jni_params) != len(external["params"]):
+            raise GenerationError(
+                f"{where}: {len(jni_params)} parameters in C++, "
+                f"{len(external['params'])} in Kotlin ({external['path']})"
+            )
+        signature = "(" + "".join(
+            jni_descriptor(jni, kotlin, external, where)
+            for jni, kotlin in zip(jni_params, external["params"])
+        ) + ")" + jni_descriptor(function["return"], external["return"], external, where)
+        function["signature"] = signature
+        classes.setdefault(function["class"], []).append(function)
+    defined = {(f["class"], f["method"]) for f in functions}
+    for key, external in sorted(externals.items()):
+        if key not in defined:
+            print(f"warning: {external['path']}: {key[0]}.{key[1]} has no native "
+                  "definition", file=sys.stderr)
+    return classes
+
+
+def table_identifier(class_name):
+    simple = class_name.rsplit("/", 1)[-1].replace("$", "")
+    package = class_name.rsplit("/", 1)[0].split("/")
+    # Disambiguate equal class names in different packages.
+    prefix = "".join(p.capitalize() for p in package[2:])
+    return f"k{prefix}{simple}Methods"
+
+
+def class_guard(functions, class_name):
+    """The guard for a class's whole table, or "" if its entries differ."""
+    guards = {f["guard"] for f in functions}
+    if len(guards) == 1:
+        return guards.pop()
+    if "" not in guards:
+        # Guarding entries individually could leave an empty array.
+        raise GenerationError(f"{class_name}: natives under different #if conditions")
+    return ""
+
+
+def guarded(lines, guard, body):
+    """Appends body to lines, wrapped in #if guard when there is one."""
+    if guard and lines and lines[-1] == "#endif":
+        opening = next(line for line in reversed(lines) if line.startswith("#if "))
+        if opening == f"#if {guard}":
+            # Extend the previous block under the same guard.
+            lines.pop()
+            guard, body = "", body + ["#endif"]
+    if guard:
+        lines.append(f"#if {guard}")
+    lines += body
+    if guard:
+        lines.append("#endif")
+
+
+def render(classes):
+    lines = [
+        "// Generated by tools/jni/generate_native_table.py. Do not edit by hand.",
+        "//",
+        "// Every native method of the library, registered by RegisterNativeMethods()",
+        "// from JNI_OnLoad. Regenerate after adding, removing or changing a binding.",
+        "",
+        "#include <iterator>",
+        "#include <jni.h>",
+        "",
+        '#include "jni_natives.hpp"',
+        "",
+        'extern "C"',
+        "{",
+    ]
+    for class_name in sorted(classes):
+        for function in sorted(classes[class_name], key=lambda f: f["method"]):
+            params = ", ".join(function["params"])
+            declaration = (
+                f"    JNIEXPORT {function['return']} JNICALL {function['symbol']}({params});"
+            )
+            guarded(lines, function["guard"], [declaration])
+    lines += ["}", "", "namespace rive_android", "{", "namespace", "{"]
+    for class_name in sorted(classes):
+        functions = sorted(classes[class_name], key=lambda f: f["method"])
+        guard = class_guard(functions, class_name)
+        table = [f"const JNINativeMethod {table_identifier(class_name)}[] = {{"]
+        for function in functions:
+            entry = [
+                f'    {{"{function["method"]}",',
+                f'     "{function["signature"]}",',
+                f"     reinterpret_cast<void*>(&{function['symbol']})}},",
+            ]
+            guarded(table, "" if guard else function["guard"], entry)
+        table.append("};")
+        guarded(lines, guard, table)
+        lines.append("")
+    lines.append("} // namespace")
+    lines.append("")
+    lines.append("const NativeClassMethods kNativeClassMethods[] = {")
+    for class_name in sorted(classes):
+        identifier = table_identifier(class_name)
+        guarded(lines, class_guard(classes[class_name], class_name), [
+            f'    {{"{class_name}",',
+            f"     {identifier},",
+            f"     std::size({identifier})}},",
+        ])
+    lines.append("};")
+    lines.append("const size_t kNativeClassMethodsCount = std::size(kNativeClassMethods);")
+    lines.append("} // namespace rive_android")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n", 1)[0])
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the generated table is out of date")
+    args = parser.parse_args()
+    try:
+        output = render(build_table())
+    except GenerationError as error:
+        print(f"error: {error}", file=sys.stderr)
+        return 1
+    if args.check:
+        if not OUTPUT.exists() or OUTPUT.read_text() != output:
+            print(f"{OUTPUT.relative_to(ROOT)} is out of date", file=sys.stderr)
+            return 1
+        return 0
+    OUTPUT.write_text(output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())